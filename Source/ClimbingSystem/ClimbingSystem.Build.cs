@@ -19,7 +19,12 @@ public class ClimbingSystem : ModuleRules
 			"GameplayStateTreeModule",
 			"UMG",
 			"Slate",
-			"MotionWarping"
+			"MotionWarping",
+			"NavigationSystem",
+			"Landscape",
+			"PhysicsCore",
+			"Chaos",
+			"ReplicationGraph"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[] { });
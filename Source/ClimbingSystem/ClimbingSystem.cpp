@@ -5,4 +5,16 @@
 
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, ClimbingSystem, "ClimbingSystem" );
 
-DEFINE_LOG_CATEGORY(LogClimbingSystem)
\ No newline at end of file
+DEFINE_LOG_CATEGORY(LogClimbingSystem)
+
+DEFINE_STAT(STAT_ClimbMovementTick);
+DEFINE_STAT(STAT_PhysClimb);
+DEFINE_STAT(STAT_PhysSplineClimb);
+DEFINE_STAT(STAT_PhysShimmy);
+DEFINE_STAT(STAT_ClimbSceneQueries);
+DEFINE_STAT(STAT_ClimbQueryCacheHits);
+DEFINE_STAT(STAT_ClimbDistanceFieldSamples);
+
+std::atomic<int32> ClimbStats::NumSceneQueries{ 0 };
+std::atomic<int32> ClimbStats::NumQueryCacheHits{ 0 };
+double ClimbStats::MovementTickSeconds = 0.0;
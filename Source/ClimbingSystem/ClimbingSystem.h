@@ -3,6 +3,32 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include <atomic>
 
 /** Main log category used across the project */
-DECLARE_LOG_CATEGORY_EXTERN(LogClimbingSystem, Log, All);
\ No newline at end of file
+DECLARE_LOG_CATEGORY_EXTERN(LogClimbingSystem, Log, All);
+
+/** 등반 프로브 전용 트레이스 채널 (DefaultEngine.ini 의 "Climb" 채널) */
+#define ECC_Climb ECC_GameTraceChannel2
+
+DECLARE_STATS_GROUP(TEXT("Climbing"), STATGROUP_Climbing, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Climb Movement Tick"), STAT_ClimbMovementTick, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PhysClimb"), STAT_PhysClimb, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PhysSplineClimb"), STAT_PhysSplineClimb, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PhysShimmy"), STAT_PhysShimmy, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Climb Scene Queries"), STAT_ClimbSceneQueries, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Climb Query Cache Hits"), STAT_ClimbQueryCacheHits, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Climb Distance Field Samples"), STAT_ClimbDistanceFieldSamples, STATGROUP_Climbing, CLIMBINGSYSTEM_API);
+
+/**
+ * 누적되는 등반 비용. 벤치마크가 프레임마다 읽고 초기화한다 (stat 시스템이 없는 빌드에서도 동작)
+ * 쿼리 카운터는 비동기 트레이스 완료 콜백에서도 올라가므로 원자적으로 센다. 틱 시간은 게임 스레드에서만 누적
+ */
+namespace ClimbStats
+{
+	extern CLIMBINGSYSTEM_API std::atomic<int32> NumSceneQueries;
+	extern CLIMBINGSYSTEM_API std::atomic<int32> NumQueryCacheHits;
+	extern CLIMBINGSYSTEM_API double MovementTickSeconds;
+}
@@ -6,6 +6,7 @@
 #include "Engine/LocalPlayer.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
+#include "Components/ClimbSpringArmComponent.h"
 #include "Components/CustomMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/Controller.h"
@@ -43,7 +44,8 @@ AClimbingSystemCharacter::AClimbingSystemCharacter(const FObjectInitializer& Obj
 	GetCharacterMovement()->BrakingDecelerationFalling = 1500.0f;
 
 	// Create a camera boom (pulls in towards the player if there is a collision)
-	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
+	// 등반 중에는 이동 컴포넌트의 벽면 정보로 충돌을 처리하는 스프링 암
+	CameraBoom = CreateDefaultSubobject<UClimbSpringArmComponent>(TEXT("CameraBoom"));
 	CameraBoom->SetupAttachment(RootComponent);
 	CameraBoom->TargetArmLength = 400.0f;
 	CameraBoom->bUsePawnControlRotation = true;
@@ -91,6 +93,17 @@ void AClimbingSystemCharacter::BeginPlay()
 	}
 }
 
+void AClimbingSystemCharacter::Jump()
+{
+	// 점프 입력은 이동 컴포넌트 틱에서 처리되므로 잠들어 있으면 먼저 깨움
+	if (CustomMovementComponent)
+	{
+		CustomMovementComponent->WakeClimbTick();
+	}
+
+	Super::Jump();
+}
+
 void AClimbingSystemCharacter::Look(const FInputActionValue& Value)
 {
 	// input is a Vector2D
@@ -107,7 +120,7 @@ void AClimbingSystemCharacter::OnClimbActionStarted(const FInputActionValue& Val
 		return;
 	}
 
-	if(!CustomMovementComponent->IsClimbing())
+	if(!CustomMovementComponent->IsInAnyClimbMode())
 	{
 		CustomMovementComponent->ToggleClimbing(true);
 	}
@@ -31,6 +31,7 @@ public:
 	AClimbingSystemCharacter(const FObjectInitializer& ObjectInitializer);
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 	virtual void BeginPlay() override;
+	virtual void Jump() override;
 
 private:
 	
@@ -0,0 +1,143 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/ClimbBotController.h"
+
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+
+AClimbBotController::AClimbBotController()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	bWantsPlayerState = false;
+}
+
+void AClimbBotController::InitializeBot(int32 Seed)
+{
+	RandomStream.Initialize(Seed);
+	DecisionTimeRemaining = RandomStream.FRandRange(DecisionInterval.X, DecisionInterval.Y);
+}
+
+void AClimbBotController::OnPossess(APawn* InPawn)
+{
+	Super::OnPossess(InPawn);
+
+	const ACharacter* PossessedCharacter = Cast<ACharacter>(InPawn);
+	CustomMovementComponent = PossessedCharacter ? Cast<UCustomMovementComponent>(PossessedCharacter->GetCharacterMovement()) : nullptr;
+}
+
+void AClimbBotController::OnUnPossess()
+{
+	CustomMovementComponent = nullptr;
+
+	Super::OnUnPossess();
+}
+
+bool AClimbBotController::IsBotClimbing() const
+{
+	return CustomMovementComponent && CustomMovementComponent->IsInAnyClimbMode();
+}
+
+void AClimbBotController::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (!CustomMovementComponent || !CanChooseAction())
+	{
+		return;
+	}
+
+	DecisionTimeRemaining -= DeltaSeconds;
+
+	if (DecisionTimeRemaining <= 0.f)
+	{
+		// 오래된 스냅샷은 요청 시점에 한 번 갱신됨 (봇이 직접 트레이스하지 않음)
+		const FClimbProbeSnapshot& Snapshot = CustomMovementComponent->RequestClimbProbeSnapshot();
+
+		// 렛지에 매달린 상태도 등반 중 결정을 따름 (위 입력 유지 = TopOut)
+		Snapshot.bIsClimbing || CustomMovementComponent->IsShimmying() ? ChooseClimbAction(Snapshot) : ChooseGroundAction(Snapshot);
+		DecisionTimeRemaining = RandomStream.FRandRange(DecisionInterval.X, DecisionInterval.Y);
+	}
+
+	ApplyMoveInput();
+}
+
+bool AClimbBotController::CanChooseAction() const
+{
+	return !CustomMovementComponent->IsClimbActionPlaying() && !CustomMovementComponent->IsFalling();
+}
+
+void AClimbBotController::ChooseGroundAction(const FClimbProbeSnapshot& Snapshot)
+{
+	if (Snapshot.bCanStartClimbing && RandomStream.FRand() < EnterClimbChance)
+	{
+		CustomMovementComponent->TryClimbAction(EClimbAction::EnterClimb);
+	}
+	else if (Snapshot.bCanVault && RandomStream.FRand() < 0.5f)
+	{
+		CustomMovementComponent->TryClimbAction(EClimbAction::Vault);
+	}
+	else if (Snapshot.bCanClimbDownLedge && RandomStream.FRand() < 0.3f)
+	{
+		CustomMovementComponent->TryClimbAction(EClimbAction::ClimbDownLedge);
+	}
+
+	// 배회 방향
+	const float Heading = RandomStream.FRandRange(0.f, UE_TWO_PI);
+	MoveInput = FVector2D(FMath::Cos(Heading), FMath::Sin(Heading));
+}
+
+void AClimbBotController::ChooseClimbAction(const FClimbProbeSnapshot& Snapshot)
+{
+	if (RandomStream.FRand() < ClimbActionChance)
+	{
+		if (Snapshot.bCanTopOut)
+		{
+			CustomMovementComponent->TryClimbAction(EClimbAction::TopOut);
+		}
+		else if (Snapshot.bCanHopUp && RandomStream.FRand() < 0.6f)
+		{
+			CustomMovementComponent->TryClimbAction(EClimbAction::HopUp);
+		}
+		else if (Snapshot.bCanHopDown && RandomStream.FRand() < 0.5f)
+		{
+			CustomMovementComponent->TryClimbAction(EClimbAction::HopDown);
+		}
+		else if ((Snapshot.bCanHopLeft || Snapshot.bCanHopRight) && RandomStream.FRand() < 0.5f)
+		{
+			const bool bHopLeft = Snapshot.bCanHopLeft && (!Snapshot.bCanHopRight || RandomStream.FRand() < 0.5f);
+			CustomMovementComponent->TryClimbAction(bHopLeft ? EClimbAction::HopLeft : EClimbAction::HopRight);
+		}
+		else
+		{
+			CustomMovementComponent->ToggleClimbing(false);
+		}
+	}
+
+	// 위쪽으로 치우친 등반 방향
+	MoveInput = FVector2D(RandomStream.FRandRange(-1.f, 1.f), RandomStream.FRandRange(-0.3f, 1.f)).GetSafeNormal();
+}
+
+void AClimbBotController::ApplyMoveInput() const
+{
+	APawn* ControlledPawn = GetPawn();
+	if (!ControlledPawn)
+	{
+		return;
+	}
+
+	if (CustomMovementComponent->IsClimbing() || CustomMovementComponent->IsShimmying())
+	{
+		// AClimbingSystemCharacter::HandleClimbMovementInput 과 같은 표면 기준 축
+		const FVector SurfaceNormal = CustomMovementComponent->GetClimbableSurfaceNormal();
+		const FVector UpDirection = FVector::CrossProduct(-SurfaceNormal, ControlledPawn->GetActorRightVector());
+		const FVector RightDirection = FVector::CrossProduct(-SurfaceNormal, -ControlledPawn->GetActorUpVector());
+
+		ControlledPawn->AddMovementInput(UpDirection, MoveInput.Y);
+		ControlledPawn->AddMovementInput(RightDirection, MoveInput.X);
+	}
+	else if (CustomMovementComponent->IsMovingOnGround())
+	{
+		ControlledPawn->AddMovementInput(FVector(MoveInput, 0.f));
+	}
+}
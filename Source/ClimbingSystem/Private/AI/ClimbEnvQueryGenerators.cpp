@@ -0,0 +1,205 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/ClimbEnvQueryGenerators.h"
+
+#include "ClimbingSystem.h"
+#include "AI/ClimbRoutePlannerSubsystem.h"
+#include "Algo/Unique.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
+#include "EnvironmentQuery/Items/EnvQueryItemType_Point.h"
+#include "Subsystems/ClimbLedgeSubsystem.h"
+#include "Subsystems/ClimbSurfaceSubsystem.h"
+
+#define LOCTEXT_NAMESPACE "ClimbEnvQueryGenerators"
+
+namespace ClimbEnvQuery
+{
+	static bool IsWithinRadius(const TArray<FVector>& ContextLocations, const FVector& Location, float RadiusSquared)
+	{
+		return ContextLocations.ContainsByPredicate([&Location, RadiusSquared](const FVector& ContextLocation)
+		{
+			return FVector::DistSquared(ContextLocation, Location) <= RadiusSquared;
+		});
+	}
+}
+
+#pragma region Route Nodes
+
+UEnvQueryGenerator_ClimbRouteNodes::UEnvQueryGenerator_ClimbRouteNodes()
+{
+	ItemType = UEnvQueryItemType_Point::StaticClass();
+	GenerateAround = UEnvQueryContext_Querier::StaticClass();
+	SearchRadius.DefaultValue = 1000.f;
+}
+
+void UEnvQueryGenerator_ClimbRouteNodes::GenerateItems(FEnvQueryInstance& QueryInstance) const
+{
+	const UClimbRoutePlannerSubsystem* ClimbRoutePlannerSubsystem = QueryInstance.World ? QueryInstance.World->GetSubsystem<UClimbRoutePlannerSubsystem>() : nullptr;
+	if (!ClimbRoutePlannerSubsystem || !ClimbRoutePlannerSubsystem->IsGraphBuilt())
+	{
+		return;
+	}
+
+	SearchRadius.BindData(QueryInstance.Owner.Get(), QueryInstance.QueryID);
+	const float Radius = SearchRadius.GetValue();
+
+	TArray<FVector> ContextLocations;
+	QueryInstance.PrepareContext(GenerateAround, ContextLocations);
+
+	TArray<int32> NodeIndices;
+	for (const FVector& ContextLocation : ContextLocations)
+	{
+		ClimbRoutePlannerSubsystem->GatherNodesInRadius(ContextLocation, Radius, NodeIndices);
+	}
+
+	// 컨텍스트가 여러 개면 반경이 겹쳐 같은 노드가 여러 번 모임
+	if (ContextLocations.Num() > 1)
+	{
+		NodeIndices.Sort();
+		NodeIndices.SetNum(Algo::Unique(NodeIndices));
+	}
+
+	const TArray<FClimbRouteNode>& Nodes = ClimbRoutePlannerSubsystem->GetNodes();
+
+	for (const int32 NodeIndex : NodeIndices)
+	{
+		const FClimbRouteNode& Node = Nodes[NodeIndex];
+
+		bool bWanted = false;
+		switch (Node.Type)
+		{
+		case EClimbRouteNodeType::SurfacePatch:	bWanted = bSurfacePatches; break;
+		case EClimbRouteNodeType::Ledge:		bWanted = bLedges; break;
+		case EClimbRouteNodeType::VaultPoint:	bWanted = bVaultPoints; break;
+		case EClimbRouteNodeType::Ground:		bWanted = bGroundPoints; break;
+		default:								break;
+		}
+
+		if (bWanted)
+		{
+			QueryInstance.AddItemData<UEnvQueryItemType_Point>(Node.Location);
+		}
+	}
+}
+
+FText UEnvQueryGenerator_ClimbRouteNodes::GetDescriptionTitle() const
+{
+	return FText::Format(LOCTEXT("ClimbRouteNodesTitle", "Climb route nodes around {0}"), UEnvQueryTypes::DescribeContext(GenerateAround));
+}
+
+FText UEnvQueryGenerator_ClimbRouteNodes::GetDescriptionDetails() const
+{
+	return FText::Format(LOCTEXT("ClimbRouteNodesDetails", "radius: {0}"), FText::FromString(SearchRadius.ToString()));
+}
+
+#pragma endregion
+
+#pragma region Ledges
+
+UEnvQueryGenerator_ClimbLedges::UEnvQueryGenerator_ClimbLedges()
+{
+	ItemType = UEnvQueryItemType_Point::StaticClass();
+	GenerateAround = UEnvQueryContext_Querier::StaticClass();
+	SearchRadius.DefaultValue = 1000.f;
+	SampleSpacing.DefaultValue = 50.f;
+}
+
+void UEnvQueryGenerator_ClimbLedges::GenerateItems(FEnvQueryInstance& QueryInstance) const
+{
+	UWorld* World = QueryInstance.World;
+	UClimbSurfaceSubsystem* ClimbSurfaceSubsystem = World ? World->GetSubsystem<UClimbSurfaceSubsystem>() : nullptr;
+	UClimbLedgeSubsystem* ClimbLedgeSubsystem = World ? World->GetSubsystem<UClimbLedgeSubsystem>() : nullptr;
+
+	if (!ClimbSurfaceSubsystem || !ClimbLedgeSubsystem)
+	{
+		return;
+	}
+
+	UObject* QueryOwner = QueryInstance.Owner.Get();
+	SearchRadius.BindData(QueryOwner, QueryInstance.QueryID);
+	SampleSpacing.BindData(QueryOwner, QueryInstance.QueryID);
+
+	const float Radius = SearchRadius.GetValue();
+	const float RadiusSquared = FMath::Square(Radius);
+	const float Spacing = FMath::Max(SampleSpacing.GetValue(), 1.f);
+
+	TArray<FVector> ContextLocations;
+	if (!QueryInstance.PrepareContext(GenerateAround, ContextLocations))
+	{
+		return;
+	}
+
+	// 등록된 프리미티브 전체를 훑지 않고 브로드페이즈로 반경 안의 프리미티브만 모음 (폰은 등반 채널을 무시)
+	TArray<const UPrimitiveComponent*> NearbyComponents;
+	TArray<FOverlapResult> Overlaps;
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbEnvQueryLedges), false);
+
+	for (const FVector& ContextLocation : ContextLocations)
+	{
+		INC_DWORD_STAT(STAT_ClimbSceneQueries);
+		++ClimbStats::NumSceneQueries;
+
+		Overlaps.Reset();
+		World->OverlapMultiByChannel(Overlaps, ContextLocation, FQuat::Identity, ECC_Climb, FCollisionShape::MakeSphere(Radius), QueryParams, FCollisionResponseParams(ECR_Overlap));
+
+		for (const FOverlapResult& Overlap : Overlaps)
+		{
+			const UPrimitiveComponent* Component = Overlap.GetComponent();
+			if (Component && ClimbSurfaceSubsystem->GetComponentProperties(Component).bClimbable)
+			{
+				NearbyComponents.AddUnique(Component);
+			}
+		}
+	}
+
+	for (const UPrimitiveComponent* Component : NearbyComponents)
+	{
+		// 아직 추출되지 않은 프리미티브는 비동기 추출 큐에 넣고, 다음 쿼리 실행부터 포함됨
+		const FClimbLedgeSet* LedgeSet = ClimbLedgeSubsystem->RequestLedges(Component);
+
+		if (!LedgeSet)
+		{
+			continue;
+		}
+
+		const FTransform& ComponentTransform = Component->GetComponentTransform();
+
+		for (const FClimbLedgePolyline& Ledge : LedgeSet->Ledges)
+		{
+			const float LedgeLength = Ledge.GetLength();
+			const int32 NumSamples = FMath::Max(1, FMath::FloorToInt32(LedgeLength / Spacing) + (Ledge.bClosedLoop ? 0 : 1));
+
+			for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+			{
+				FVector LipLocation, LedgeNormal, LedgeTangent;
+				Ledge.Evaluate(SampleIndex * Spacing, 0.f, LipLocation, LedgeNormal, LedgeTangent);
+
+				const FVector ItemLocation = ComponentTransform.TransformPositionNoScale(LipLocation + LedgeNormal * OutwardOffset);
+
+				if (ClimbEnvQuery::IsWithinRadius(ContextLocations, ItemLocation, RadiusSquared))
+				{
+					QueryInstance.AddItemData<UEnvQueryItemType_Point>(ItemLocation);
+				}
+			}
+		}
+	}
+}
+
+FText UEnvQueryGenerator_ClimbLedges::GetDescriptionTitle() const
+{
+	return FText::Format(LOCTEXT("ClimbLedgesTitle", "Climb ledges around {0}"), UEnvQueryTypes::DescribeContext(GenerateAround));
+}
+
+FText UEnvQueryGenerator_ClimbLedges::GetDescriptionDetails() const
+{
+	return FText::Format(LOCTEXT("ClimbLedgesDetails", "radius: {0}, spacing: {1}"),
+		FText::FromString(SearchRadius.ToString()), FText::FromString(SampleSpacing.ToString()));
+}
+
+#pragma endregion
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,386 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/ClimbEnvQuerySubsystem.h"
+
+#include "ClimbingSystem.h"
+#include "AI/ClimbRoutePlannerSubsystem.h"
+#include "Engine/World.h"
+#include "Subsystems/ClimbSurfaceSubsystem.h"
+
+namespace ClimbEnvQuery
+{
+	static TAutoConsoleVariable<int32> CVarMaxTracesPerFrame(
+		TEXT("climb.EQS.MaxTracesPerFrame"),
+		16,
+		TEXT("EQS 등반 규칙 평가가 프레임당 보내는 비동기 트레이스 상한"));
+
+	static TAutoConsoleVariable<float> CVarCacheLifetime(
+		TEXT("climb.EQS.CacheLifetime"),
+		10.f,
+		TEXT("EQS 등반 규칙 평가의 트레이스 / 판정 결과를 재사용하는 시간 (초)"));
+
+	/** 아이템 / 트레이스 위치를 같은 키로 묶는 격자 크기 (EQS 아이템은 보통 수십 cm 간격) */
+	static constexpr float QuantizationSize = 5.f;
+
+	/** 방향을 같은 키로 묶는 요 각도 간격 */
+	static constexpr float YawQuantizationDegrees = 10.f;
+
+	static constexpr double PurgeInterval = 1.0;
+
+	static FIntVector Quantize(const FVector& Location)
+	{
+		return FIntVector(
+			FMath::RoundToInt32(Location.X / QuantizationSize),
+			FMath::RoundToInt32(Location.Y / QuantizationSize),
+			FMath::RoundToInt32(Location.Z / QuantizationSize));
+	}
+
+	static FClimbEnvQueryTraceKey MakeTraceKey(const FVector& Start, const FVector& End, const FClimbRuleSettings& Settings, bool bCapsule)
+	{
+		FClimbEnvQueryTraceKey Key;
+		Key.Start = Quantize(Start);
+		Key.End = Quantize(End);
+		Key.TraceChannel = static_cast<uint8>(Settings.TraceChannel);
+		Key.bCapsule = bCapsule;
+
+		// 라인 트레이스는 캡슐 크기와 무관
+		if (bCapsule)
+		{
+			Key.CapsuleRadius = FMath::RoundToInt32(Settings.CapsuleTraceRadius);
+			Key.CapsuleHalfHeight = FMath::RoundToInt32(Settings.CapsuleTraceHalfHeight);
+		}
+
+		return Key;
+	}
+
+	static FClimbEnvQueryVerdictKey MakeVerdictKey(EClimbEnvQueryRule Rule, const FClimbRuleSettings& Settings, const FClimbProbePose& Pose)
+	{
+		FClimbEnvQueryVerdictKey Key;
+		Key.Rule = Rule;
+		Key.Location = Quantize(Pose.Location);
+		Key.YawBucket = FMath::RoundToInt32(Pose.Forward.Rotation().Yaw / YawQuantizationDegrees);
+		Key.TraceChannel = static_cast<uint8>(Settings.TraceChannel);
+		Key.CapsuleRadius = FMath::RoundToInt32(Settings.CapsuleTraceRadius);
+		Key.CapsuleHalfHeight = FMath::RoundToInt32(Settings.CapsuleTraceHalfHeight);
+		Key.EyeHeight = FMath::RoundToInt32(Settings.EyeHeight);
+		Key.ClimbDownWalkableSurfaceTraceOffset = FMath::RoundToInt32(Settings.ClimbDownWalkableSurfaceTraceOffset);
+		Key.ClimbDownLedgeTraceOffset = FMath::RoundToInt32(Settings.ClimbDownLedgeTraceOffset);
+		Key.MaxClimbableSurfaceAngle = FMath::RoundToInt32(Settings.MaxClimbableSurfaceAngle);
+		Key.VaultTraceSteps = Settings.VaultTraceSteps;
+		Key.VaultLandTraceIndex = Settings.VaultLandTraceIndex;
+		return Key;
+	}
+
+	/** 경로 그래프 노드에서 규칙에 해당하는 엣지 */
+	static bool GetRouteEdgeType(EClimbEnvQueryRule Rule, EClimbRouteEdgeType& OutEdgeType)
+	{
+		switch (Rule)
+		{
+		case EClimbEnvQueryRule::StartClimbing:		OutEdgeType = EClimbRouteEdgeType::Enter; return true;
+		case EClimbEnvQueryRule::TopOut:			OutEdgeType = EClimbRouteEdgeType::TopOut; return true;
+		case EClimbEnvQueryRule::ClimbDownLedge:	OutEdgeType = EClimbRouteEdgeType::ClimbDown; return true;
+		case EClimbEnvQueryRule::Vault:				OutEdgeType = EClimbRouteEdgeType::Vault; return true;
+		default:									return false;
+		}
+	}
+}
+
+/**
+ * 캐시된 트레이스 결과로 등반 규칙을 재생하는 트레이서
+ * 캐시에 없는 첫 트레이스를 요청한 뒤에는 결과가 의미 없으므로 더 요청하지 않고 빈 결과만 돌려준다.
+ */
+class FClimbEnvQueryReplayTracer final : public IClimbRuleTracer
+{
+public:
+	FClimbEnvQueryReplayTracer(UClimbEnvQuerySubsystem& InSubsystem, const FClimbRuleSettings& InSettings)
+		: Subsystem(InSubsystem)
+		, Settings(InSettings)
+	{
+	}
+
+	virtual FHitResult LineTrace(const FVector& Start, const FVector& End) override
+	{
+		if (const TArray<FHitResult>* Hits = Replay(Start, End, false))
+		{
+			const FHitResult* BlockingHit = Hits->FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+			if (BlockingHit)
+			{
+				return *BlockingHit;
+			}
+		}
+
+		return FHitResult(Start, End);
+	}
+
+	virtual TArray<FHitResult> CapsuleTrace(const FVector& Start, const FVector& End) override
+	{
+		TArray<FHitResult> Hits;
+		if (const TArray<FHitResult>* CachedHits = Replay(Start, End, true))
+		{
+			Hits = *CachedHits;
+			Subsystem.FilterClimbableHits(Hits);
+		}
+
+		return Hits;
+	}
+
+	bool bIncomplete = false;
+
+private:
+	const TArray<FHitResult>* Replay(const FVector& Start, const FVector& End, bool bCapsule)
+	{
+		if (bIncomplete)
+		{
+			return nullptr;
+		}
+
+		const FClimbEnvQueryTraceKey TraceKey = ClimbEnvQuery::MakeTraceKey(Start, End, Settings, bCapsule);
+		if (const TArray<FHitResult>* Hits = Subsystem.FindTraceResult(TraceKey))
+		{
+			return Hits;
+		}
+
+		Subsystem.RequestTrace(TraceKey, Start, End, Settings);
+		bIncomplete = true;
+		return nullptr;
+	}
+
+	UClimbEnvQuerySubsystem& Subsystem;
+	const FClimbRuleSettings& Settings;
+};
+
+void UClimbEnvQuerySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ClimbSurfaceSubsystem = Collection.InitializeDependency<UClimbSurfaceSubsystem>();
+	ClimbRoutePlannerSubsystem = Collection.InitializeDependency<UClimbRoutePlannerSubsystem>();
+
+	TraceDelegate.BindUObject(this, &ThisClass::OnTraceDone);
+}
+
+void UClimbEnvQuerySubsystem::Deinitialize()
+{
+	TraceDelegate.Unbind();
+
+	TraceResults.Empty();
+	Verdicts.Empty();
+	PendingTraceKeys.Empty();
+	QueuedTraces.Empty();
+	InFlightTraces.Empty();
+
+	Super::Deinitialize();
+}
+
+void UClimbEnvQuerySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	DispatchQueuedTraces();
+
+	if (GetWorld()->GetTimeSeconds() - LastPurgeTime >= ClimbEnvQuery::PurgeInterval)
+	{
+		PurgeExpiredEntries();
+	}
+}
+
+TStatId UClimbEnvQuerySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UClimbEnvQuerySubsystem, STATGROUP_Tickables);
+}
+
+EClimbEnvQueryVerdict UClimbEnvQuerySubsystem::EvaluateRule(EClimbEnvQueryRule Rule, const FClimbRuleSettings& Settings, const FVector& ItemLocation, const FClimbProbePose& Pose, float RouteNodeMatchDistance)
+{
+	bool bPass = false;
+	if (EvaluateRuleFromRouteGraph(Rule, ItemLocation, RouteNodeMatchDistance, bPass))
+	{
+		return bPass ? EClimbEnvQueryVerdict::Pass : EClimbEnvQueryVerdict::Fail;
+	}
+
+	const FClimbEnvQueryVerdictKey VerdictKey = ClimbEnvQuery::MakeVerdictKey(Rule, Settings, Pose);
+	if (const FCachedVerdict* CachedVerdict = Verdicts.Find(VerdictKey))
+	{
+		return CachedVerdict->bPass ? EClimbEnvQueryVerdict::Pass : EClimbEnvQueryVerdict::Fail;
+	}
+
+	FClimbEnvQueryReplayTracer Tracer(*this, Settings);
+
+	switch (Rule)
+	{
+	case EClimbEnvQueryRule::StartClimbing:
+		{
+			TArray<FHitResult> SurfaceHits;
+			bPass = ClimbRules::CanStartClimbing(Settings, Pose, Tracer, SurfaceHits);
+			break;
+		}
+
+	case EClimbEnvQueryRule::TopOut:
+		bPass = ClimbRules::CanTopOut(Settings, Pose, Tracer);
+		break;
+
+	case EClimbEnvQueryRule::ClimbDownLedge:
+		{
+			FHitResult WalkableSurfaceHit;
+			bPass = ClimbRules::CanClimbDownLedge(Settings, Pose, Tracer, WalkableSurfaceHit);
+			break;
+		}
+
+	case EClimbEnvQueryRule::Vault:
+		{
+			FVector VaultStartPosition, VaultLandPosition;
+			bPass = ClimbRules::CanStartVaulting(Settings, Pose, Tracer, VaultStartPosition, VaultLandPosition);
+			break;
+		}
+
+	default:
+		break;
+	}
+
+	if (Tracer.bIncomplete)
+	{
+		return EClimbEnvQueryVerdict::Pending;
+	}
+
+	FCachedVerdict& NewVerdict = Verdicts.Add(VerdictKey);
+	NewVerdict.bPass = bPass;
+	NewVerdict.Time = GetWorld()->GetTimeSeconds();
+
+	return bPass ? EClimbEnvQueryVerdict::Pass : EClimbEnvQueryVerdict::Fail;
+}
+
+/**
+ * @brief 구워 둔 경로 그래프에 아이템 위치의 노드가 있으면 그 노드의 나가는 엣지로 판정
+ *
+ * 그래프는 같은 등반 규칙으로 빌드되므로 노드가 있는데 엣지가 없으면 실패로 본다. 벽면 패치 노드는 이미 벽에 붙은 위치이므로 등반 시작 가능.
+ */
+bool UClimbEnvQuerySubsystem::EvaluateRuleFromRouteGraph(EClimbEnvQueryRule Rule, const FVector& ItemLocation, float RouteNodeMatchDistance, bool& bOutPass) const
+{
+	if (!ClimbRoutePlannerSubsystem || !ClimbRoutePlannerSubsystem->IsGraphBuilt() || RouteNodeMatchDistance <= 0.f)
+	{
+		return false;
+	}
+
+	const int32 NodeIndex = ClimbRoutePlannerSubsystem->FindNearestNode(ItemLocation, RouteNodeMatchDistance);
+	EClimbRouteEdgeType EdgeType;
+	if (NodeIndex == INDEX_NONE || !ClimbEnvQuery::GetRouteEdgeType(Rule, EdgeType))
+	{
+		return false;
+	}
+
+	const FClimbRouteNode& Node = ClimbRoutePlannerSubsystem->GetNodes()[NodeIndex];
+
+	bOutPass = (Rule == EClimbEnvQueryRule::StartClimbing && Node.Type == EClimbRouteNodeType::SurfacePatch)
+		|| Node.Edges.ContainsByPredicate([EdgeType](const FClimbRouteEdge& Edge) { return Edge.Type == EdgeType; });
+
+	return true;
+}
+
+const TArray<FHitResult>* UClimbEnvQuerySubsystem::FindTraceResult(const FClimbEnvQueryTraceKey& TraceKey) const
+{
+	const FCachedTrace* CachedTrace = TraceResults.Find(TraceKey);
+	return CachedTrace ? &CachedTrace->Hits : nullptr;
+}
+
+void UClimbEnvQuerySubsystem::RequestTrace(const FClimbEnvQueryTraceKey& TraceKey, const FVector& Start, const FVector& End, const FClimbRuleSettings& Settings)
+{
+	bool bAlreadyPending = false;
+	PendingTraceKeys.Add(TraceKey, &bAlreadyPending);
+
+	if (bAlreadyPending)
+	{
+		return;
+	}
+
+	FQueuedTrace& QueuedTrace = QueuedTraces.AddDefaulted_GetRef();
+	QueuedTrace.TraceKey = TraceKey;
+	QueuedTrace.Start = Start;
+	QueuedTrace.End = End;
+	QueuedTrace.TraceChannel = Settings.TraceChannel;
+	QueuedTrace.Shape = FCollisionShape::MakeCapsule(Settings.CapsuleTraceRadius, Settings.CapsuleTraceHalfHeight);
+}
+
+void UClimbEnvQuerySubsystem::FilterClimbableHits(TArray<FHitResult>& InOutHits)
+{
+	if (ClimbSurfaceSubsystem)
+	{
+		ClimbSurfaceSubsystem->FilterClimbableHits(InOutHits);
+	}
+}
+
+void UClimbEnvQuerySubsystem::DispatchQueuedTraces()
+{
+	const int32 NumToDispatch = FMath::Min(QueuedTraces.Num(), ClimbEnvQuery::CVarMaxTracesPerFrame.GetValueOnGameThread());
+	if (NumToDispatch <= 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbEnvQueryTrace), false);
+	QueryParams.bReturnPhysicalMaterial = true;
+
+	for (int32 TraceIndex = 0; TraceIndex < NumToDispatch; ++TraceIndex)
+	{
+		const FQueuedTrace& QueuedTrace = QueuedTraces[TraceIndex];
+		const uint32 TraceId = NextTraceId++;
+		InFlightTraces.Add(TraceId, QueuedTrace.TraceKey);
+
+		INC_DWORD_STAT(STAT_ClimbSceneQueries);
+		++ClimbStats::NumSceneQueries;
+
+		// 캡슐은 무브먼트 컴포넌트와 같이 모든 표면을 겹침으로 받아 등반 불가 표면을 재생 시점에 거름
+		if (QueuedTrace.TraceKey.bCapsule)
+		{
+			World->AsyncSweepByChannel(EAsyncTraceType::Multi, QueuedTrace.Start, QueuedTrace.End, FQuat::Identity, QueuedTrace.TraceChannel,
+				QueuedTrace.Shape, QueryParams, FCollisionResponseParams(ECR_Overlap), &TraceDelegate, TraceId);
+		}
+		else
+		{
+			World->AsyncLineTraceByChannel(EAsyncTraceType::Single, QueuedTrace.Start, QueuedTrace.End, QueuedTrace.TraceChannel,
+				QueryParams, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, TraceId);
+		}
+	}
+
+	QueuedTraces.RemoveAt(0, NumToDispatch, EAllowShrinking::No);
+}
+
+void UClimbEnvQuerySubsystem::OnTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	FClimbEnvQueryTraceKey TraceKey;
+	if (!InFlightTraces.RemoveAndCopyValue(TraceDatum.UserData, TraceKey))
+	{
+		return;
+	}
+
+	PendingTraceKeys.Remove(TraceKey);
+
+	FCachedTrace& CachedTrace = TraceResults.Add(TraceKey);
+	CachedTrace.Hits = MoveTemp(TraceDatum.OutHits);
+	CachedTrace.Time = GetWorld()->GetTimeSeconds();
+}
+
+void UClimbEnvQuerySubsystem::PurgeExpiredEntries()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double ExpireBefore = Now - ClimbEnvQuery::CVarCacheLifetime.GetValueOnGameThread();
+
+	LastPurgeTime = Now;
+
+	for (auto It = TraceResults.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Time < ExpireBefore)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = Verdicts.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Time < ExpireBefore)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
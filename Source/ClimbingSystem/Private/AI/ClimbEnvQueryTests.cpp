@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/ClimbEnvQueryTests.h"
+
+#include "Components/CustomMovementComponent.h"
+#include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
+#include "EnvironmentQuery/Items/EnvQueryItemType_VectorBase.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Controller.h"
+
+#define LOCTEXT_NAMESPACE "ClimbEnvQueryTests"
+
+namespace ClimbEnvQuery
+{
+	/** 쿼리 오너(폰 또는 AI 컨트롤러) 의 등반 규칙 튜닝 값. 등반 캐릭터가 아니면 기본값 */
+	static FClimbRuleSettings GetQuerierRuleSettings(const UObject* QueryOwner)
+	{
+		const ACharacter* Character = Cast<ACharacter>(QueryOwner);
+		if (!Character)
+		{
+			const AController* Controller = Cast<AController>(QueryOwner);
+			Character = Controller ? Cast<ACharacter>(Controller->GetPawn()) : nullptr;
+		}
+
+		const UCustomMovementComponent* CustomMovementComponent = Character ? Cast<UCustomMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+		return CustomMovementComponent ? CustomMovementComponent->GetClimbRuleSettings() : FClimbRuleSettings();
+	}
+
+	static FText DescribeRule(EClimbEnvQueryRule Rule)
+	{
+		return StaticEnum<EClimbEnvQueryRule>()->GetDisplayNameTextByValue(static_cast<int64>(Rule));
+	}
+}
+
+UEnvQueryTest_ClimbRule::UEnvQueryTest_ClimbRule()
+{
+	// 대부분 그래프 / 캐시로 답하고 트레이스는 서브시스템이 프레임 상한 안에서 비동기로 보냄
+	Cost = EEnvTestCost::Low;
+	ValidItemType = UEnvQueryItemType_VectorBase::StaticClass();
+	SetWorkOnFloatValues(false);
+
+	FacingContext = UEnvQueryContext_Querier::StaticClass();
+}
+
+void UEnvQueryTest_ClimbRule::RunTest(FEnvQueryInstance& QueryInstance) const
+{
+	UClimbEnvQuerySubsystem* ClimbEnvQuerySubsystem = QueryInstance.World ? QueryInstance.World->GetSubsystem<UClimbEnvQuerySubsystem>() : nullptr;
+	if (!ClimbEnvQuerySubsystem)
+	{
+		return;
+	}
+
+	UObject* QueryOwner = QueryInstance.Owner.Get();
+	BoolValue.BindData(QueryOwner, QueryInstance.QueryID);
+	const bool bWantsPass = BoolValue.GetValue();
+
+	TArray<FVector> FacingLocations;
+	if (!QueryInstance.PrepareContext(FacingContext, FacingLocations) || FacingLocations.IsEmpty())
+	{
+		return;
+	}
+
+	const FClimbRuleSettings Settings = ClimbEnvQuery::GetQuerierRuleSettings(QueryOwner);
+
+	for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+	{
+		const FVector ItemLocation = GetItemLocation(QueryInstance, It.GetIndex());
+
+		FClimbProbePose Pose;
+		Pose.Location = ItemLocation + FVector::UpVector * ProbeHeightOffset;
+		Pose.Forward = (ItemLocation - FacingLocations[0]).GetSafeNormal2D();
+
+		if (Pose.Forward.IsNearlyZero())
+		{
+			Pose.Forward = FVector::ForwardVector;
+		}
+
+		const EClimbEnvQueryVerdict Verdict = ClimbEnvQuerySubsystem->EvaluateRule(Rule, Settings, ItemLocation, Pose, RouteNodeMatchDistance);
+		const bool bPass = Verdict == EClimbEnvQueryVerdict::Pass || (Verdict == EClimbEnvQueryVerdict::Pending && bPendingItemsPass);
+
+		It.SetScore(TestPurpose, FilterType, bPass, bWantsPass);
+	}
+}
+
+FText UEnvQueryTest_ClimbRule::GetDescriptionTitle() const
+{
+	return FText::Format(LOCTEXT("ClimbRuleTitle", "Climb Rule: {0}"), ClimbEnvQuery::DescribeRule(Rule));
+}
+
+FText UEnvQueryTest_ClimbRule::GetDescriptionDetails() const
+{
+	return DescribeBoolTestParams(TEXT("satisfied"));
+}
+
+#undef LOCTEXT_NAMESPACE
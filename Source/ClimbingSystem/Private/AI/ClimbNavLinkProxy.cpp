@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/ClimbNavLinkProxy.h"
+
+#include "AI/ClimbRoutePlannerSubsystem.h"
+#include "AI/NavArea_Climb.h"
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "Navigation/NavLinkComponent.h"
+
+AClimbNavLinkProxy::AClimbNavLinkProxy(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// 기본 포인트 링크 대신 스마트 링크만 사용
+	PointLinks.Empty();
+	bSmartLinkIsRelevant = true;
+}
+
+void AClimbNavLinkProxy::InitializeClimbLink(const FVector& RelativeEnd)
+{
+	UNavLinkCustomComponent* SmartLink = GetSmartLinkComp();
+	SmartLink->SetLinkData(FVector::ZeroVector, RelativeEnd, ENavLinkDirection::BothWays);
+	SmartLink->SetEnabledArea(UNavArea_Climb::StaticClass());
+
+	SetSmartLinkEnabled(true);
+}
+
+void AClimbNavLinkProxy::BeginPlay()
+{
+	Super::BeginPlay();
+
+	OnSmartLinkReached.AddDynamic(this, &ThisClass::HandleSmartLinkReached);
+}
+
+void AClimbNavLinkProxy::HandleSmartLinkReached(AActor* MovingActor, const FVector& DestinationPoint)
+{
+	const ACharacter* Character = Cast<ACharacter>(MovingActor);
+	UCustomMovementComponent* CustomMovementComponent = Character ? Cast<UCustomMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+	UClimbRoutePlannerSubsystem* Planner = GetWorld()->GetSubsystem<UClimbRoutePlannerSubsystem>();
+
+	TArray<FClimbRouteWaypoint> Route;
+	if (!CustomMovementComponent || !Planner || !Planner->FindPath(MovingActor->GetActorLocation(), DestinationPoint, Route))
+	{
+		// 등반 경로가 없으면 링크를 일반 이동으로 통과
+		ResumePathFollowing(MovingActor);
+		return;
+	}
+
+	CustomMovementComponent->FollowClimbRoute(Route, FOnClimbRouteFinished::CreateUObject(this, &ThisClass::OnClimbRouteFinished, TWeakObjectPtr<AActor>(MovingActor)));
+}
+
+void AClimbNavLinkProxy::OnClimbRouteFinished(bool bSuccess, TWeakObjectPtr<AActor> MovingActor)
+{
+	// 실패하더라도 경로 추종을 재개해야 AI 가 멈춰 있지 않고 재계획할 수 있음
+	if (MovingActor.IsValid())
+	{
+		ResumePathFollowing(MovingActor.Get());
+	}
+}
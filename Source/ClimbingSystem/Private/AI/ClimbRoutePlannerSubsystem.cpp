@@ -0,0 +1,1066 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/ClimbRoutePlannerSubsystem.h"
+
+#include "ClimbingSystem.h"
+#include "TimerManager.h"
+#include "Algo/Reverse.h"
+#include "AI/ClimbNavLinkProxy.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
+#include "Subsystems/ClimbSurfaceSubsystem.h"
+
+namespace ClimbRoute
+{
+	static TAutoConsoleVariable<bool> CVarBuildOnBeginPlay(
+		TEXT("climb.RouteGraph.BuildOnBeginPlay"),
+		true,
+		TEXT("월드 시작 시 AI 등반 경로 그래프를 빌드할지 여부"));
+
+	static TAutoConsoleVariable<float> CVarPatchSize(
+		TEXT("climb.RouteGraph.PatchSize"),
+		100.f,
+		TEXT("등반 경로 그래프의 벽면 패치 크기 (cm)"));
+
+	static TAutoConsoleVariable<int32> CVarMaxTracesPerFrame(
+		TEXT("climb.RouteGraph.MaxTracesPerFrame"),
+		256,
+		TEXT("등반 경로 그래프 빌드가 프레임당 수행하는 트레이스 상한 (대략적)"));
+
+	static TAutoConsoleVariable<int32> CVarMaxCachedSearches(
+		TEXT("climb.RouteGraph.MaxCachedSearches"),
+		512,
+		TEXT("캐싱하는 클러스터 내부 탐색 결과 수 상한 (넘으면 캐시를 비움)"));
+
+	static constexpr int32 MaxSamplesPerAxis = 64;
+	static constexpr int32 MaxVaultSamplesPerFace = 8;
+	static constexpr float SpatialHashCellSize = 200.f;
+	static constexpr float MaxNodeSearchDistance = 300.f;
+	static constexpr float DefaultMaxClimbableSurfaceAngle = 60.f;
+
+	static constexpr float TraceDepth = 100.f;
+	static constexpr float PatchStandOff = 45.f;
+	static constexpr float HopUpReach = 250.f;
+	static constexpr float HopDownReach = 350.f;
+
+	static constexpr float LedgeProbeHeight = 100.f;
+	static constexpr float LedgeProbeDepth = 120.f;
+	static constexpr float GroundProbeOffset = 50.f;
+	static constexpr float MaxEnterHeight = 150.f;
+
+	static constexpr float MaxVaultHeight = 120.f;
+	static constexpr float MaxVaultThickness = 200.f;
+	static constexpr float VaultLandingOffset = 60.f;
+
+	static constexpr float WalkableFloorZ = 0.71f;
+
+	/** 로컬 위 축이 이만큼 위를 향하지 않는 프리미티브는 벽으로 보지 않음 (약 30도) */
+	static constexpr float MinWallUpDot = 0.87f;
+
+	/** 다른 클러스터 패치를 잇는 거리 (패치 간격 배율) 와 법선 허용치 (직각 모서리는 0) */
+	static constexpr float NeighbourLinkReachScale = 1.5f;
+	static constexpr float MinNeighbourNormalDot = -0.2f;
+
+	struct FOpenEntry
+	{
+		float Cost;
+		int32 Node;
+
+		bool operator<(const FOpenEntry& Other) const { return Cost < Other.Cost; }
+	};
+
+	static bool IsWalkableHit(const FHitResult& Hit)
+	{
+		return Hit.bBlockingHit && !Hit.bStartPenetrating && Hit.ImpactNormal.Z >= WalkableFloorZ;
+	}
+}
+
+void UClimbRoutePlannerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ClimbSurfaceSubsystem = Collection.InitializeDependency<UClimbSurfaceSubsystem>();
+}
+
+void UClimbRoutePlannerSubsystem::Deinitialize()
+{
+	ResetGraph();
+
+	Super::Deinitialize();
+}
+
+void UClimbRoutePlannerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// AI 는 서버(또는 스탠드얼론)에서만 경로를 계획
+	if (!ClimbRoute::CVarBuildOnBeginPlay.GetValueOnGameThread() || InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	// 등반 표면 서브시스템이 레벨 액터 등록을 마친 다음 프레임에 빌드
+	InWorld.GetTimerManager().SetTimerForNextTick(this, &ThisClass::OnDeferredGraphBuild);
+}
+
+void UClimbRoutePlannerSubsystem::OnDeferredGraphBuild()
+{
+	BuildGraph();
+}
+
+void UClimbRoutePlannerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bGraphBuildInProgress)
+	{
+		return;
+	}
+
+	// 면 한 행 / 면 마무리 단위로 진행하므로 상한은 대략적 (한 단위가 예산을 넘을 수 있음)
+	RemainingBuildTraces = FMath::Max(ClimbRoute::CVarMaxTracesPerFrame.GetValueOnGameThread(), 1);
+
+	while (RemainingBuildTraces > 0)
+	{
+		if (PendingFaces.IsEmpty())
+		{
+			if (PendingComponents.IsEmpty())
+			{
+				FinishGraphBuild();
+				return;
+			}
+
+			StartNextComponentBuild();
+			continue;
+		}
+
+		FSurfaceFaceBuild& Face = PendingFaces.Last();
+
+		if (!Face.Component.IsValid())
+		{
+			PendingFaces.Pop(EAllowShrinking::No);
+		}
+		else if (Face.NextRow < Face.NumRows)
+		{
+			SampleSurfaceFaceRow(Face);
+		}
+		else
+		{
+			FinishSurfaceFace(Face);
+			PendingFaces.Pop(EAllowShrinking::No);
+		}
+	}
+}
+
+TStatId UClimbRoutePlannerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UClimbRoutePlannerSubsystem, STATGROUP_Tickables);
+}
+
+/**
+ * @brief 정적 등반 표면을 샘플링해 등반 경로 그래프 빌드를 시작
+ *
+ * 프리미티브 로컬 박스의 네 측면을 PatchSize 간격 격자로 트레이스해 벽면 패치 노드를 만들고,
+ * 인접 패치는 Climb, 빈 칸을 건너는 패치는 Hop 엣지로 연결합니다.
+ * 각 열의 맨 위 / 맨 아래 패치에서 렛지 / 바닥 노드를 찾아 TopOut / Enter 엣지를 추가하며,
+ * 낮은 장애물은 양쪽 착지 지점을 Vault 엣지로 연결합니다.
+ *
+ * @note 트레이스는 Tick 에서 climb.RouteGraph.MaxTracesPerFrame 만큼씩 나눠 수행되며, 끝난 뒤의 경로 탐색은 그래프만 사용합니다.
+ */
+void UClimbRoutePlannerSubsystem::BuildGraph()
+{
+	ResetGraph();
+
+	if (!GetWorld() || !ClimbSurfaceSubsystem)
+	{
+		return;
+	}
+
+	BuildStartTime = FPlatformTime::Seconds();
+
+	// 빌드 중 표면 조회가 캐시에 새 항목을 추가할 수 있으므로 순회 대상을 먼저 복사
+	ClimbSurfaceSubsystem->ForEachRegisteredComponent([this](const UPrimitiveComponent* Component, const FClimbSurfaceProperties& SurfaceProperties)
+	{
+		if (!SurfaceProperties.bClimbable || Component->Mobility != EComponentMobility::Static)
+		{
+			return;
+		}
+
+		// 등반 프록시가 대신하는 아트 콜리전처럼 Climb 채널에 응답하지 않는 컴포넌트는 제외
+		if (Component->GetCollisionResponseToChannel(ECC_Climb) != ECR_Block)
+		{
+			return;
+		}
+
+		// 벽이 아닌 프리미티브 (지형, 눕혀 놓은 메시) 는 측면 격자가 바닥을 훑으므로 제외
+		if (Component->IsA<ULandscapeHeightfieldCollisionComponent>()
+			|| Component->GetComponentTransform().GetUnitAxis(EAxis::Z).Z < ClimbRoute::MinWallUpDot)
+		{
+			return;
+		}
+
+		PendingComponents.Emplace(Component, SurfaceProperties);
+	});
+
+	bGraphBuildInProgress = true;
+}
+
+bool UClimbRoutePlannerSubsystem::FindPath(const FVector& StartLocation, const FVector& GoalLocation, TArray<FClimbRouteWaypoint>& OutPath)
+{
+	OutPath.Reset();
+
+	if (!bGraphBuilt)
+	{
+		return false;
+	}
+
+	const int32 StartNode = FindNearestNode(StartLocation, ClimbRoute::MaxNodeSearchDistance);
+	const int32 GoalNode = FindNearestNode(GoalLocation, ClimbRoute::MaxNodeSearchDistance);
+
+	if (StartNode == INDEX_NONE || GoalNode == INDEX_NONE)
+	{
+		return false;
+	}
+
+	TArray<int32> AbstractPath;
+	TArray<int32> NodePath;
+
+	if (!FindAbstractPath(StartNode, GoalNode, AbstractPath) || !RefinePath(AbstractPath, NodePath))
+	{
+		return false;
+	}
+
+	// 시작 노드는 이미 서 있는 위치이므로 제외
+	for (int32 PathIndex = 1; PathIndex < NodePath.Num(); ++PathIndex)
+	{
+		const FClimbRouteEdge* Edge = FindEdge(NodePath[PathIndex - 1], NodePath[PathIndex]);
+		const FClimbRouteNode& Node = Nodes[NodePath[PathIndex]];
+
+		FClimbRouteWaypoint& Waypoint = OutPath.AddDefaulted_GetRef();
+		Waypoint.Location = Node.Location;
+		Waypoint.SurfaceNormal = Node.Normal;
+		Waypoint.ArrivalEdge = Edge ? Edge->Type : EClimbRouteEdgeType::Climb;
+	}
+
+	return true;
+}
+
+int32 UClimbRoutePlannerSubsystem::FindNearestNode(const FVector& Location, float MaxDistance) const
+{
+	const FIntVector CenterCell = GetSpatialHashCell(Location);
+	const int32 CellRadius = FMath::CeilToInt32(MaxDistance / ClimbRoute::SpatialHashCellSize);
+
+	int32 NearestNode = INDEX_NONE;
+	float NearestDistanceSquared = FMath::Square(MaxDistance);
+
+	for (int32 X = -CellRadius; X <= CellRadius; ++X)
+	{
+		for (int32 Y = -CellRadius; Y <= CellRadius; ++Y)
+		{
+			for (int32 Z = -CellRadius; Z <= CellRadius; ++Z)
+			{
+				const TArray<int32>* CellNodes = SpatialHash.Find(CenterCell + FIntVector(X, Y, Z));
+				if (!CellNodes)
+				{
+					continue;
+				}
+
+				for (const int32 NodeIndex : *CellNodes)
+				{
+					const float DistanceSquared = FVector::DistSquared(Nodes[NodeIndex].Location, Location);
+					if (DistanceSquared < NearestDistanceSquared)
+					{
+						NearestDistanceSquared = DistanceSquared;
+						NearestNode = NodeIndex;
+					}
+				}
+			}
+		}
+	}
+
+	return NearestNode;
+}
+
+void UClimbRoutePlannerSubsystem::GatherNodesInRadius(const FVector& Location, float Radius, TArray<int32>& OutNodeIndices) const
+{
+	const FIntVector CenterCell = GetSpatialHashCell(Location);
+	const int32 CellRadius = FMath::CeilToInt32(Radius / ClimbRoute::SpatialHashCellSize);
+	const float RadiusSquared = FMath::Square(Radius);
+
+	for (int32 X = -CellRadius; X <= CellRadius; ++X)
+	{
+		for (int32 Y = -CellRadius; Y <= CellRadius; ++Y)
+		{
+			for (int32 Z = -CellRadius; Z <= CellRadius; ++Z)
+			{
+				const TArray<int32>* CellNodes = SpatialHash.Find(CenterCell + FIntVector(X, Y, Z));
+				if (!CellNodes)
+				{
+					continue;
+				}
+
+				for (const int32 NodeIndex : *CellNodes)
+				{
+					if (FVector::DistSquared(Nodes[NodeIndex].Location, Location) <= RadiusSquared)
+					{
+						OutNodeIndices.Add(NodeIndex);
+					}
+				}
+			}
+		}
+	}
+}
+
+#pragma region Graph Build
+
+void UClimbRoutePlannerSubsystem::ResetGraph()
+{
+	for (const TWeakObjectPtr<AClimbNavLinkProxy>& NavLink : SpawnedNavLinks)
+	{
+		if (NavLink.IsValid())
+		{
+			NavLink->Destroy();
+		}
+	}
+
+	Nodes.Reset();
+	SpatialHash.Reset();
+	ClusterEntrances.Reset();
+	LocalSearchCache.Reset();
+	NavLinkCandidates.Reset();
+	SpawnedNavLinks.Reset();
+	PendingComponents.Reset();
+	PendingFaces.Reset();
+	NumClusters = 0;
+	bGraphBuilt = false;
+	bGraphBuildInProgress = false;
+}
+
+/**
+ * @brief 다음 프리미티브를 꺼내 낮은 장애물이면 볼팅 노드를, 아니면 측면 네 개를 샘플링 대기열에 추가
+ *
+ * 측면은 컴포넌트 로컬 박스 기준이므로 월드 축에 정렬되지 않은 벽도 면 그대로 샘플링됩니다.
+ */
+void UClimbRoutePlannerSubsystem::StartNextComponentBuild()
+{
+	const TPair<TWeakObjectPtr<const UPrimitiveComponent>, FClimbSurfaceProperties> Pending = PendingComponents.Pop(EAllowShrinking::No);
+
+	const UPrimitiveComponent* Component = Pending.Key.Get();
+	if (!Component)
+	{
+		return;
+	}
+
+	const FTransform& ComponentTransform = Component->GetComponentTransform();
+	const FBox LocalBox = Component->CalcBounds(FTransform::Identity).GetBox();
+
+	if (ComponentTransform.TransformVector(FVector(0.f, 0.f, LocalBox.GetSize().Z)).Size() <= ClimbRoute::MaxVaultHeight)
+	{
+		BuildVaultNodes(Component, ComponentTransform, LocalBox);
+		return;
+	}
+
+	for (const FVector& LocalFaceDirection : { FVector::ForwardVector, FVector::BackwardVector, FVector::RightVector, FVector::LeftVector })
+	{
+		AddSurfaceFace(Component, Pending.Value, ComponentTransform, LocalBox, LocalFaceDirection);
+	}
+}
+
+void UClimbRoutePlannerSubsystem::AddSurfaceFace(const UPrimitiveComponent* Component, const FClimbSurfaceProperties& SurfaceProperties, const FTransform& ComponentTransform, const FBox& LocalBox, const FVector& LocalFaceDirection)
+{
+	const float PatchSize = FMath::Max(ClimbRoute::CVarPatchSize.GetValueOnGameThread(), 25.f);
+	const FVector LocalExtent = LocalBox.GetExtent();
+
+	// 면을 따라가는 수평 축과 면 방향으로의 두께 (스케일을 반영한 월드 길이)
+	const FVector LocalTangent = FVector::CrossProduct(FVector::UpVector, LocalFaceDirection);
+	const FVector HalfWidth = ComponentTransform.TransformVector(LocalTangent * FMath::Abs(FVector::DotProduct(LocalExtent, LocalTangent)));
+	const FVector HalfHeight = ComponentTransform.TransformVector(FVector::UpVector * LocalExtent.Z);
+
+	FSurfaceFaceBuild& Face = PendingFaces.AddDefaulted_GetRef();
+	Face.Component = Component;
+	Face.SurfaceProperties = SurfaceProperties;
+	Face.FaceDirection = ComponentTransform.TransformVectorNoScale(LocalFaceDirection);
+	Face.Depth = ComponentTransform.TransformVector(LocalFaceDirection * FMath::Abs(FVector::DotProduct(LocalExtent, LocalFaceDirection))).Size();
+	Face.NumColumns = FMath::Clamp(FMath::CeilToInt32(HalfWidth.Size() * 2.f / PatchSize), 1, ClimbRoute::MaxSamplesPerAxis);
+	Face.NumRows = FMath::Clamp(FMath::CeilToInt32(HalfHeight.Size() * 2.f / PatchSize), 1, ClimbRoute::MaxSamplesPerAxis);
+	Face.ColumnStep = HalfWidth * 2.f / Face.NumColumns;
+	Face.RowStep = HalfHeight * 2.f / Face.NumRows;
+	Face.Origin = ComponentTransform.TransformPosition(LocalBox.GetCenter()) - HalfWidth - HalfHeight + (Face.ColumnStep + Face.RowStep) * 0.5f;
+	Face.ClusterId = NumClusters++;
+	Face.Grid.Init(INDEX_NONE, Face.NumColumns * Face.NumRows);
+}
+
+/** 면 바깥에서 안쪽으로 한 행을 트레이스해 등반 가능한 패치를 샘플링 */
+void UClimbRoutePlannerSubsystem::SampleSurfaceFaceRow(FSurfaceFaceBuild& Face)
+{
+	const int32 Row = Face.NextRow++;
+
+	for (int32 Column = 0; Column < Face.NumColumns; ++Column)
+	{
+		const FVector SamplePoint = Face.Origin + Face.ColumnStep * Column + Face.RowStep * Row;
+		const FVector Start = SamplePoint + Face.FaceDirection * (Face.Depth + ClimbRoute::TraceDepth);
+		const FVector End = SamplePoint - Face.FaceDirection * Face.Depth;
+
+		FHitResult Hit;
+		if (!TraceGraphBuild(Hit, Start, End) || Hit.GetComponent() != Face.Component.Get())
+		{
+			continue;
+		}
+
+		if (FVector::DotProduct(Hit.ImpactNormal, Face.FaceDirection) < 0.5f)
+		{
+			continue;
+		}
+
+		// CheckShouldStopClimbing 과 같은 규칙: 너무 평평한 면은 등반 불가
+		const float SurfaceAngle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(Hit.ImpactNormal, FVector::UpVector)));
+		if (SurfaceAngle <= Face.SurfaceProperties.GetMaxClimbableSurfaceAngle(ClimbRoute::DefaultMaxClimbableSurfaceAngle))
+		{
+			continue;
+		}
+
+		Face.Grid[Row * Face.NumColumns + Column] = AddNode(Hit.ImpactPoint + Hit.ImpactNormal * ClimbRoute::PatchStandOff, Hit.ImpactNormal, EClimbRouteNodeType::SurfacePatch, Face.ClusterId);
+	}
+}
+
+/**
+ * @brief 샘플링이 끝난 면의 패치를 연결
+ *
+ * 인접 패치는 Climb, 빈 칸을 건너는 패치는 Hop 으로 잇고, 열마다 렛지 / 바닥 노드를 찾은 뒤
+ * 이미 빌드된 다른 면 / 프리미티브의 패치 중 손이 닿는 것과 잇습니다.
+ */
+void UClimbRoutePlannerSubsystem::FinishSurfaceFace(const FSurfaceFaceBuild& Face)
+{
+	const int32 NumColumns = Face.NumColumns;
+	const int32 NumRows = Face.NumRows;
+	const float RowStep = Face.RowStep.Size();
+
+	auto GridAt = [&Face, NumColumns](int32 Column, int32 Row)
+	{
+		return Face.Grid[Row * NumColumns + Column];
+	};
+
+	// 1. 인접 패치는 Climb, 빈 칸을 건너는 패치는 Hop 으로 연결
+	const int32 HopUpRows = FMath::FloorToInt32(ClimbRoute::HopUpReach / RowStep);
+	const int32 HopDownRows = FMath::FloorToInt32(ClimbRoute::HopDownReach / RowStep);
+
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		for (int32 Column = 0; Column < NumColumns; ++Column)
+		{
+			const int32 Node = GridAt(Column, Row);
+			if (Node == INDEX_NONE)
+			{
+				continue;
+			}
+
+			if (Column + 1 < NumColumns && GridAt(Column + 1, Row) != INDEX_NONE)
+			{
+				AddEdge(Node, GridAt(Column + 1, Row), EClimbRouteEdgeType::Climb);
+				AddEdge(GridAt(Column + 1, Row), Node, EClimbRouteEdgeType::Climb);
+			}
+
+			if (Row + 1 >= NumRows)
+			{
+				continue;
+			}
+
+			if (GridAt(Column, Row + 1) != INDEX_NONE)
+			{
+				AddEdge(Node, GridAt(Column, Row + 1), EClimbRouteEdgeType::Climb);
+				AddEdge(GridAt(Column, Row + 1), Node, EClimbRouteEdgeType::Climb);
+				continue;
+			}
+
+			for (int32 Gap = 2; Gap <= HopUpRows && Row + Gap < NumRows; ++Gap)
+			{
+				const int32 HopTarget = GridAt(Column, Row + Gap);
+				if (HopTarget == INDEX_NONE)
+				{
+					continue;
+				}
+
+				AddEdge(Node, HopTarget, EClimbRouteEdgeType::HopUp);
+
+				if (Gap <= HopDownRows)
+				{
+					AddEdge(HopTarget, Node, EClimbRouteEdgeType::HopDown);
+				}
+				break;
+			}
+		}
+	}
+
+	// 2. 열마다 맨 위 패치에서 렛지, 맨 아래 패치에서 바닥을 찾아 연결
+	int32 NavLinkGround = INDEX_NONE;
+	int32 NavLinkLedge = INDEX_NONE;
+	int32 BestColumnDistance = MAX_int32;
+
+	for (int32 Column = 0; Column < NumColumns; ++Column)
+	{
+		int32 BottomNode = INDEX_NONE;
+		int32 TopNode = INDEX_NONE;
+
+		for (int32 Row = 0; Row < NumRows; ++Row)
+		{
+			if (GridAt(Column, Row) != INDEX_NONE)
+			{
+				BottomNode = BottomNode == INDEX_NONE ? GridAt(Column, Row) : BottomNode;
+				TopNode = GridAt(Column, Row);
+			}
+		}
+
+		if (TopNode == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const int32 LedgeNode = TryAddLedgeNode(TopNode, RowStep);
+		const int32 GroundNode = TryAddGroundNode(BottomNode);
+
+		// 내비 링크는 면 중앙에 가장 가까운, 바닥과 렛지가 모두 있는 열 하나만 사용
+		const int32 ColumnDistance = FMath::Abs(Column - NumColumns / 2);
+		if (LedgeNode != INDEX_NONE && GroundNode != INDEX_NONE && ColumnDistance < BestColumnDistance)
+		{
+			BestColumnDistance = ColumnDistance;
+			NavLinkGround = GroundNode;
+			NavLinkLedge = LedgeNode;
+		}
+	}
+
+	if (NavLinkGround != INDEX_NONE)
+	{
+		NavLinkCandidates.Emplace(NavLinkGround, NavLinkLedge);
+	}
+
+	// 3. 이웃 프리미티브 (모듈식 벽 조각) / 같은 프리미티브의 옆면 (바깥 모서리) 패치와 연결
+	const float LinkReach = FMath::Max(Face.ColumnStep.Size(), RowStep) * ClimbRoute::NeighbourLinkReachScale;
+
+	for (const int32 Node : Face.Grid)
+	{
+		if (Node != INDEX_NONE)
+		{
+			LinkNeighbourPatches(Node, LinkReach);
+		}
+	}
+}
+
+/**
+ * @brief 다른 클러스터의 가까운 벽면 패치와 Climb 엣지로 연결
+ *
+ * 같은 평면이거나 모서리로 꺾이는 패치만 잇고, 서로 마주 보는 면 (벽 양쪽) 은 잇지 않습니다.
+ * 두 패치 사이를 두 법선 쪽으로 밀어 낸 중간점을 거쳐 트레이스해 모서리를 돌아가는 길이 막혀 있지 않은지 확인합니다.
+ */
+void UClimbRoutePlannerSubsystem::LinkNeighbourPatches(int32 NodeIndex, float LinkReach)
+{
+	const FVector Location = Nodes[NodeIndex].Location;
+	const FVector Normal = Nodes[NodeIndex].Normal;
+	const int32 ClusterId = Nodes[NodeIndex].ClusterId;
+
+	TArray<int32> NearbyNodes;
+	GatherNodesInRadius(Location, LinkReach, NearbyNodes);
+
+	for (const int32 OtherIndex : NearbyNodes)
+	{
+		const FClimbRouteNode& Other = Nodes[OtherIndex];
+
+		if (Other.Type != EClimbRouteNodeType::SurfacePatch || Other.ClusterId == ClusterId || FindEdge(NodeIndex, OtherIndex))
+		{
+			continue;
+		}
+
+		if (FVector::DotProduct(Normal, Other.Normal) < ClimbRoute::MinNeighbourNormalDot)
+		{
+			continue;
+		}
+
+		const FVector OtherLocation = Other.Location;
+		const FVector Midpoint = (Location + OtherLocation) * 0.5f + (Normal + Other.Normal).GetSafeNormal() * ClimbRoute::PatchStandOff;
+
+		FHitResult Hit;
+		if (TraceGraphBuild(Hit, Location, Midpoint) || TraceGraphBuild(Hit, Midpoint, OtherLocation))
+		{
+			continue;
+		}
+
+		AddEdge(NodeIndex, OtherIndex, EClimbRouteEdgeType::Climb);
+		AddEdge(OtherIndex, NodeIndex, EClimbRouteEdgeType::Climb);
+	}
+}
+
+void UClimbRoutePlannerSubsystem::BuildVaultNodes(const UPrimitiveComponent* Component, const FTransform& ComponentTransform, const FBox& LocalBox)
+{
+	const float PatchSize = FMath::Max(ClimbRoute::CVarPatchSize.GetValueOnGameThread(), 25.f);
+	const FBox Bounds = Component->Bounds.GetBox();
+	const FVector Center = ComponentTransform.TransformPosition(LocalBox.GetCenter());
+	const FVector LocalExtent = LocalBox.GetExtent();
+
+	for (const FVector& LocalFaceDirection : { FVector::ForwardVector, FVector::RightVector })
+	{
+		const FVector LocalTangent = FVector::CrossProduct(FVector::UpVector, LocalFaceDirection);
+		const FVector HalfWidth = ComponentTransform.TransformVector(LocalTangent * FMath::Abs(FVector::DotProduct(LocalExtent, LocalTangent)));
+		const FVector HalfDepth = ComponentTransform.TransformVector(LocalFaceDirection * FMath::Abs(FVector::DotProduct(LocalExtent, LocalFaceDirection)));
+
+		if (HalfDepth.Size() * 2.f > ClimbRoute::MaxVaultThickness)
+		{
+			continue;
+		}
+
+		const int32 NumSamples = FMath::Clamp(FMath::CeilToInt32(HalfWidth.Size() * 2.f / PatchSize), 1, ClimbRoute::MaxVaultSamplesPerFace);
+		const FVector SampleStep = HalfWidth * 2.f / NumSamples;
+		const FVector SideOffset = HalfDepth + HalfDepth.GetSafeNormal() * ClimbRoute::VaultLandingOffset;
+
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			const FVector SamplePoint = Center - HalfWidth + SampleStep * (Sample + 0.5f);
+
+			FVector FrontLanding;
+			FVector BackLanding;
+
+			if (!FindVaultLanding(Component, SamplePoint + SideOffset, Bounds, FrontLanding)
+				|| !FindVaultLanding(Component, SamplePoint - SideOffset, Bounds, BackLanding))
+			{
+				continue;
+			}
+
+			const int32 FrontNode = AddNode(FrontLanding, FVector::UpVector, EClimbRouteNodeType::VaultPoint, NumClusters++);
+			const int32 BackNode = AddNode(BackLanding, FVector::UpVector, EClimbRouteNodeType::VaultPoint, NumClusters++);
+
+			AddEdge(FrontNode, BackNode, EClimbRouteEdgeType::Vault);
+			AddEdge(BackNode, FrontNode, EClimbRouteEdgeType::Vault);
+
+			if (Sample == NumSamples / 2)
+			{
+				NavLinkCandidates.Emplace(FrontNode, BackNode);
+			}
+		}
+	}
+}
+
+/**
+ * @brief 볼팅 장애물 옆의 착지 지점을 찾음
+ *
+ * 장애물 위에서 아래로 트레이스하여 장애물이 아닌 걸을 수 있는 바닥이 있고,
+ * 그 바닥에서 장애물 꼭대기까지의 높이가 MaxVaultHeight 이하인 경우만 유효합니다.
+ */
+bool UClimbRoutePlannerSubsystem::FindVaultLanding(const UPrimitiveComponent* Obstacle, const FVector& Point, const FBox& Bounds, FVector& OutLocation)
+{
+	const FVector Start(Point.X, Point.Y, Bounds.Max.Z + 50.f);
+	const FVector End(Point.X, Point.Y, Bounds.Min.Z - 100.f);
+
+	FHitResult Hit;
+	if (!TraceGraphBuild(Hit, Start, End) || !ClimbRoute::IsWalkableHit(Hit) || Hit.GetComponent() == Obstacle)
+	{
+		return false;
+	}
+
+	if (Bounds.Max.Z - Hit.ImpactPoint.Z > ClimbRoute::MaxVaultHeight)
+	{
+		return false;
+	}
+
+	OutLocation = Hit.ImpactPoint;
+	return true;
+}
+
+int32 UClimbRoutePlannerSubsystem::TryAddLedgeNode(int32 PatchNodeIndex, float RowHeight)
+{
+	const FVector PatchLocation = Nodes[PatchNodeIndex].Location;
+	const FVector PatchNormal = Nodes[PatchNodeIndex].Normal;
+
+	// 벽 위쪽, 벽 안쪽으로 들어간 지점에서 아래로 트레이스해 올라설 바닥을 찾음
+	const FVector Start = PatchLocation
+		+ FVector::UpVector * (RowHeight + ClimbRoute::LedgeProbeHeight)
+		- PatchNormal * (ClimbRoute::PatchStandOff + ClimbRoute::LedgeProbeDepth);
+	const FVector End = Start - FVector::UpVector * (RowHeight + ClimbRoute::LedgeProbeHeight * 2.f);
+
+	FHitResult Hit;
+	if (!TraceGraphBuild(Hit, Start, End) || !ClimbRoute::IsWalkableHit(Hit))
+	{
+		return INDEX_NONE;
+	}
+
+	if (Hit.ImpactPoint.Z < PatchLocation.Z || !ClimbSurfaceSubsystem->GetSurfaceProperties(Hit).bLedgeCapable)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 LedgeNode = AddNode(Hit.ImpactPoint, Hit.ImpactNormal, EClimbRouteNodeType::Ledge, NumClusters++);
+	AddEdge(PatchNodeIndex, LedgeNode, EClimbRouteEdgeType::TopOut);
+	AddEdge(LedgeNode, PatchNodeIndex, EClimbRouteEdgeType::ClimbDown);
+
+	return LedgeNode;
+}
+
+int32 UClimbRoutePlannerSubsystem::TryAddGroundNode(int32 PatchNodeIndex)
+{
+	const FVector PatchLocation = Nodes[PatchNodeIndex].Location;
+	const FVector PatchNormal = Nodes[PatchNodeIndex].Normal;
+
+	const FVector Start = PatchLocation + PatchNormal * ClimbRoute::GroundProbeOffset;
+	const FVector End = Start - FVector::UpVector * (ClimbRoute::MaxEnterHeight + 100.f);
+
+	FHitResult Hit;
+	if (!TraceGraphBuild(Hit, Start, End) || !ClimbRoute::IsWalkableHit(Hit))
+	{
+		return INDEX_NONE;
+	}
+
+	if (PatchLocation.Z - Hit.ImpactPoint.Z > ClimbRoute::MaxEnterHeight)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 GroundNode = AddNode(Hit.ImpactPoint, Hit.ImpactNormal, EClimbRouteNodeType::Ground, NumClusters++);
+	AddEdge(GroundNode, PatchNodeIndex, EClimbRouteEdgeType::Enter);
+	AddEdge(PatchNodeIndex, GroundNode, EClimbRouteEdgeType::Drop);
+
+	return GroundNode;
+}
+
+void UClimbRoutePlannerSubsystem::FinishGraphBuild()
+{
+	bGraphBuildInProgress = false;
+
+	RecalculateEdgeCosts();
+	BuildClusterEntrances();
+	EmitNavLinks();
+
+	bGraphBuilt = true;
+
+	UE_LOG(LogClimbingSystem, Log, TEXT("Climb route graph built: %d nodes, %d clusters, %d nav links (%.2f ms)"),
+		Nodes.Num(), NumClusters, SpawnedNavLinks.Num(), (FPlatformTime::Seconds() - BuildStartTime) * 1000.0);
+}
+
+bool UClimbRoutePlannerSubsystem::TraceGraphBuild(FHitResult& OutHit, const FVector& Start, const FVector& End)
+{
+	--RemainingBuildTraces;
+
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbRouteGraphBuild), false);
+	return GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, ECC_Climb, QueryParams);
+}
+
+int32 UClimbRoutePlannerSubsystem::AddNode(const FVector& Location, const FVector& Normal, EClimbRouteNodeType Type, int32 ClusterId)
+{
+	FClimbRouteNode& Node = Nodes.AddDefaulted_GetRef();
+	Node.Location = Location;
+	Node.Normal = Normal;
+	Node.Type = Type;
+	Node.ClusterId = ClusterId;
+
+	// 빌드 중에도 이웃 패치 연결에 쓰므로 바로 공간 해시에 넣음
+	SpatialHash.FindOrAdd(GetSpatialHashCell(Location)).Add(Nodes.Num() - 1);
+
+	return Nodes.Num() - 1;
+}
+
+void UClimbRoutePlannerSubsystem::AddEdge(int32 FromNode, int32 ToNode, EClimbRouteEdgeType Type)
+{
+	FClimbRouteEdge& Edge = Nodes[FromNode].Edges.AddDefaulted_GetRef();
+	Edge.ToNode = ToNode;
+	Edge.Type = Type;
+}
+
+void UClimbRoutePlannerSubsystem::RecalculateEdgeCosts()
+{
+	MaxTraversalSpeed = FMath::Max(CostSettings.MaxClimbSpeed, 1.f);
+
+	for (FClimbRouteNode& Node : Nodes)
+	{
+		for (FClimbRouteEdge& Edge : Node.Edges)
+		{
+			Edge.Cost = GetEdgeCost(Edge.Type, Node.Location, Nodes[Edge.ToNode].Location);
+
+			if (Edge.Cost > KINDA_SMALL_NUMBER)
+			{
+				MaxTraversalSpeed = FMath::Max(MaxTraversalSpeed, FVector::Dist(Node.Location, Nodes[Edge.ToNode].Location) / Edge.Cost);
+			}
+		}
+	}
+
+	// 비용이 바뀌었으므로 캐싱된 클러스터 내부 탐색 결과는 무효
+	LocalSearchCache.Reset();
+}
+
+void UClimbRoutePlannerSubsystem::BuildClusterEntrances()
+{
+	ClusterEntrances.Reset();
+	ClusterEntrances.SetNum(NumClusters);
+
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		for (const FClimbRouteEdge& Edge : Nodes[NodeIndex].Edges)
+		{
+			if (Nodes[Edge.ToNode].ClusterId == Nodes[NodeIndex].ClusterId)
+			{
+				continue;
+			}
+
+			ClusterEntrances[Nodes[NodeIndex].ClusterId].AddUnique(NodeIndex);
+			ClusterEntrances[Nodes[Edge.ToNode].ClusterId].AddUnique(Edge.ToNode);
+		}
+	}
+}
+
+float UClimbRoutePlannerSubsystem::GetEdgeCost(EClimbRouteEdgeType Type, const FVector& From, const FVector& To) const
+{
+	switch (Type)
+	{
+	case EClimbRouteEdgeType::Climb:		return FVector::Dist(From, To) / FMath::Max(CostSettings.MaxClimbSpeed, 1.f);
+	case EClimbRouteEdgeType::Enter:		return CostSettings.EnterDuration;
+	case EClimbRouteEdgeType::Drop:			return CostSettings.DropDuration;
+	case EClimbRouteEdgeType::HopUp:		return CostSettings.HopUpDuration;
+	case EClimbRouteEdgeType::HopDown:		return CostSettings.HopDownDuration;
+	case EClimbRouteEdgeType::TopOut:		return CostSettings.TopOutDuration;
+	case EClimbRouteEdgeType::ClimbDown:	return CostSettings.ClimbDownDuration;
+	case EClimbRouteEdgeType::Vault:		return CostSettings.VaultDuration;
+	}
+
+	return 0.f;
+}
+
+void UClimbRoutePlannerSubsystem::EmitNavLinks()
+{
+	UWorld* World = GetWorld();
+
+	for (const TPair<int32, int32>& Candidate : NavLinkCandidates)
+	{
+		const FVector LinkStart = Nodes[Candidate.Key].Location;
+		const FVector LinkEnd = Nodes[Candidate.Value].Location;
+
+		AClimbNavLinkProxy* NavLink = World->SpawnActorDeferred<AClimbNavLinkProxy>(AClimbNavLinkProxy::StaticClass(), FTransform(LinkStart));
+		if (!NavLink)
+		{
+			continue;
+		}
+
+		NavLink->InitializeClimbLink(LinkEnd - LinkStart);
+		NavLink->FinishSpawning(FTransform(LinkStart));
+
+		SpawnedNavLinks.Add(NavLink);
+	}
+}
+
+#pragma endregion
+
+#pragma region Search
+
+/**
+ * @brief 같은 클러스터 안에서 SourceNode 로부터의 최단 거리(Dijkstra)를 구하고 캐싱
+ *
+ * 계층 A* 에서 클러스터 내부 이동 비용과 경로 세그먼트 재구성에 모두 사용됩니다.
+ */
+const UClimbRoutePlannerSubsystem::FClimbLocalSearch& UClimbRoutePlannerSubsystem::GetLocalSearch(int32 SourceNode)
+{
+	if (const FClimbLocalSearch* CachedSearch = LocalSearchCache.Find(SourceNode))
+	{
+		return *CachedSearch;
+	}
+
+	// 시작 노드마다 결과가 쌓이므로 상한을 넘으면 비움 (호출자는 다음 GetLocalSearch 전까지만 참조를 씀)
+	if (LocalSearchCache.Num() >= FMath::Max(ClimbRoute::CVarMaxCachedSearches.GetValueOnGameThread(), 1))
+	{
+		LocalSearchCache.Reset();
+	}
+
+	FClimbLocalSearch& Search = LocalSearchCache.Add(SourceNode);
+	const int32 ClusterId = Nodes[SourceNode].ClusterId;
+
+	TArray<ClimbRoute::FOpenEntry> OpenSet;
+	OpenSet.HeapPush({ 0.f, SourceNode });
+	Search.Costs.Add(SourceNode, 0.f);
+
+	while (!OpenSet.IsEmpty())
+	{
+		ClimbRoute::FOpenEntry Current;
+		OpenSet.HeapPop(Current, EAllowShrinking::No);
+
+		if (Current.Cost > Search.Costs.FindChecked(Current.Node))
+		{
+			continue;
+		}
+
+		for (const FClimbRouteEdge& Edge : Nodes[Current.Node].Edges)
+		{
+			if (Nodes[Edge.ToNode].ClusterId != ClusterId)
+			{
+				continue;
+			}
+
+			const float NewCost = Current.Cost + Edge.Cost;
+			const float* KnownCost = Search.Costs.Find(Edge.ToNode);
+
+			if (!KnownCost || NewCost < *KnownCost)
+			{
+				Search.Costs.Add(Edge.ToNode, NewCost);
+				Search.Parents.Add(Edge.ToNode, Current.Node);
+				OpenSet.HeapPush({ NewCost, Edge.ToNode });
+			}
+		}
+	}
+
+	return Search;
+}
+
+/**
+ * @brief 클러스터 입구 노드로 이루어진 추상 그래프 위에서 A* 탐색
+ *
+ * 노드에서 나가는 엣지 중 다른 클러스터로 가는 엣지는 그대로 사용하고,
+ * 같은 클러스터 안의 이동은 캐싱된 Dijkstra 결과로 입구(또는 목표) 노드까지 한 번에 건너뜁니다.
+ */
+bool UClimbRoutePlannerSubsystem::FindAbstractPath(int32 StartNode, int32 GoalNode, TArray<int32>& OutAbstractPath)
+{
+	OutAbstractPath.Reset();
+
+	TMap<int32, float> CostSoFar;
+	TMap<int32, int32> CameFrom;
+	TSet<int32> ClosedSet;
+	TArray<ClimbRoute::FOpenEntry> OpenSet;
+
+	CostSoFar.Add(StartNode, 0.f);
+	OpenSet.HeapPush({ GetHeuristic(StartNode, GoalNode), StartNode });
+
+	while (!OpenSet.IsEmpty())
+	{
+		ClimbRoute::FOpenEntry Current;
+		OpenSet.HeapPop(Current, EAllowShrinking::No);
+
+		if (ClosedSet.Contains(Current.Node))
+		{
+			continue;
+		}
+
+		ClosedSet.Add(Current.Node);
+
+		if (Current.Node == GoalNode)
+		{
+			for (int32 Node = GoalNode; Node != StartNode; Node = CameFrom.FindChecked(Node))
+			{
+				OutAbstractPath.Add(Node);
+			}
+
+			OutAbstractPath.Add(StartNode);
+			Algo::Reverse(OutAbstractPath);
+			return true;
+		}
+
+		const float CurrentCost = CostSoFar.FindChecked(Current.Node);
+
+		auto Relax = [&](int32 NextNode, float StepCost)
+		{
+			const float NewCost = CurrentCost + StepCost;
+			const float* KnownCost = CostSoFar.Find(NextNode);
+
+			if (!KnownCost || NewCost < *KnownCost)
+			{
+				CostSoFar.Add(NextNode, NewCost);
+				CameFrom.Add(NextNode, Current.Node);
+				OpenSet.HeapPush({ NewCost + GetHeuristic(NextNode, GoalNode), NextNode });
+			}
+		};
+
+		const int32 ClusterId = Nodes[Current.Node].ClusterId;
+
+		// 1. 다른 클러스터로 나가는 엣지
+		for (const FClimbRouteEdge& Edge : Nodes[Current.Node].Edges)
+		{
+			if (Nodes[Edge.ToNode].ClusterId != ClusterId)
+			{
+				Relax(Edge.ToNode, Edge.Cost);
+			}
+		}
+
+		// 2. 같은 클러스터 내부 이동 (캐싱된 세그먼트 비용)
+		const FClimbLocalSearch& LocalSearch = GetLocalSearch(Current.Node);
+
+		for (const int32 Entrance : ClusterEntrances[ClusterId])
+		{
+			const float* LocalCost = LocalSearch.Costs.Find(Entrance);
+			if (Entrance != Current.Node && LocalCost)
+			{
+				Relax(Entrance, *LocalCost);
+			}
+		}
+
+		if (Nodes[GoalNode].ClusterId == ClusterId && GoalNode != Current.Node)
+		{
+			if (const float* GoalCost = LocalSearch.Costs.Find(GoalNode))
+			{
+				Relax(GoalNode, *GoalCost);
+			}
+		}
+	}
+
+	return false;
+}
+
+bool UClimbRoutePlannerSubsystem::RefinePath(const TArray<int32>& AbstractPath, TArray<int32>& OutNodePath)
+{
+	OutNodePath.Reset();
+
+	if (AbstractPath.IsEmpty())
+	{
+		return false;
+	}
+
+	OutNodePath.Add(AbstractPath[0]);
+
+	for (int32 PathIndex = 1; PathIndex < AbstractPath.Num(); ++PathIndex)
+	{
+		const int32 FromNode = AbstractPath[PathIndex - 1];
+		const int32 ToNode = AbstractPath[PathIndex];
+
+		if (Nodes[FromNode].ClusterId != Nodes[ToNode].ClusterId)
+		{
+			OutNodePath.Add(ToNode);
+			continue;
+		}
+
+		// 같은 클러스터: 캐싱된 Dijkstra 부모 정보로 세그먼트를 복원
+		const FClimbLocalSearch& LocalSearch = GetLocalSearch(FromNode);
+		TArray<int32> Segment;
+
+		for (int32 Node = ToNode; Node != FromNode;)
+		{
+			Segment.Add(Node);
+
+			const int32* Parent = LocalSearch.Parents.Find(Node);
+			if (!Parent)
+			{
+				return false;
+			}
+
+			Node = *Parent;
+		}
+
+		Algo::Reverse(Segment);
+		OutNodePath.Append(Segment);
+	}
+
+	return true;
+}
+
+const FClimbRouteEdge* UClimbRoutePlannerSubsystem::FindEdge(int32 FromNode, int32 ToNode) const
+{
+	return Nodes[FromNode].Edges.FindByPredicate([ToNode](const FClimbRouteEdge& Edge)
+	{
+		return Edge.ToNode == ToNode;
+	});
+}
+
+float UClimbRoutePlannerSubsystem::GetHeuristic(int32 FromNode, int32 ToNode) const
+{
+	return FVector::Dist(Nodes[FromNode].Location, Nodes[ToNode].Location) / MaxTraversalSpeed;
+}
+
+FIntVector UClimbRoutePlannerSubsystem::GetSpatialHashCell(const FVector& Location)
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / ClimbRoute::SpatialHashCellSize),
+		FMath::FloorToInt32(Location.Y / ClimbRoute::SpatialHashCellSize),
+		FMath::FloorToInt32(Location.Z / ClimbRoute::SpatialHashCellSize));
+}
+
+#pragma endregion
@@ -0,0 +1,37 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/ClimbStateTreeConditions.h"
+
+#include "StateTreeExecutionContext.h"
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+
+namespace ClimbStateTree
+{
+	static const FClimbProbeSnapshot* GetProbeSnapshot(ACharacter* Character)
+	{
+		UCustomMovementComponent* CustomMovementComponent = Character ? Cast<UCustomMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+		return CustomMovementComponent ? &CustomMovementComponent->RequestClimbProbeSnapshot() : nullptr;
+	}
+}
+
+bool FStateTreeCanClimbHereCondition::TestCondition(FStateTreeExecutionContext& Context) const
+{
+	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	const FClimbProbeSnapshot* Snapshot = ClimbStateTree::GetProbeSnapshot(InstanceData.Character);
+	const bool bCanClimb = Snapshot && (Snapshot->bIsClimbing || Snapshot->bCanStartClimbing);
+
+	return bCanClimb ^ bInvert;
+}
+
+bool FStateTreeClimbActionAvailableCondition::TestCondition(FStateTreeExecutionContext& Context) const
+{
+	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	const FClimbProbeSnapshot* Snapshot = ClimbStateTree::GetProbeSnapshot(InstanceData.Character);
+	const bool bAvailable = Snapshot && Snapshot->IsActionAvailable(Action);
+
+	return bAvailable ^ bInvert;
+}
@@ -0,0 +1,156 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/ClimbStateTreeTasks.h"
+
+#include "StateTreeExecutionContext.h"
+#include "AI/ClimbRoutePlannerSubsystem.h"
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+
+namespace ClimbStateTree
+{
+	static UCustomMovementComponent* GetCustomMovementComponent(const ACharacter* Character)
+	{
+		return Character ? Cast<UCustomMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+	}
+}
+
+#pragma region Climb To Point
+
+EStateTreeRunStatus FStateTreeClimbToPointTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	UCustomMovementComponent* CustomMovementComponent = ClimbStateTree::GetCustomMovementComponent(InstanceData.Character);
+	UClimbRoutePlannerSubsystem* Planner = InstanceData.Character ? InstanceData.Character->GetWorld()->GetSubsystem<UClimbRoutePlannerSubsystem>() : nullptr;
+
+	if (!CustomMovementComponent || !Planner)
+	{
+		return EStateTreeRunStatus::Failed;
+	}
+
+	TArray<FClimbRouteWaypoint> Route;
+	if (!Planner->FindPath(InstanceData.Character->GetActorLocation(), InstanceData.TargetLocation, Route))
+	{
+		return EStateTreeRunStatus::Failed;
+	}
+
+	CustomMovementComponent->FollowClimbRoute(Route);
+
+	return EStateTreeRunStatus::Running;
+}
+
+EStateTreeRunStatus FStateTreeClimbToPointTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	const UCustomMovementComponent* CustomMovementComponent = ClimbStateTree::GetCustomMovementComponent(InstanceData.Character);
+	if (!CustomMovementComponent)
+	{
+		return EStateTreeRunStatus::Failed;
+	}
+
+	if (CustomMovementComponent->IsFollowingClimbRoute())
+	{
+		return EStateTreeRunStatus::Running;
+	}
+
+	// 경로 추종이 끝났으면 실제로 목표 근처에 도착했는지로 성공 여부를 판단
+	const float DistanceToTarget = FVector::Dist(InstanceData.Character->GetActorLocation(), InstanceData.TargetLocation);
+	return DistanceToTarget <= InstanceData.AcceptanceRadius ? EStateTreeRunStatus::Succeeded : EStateTreeRunStatus::Failed;
+}
+
+void FStateTreeClimbToPointTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	if (UCustomMovementComponent* CustomMovementComponent = ClimbStateTree::GetCustomMovementComponent(InstanceData.Character))
+	{
+		CustomMovementComponent->AbortClimbRoute();
+	}
+}
+
+#pragma endregion
+
+#pragma region Climb Action
+
+EStateTreeRunStatus FStateTreeClimbActionTaskBase::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	UCustomMovementComponent* CustomMovementComponent = ClimbStateTree::GetCustomMovementComponent(InstanceData.Character);
+	if (!CustomMovementComponent || !CustomMovementComponent->TryClimbAction(GetAction()))
+	{
+		return EStateTreeRunStatus::Failed;
+	}
+
+	return EStateTreeRunStatus::Running;
+}
+
+EStateTreeRunStatus FStateTreeClimbActionTaskBase::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	const UCustomMovementComponent* CustomMovementComponent = ClimbStateTree::GetCustomMovementComponent(InstanceData.Character);
+	if (!CustomMovementComponent)
+	{
+		return EStateTreeRunStatus::Failed;
+	}
+
+	if (CustomMovementComponent->IsClimbActionPlaying())
+	{
+		return EStateTreeRunStatus::Running;
+	}
+
+	return HasActionSucceeded(*CustomMovementComponent) ? EStateTreeRunStatus::Succeeded : EStateTreeRunStatus::Failed;
+}
+
+bool FStateTreeClimbActionTaskBase::HasActionSucceeded(const UCustomMovementComponent& CustomMovementComponent) const
+{
+	// 홉 / 등반 진입은 등반 상태로 끝나야 성공
+	return CustomMovementComponent.IsClimbing();
+}
+
+bool FStateTreeClimbVaultTask::HasActionSucceeded(const UCustomMovementComponent& CustomMovementComponent) const
+{
+	return CustomMovementComponent.IsMovingOnGround();
+}
+
+EStateTreeRunStatus FStateTreeClimbTopOutTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	UCustomMovementComponent* CustomMovementComponent = ClimbStateTree::GetCustomMovementComponent(InstanceData.Character);
+	if (!CustomMovementComponent || !CustomMovementComponent->IsClimbing())
+	{
+		return EStateTreeRunStatus::Failed;
+	}
+
+	// 이미 렛지 바로 아래라면 즉시 올라서고, 아니면 Tick 에서 위로 등반
+	CustomMovementComponent->TryClimbAction(GetAction());
+
+	return EStateTreeRunStatus::Running;
+}
+
+EStateTreeRunStatus FStateTreeClimbTopOutTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	UCustomMovementComponent* CustomMovementComponent = ClimbStateTree::GetCustomMovementComponent(InstanceData.Character);
+	if (CustomMovementComponent && CustomMovementComponent->IsClimbing() && !CustomMovementComponent->IsClimbActionPlaying())
+	{
+		// 렛지에 닿으면 CheckHasReachedLedge 가 ClimbToTop 몽타주를 재생
+		CustomMovementComponent->AddInputVector(CustomMovementComponent->UpdatedComponent->GetUpVector());
+		return EStateTreeRunStatus::Running;
+	}
+
+	return Super::Tick(Context, DeltaTime);
+}
+
+bool FStateTreeClimbTopOutTask::HasActionSucceeded(const UCustomMovementComponent& CustomMovementComponent) const
+{
+	return CustomMovementComponent.IsMovingOnGround();
+}
+
+#pragma endregion
@@ -0,0 +1,11 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/NavArea_Climb.h"
+
+UNavArea_Climb::UNavArea_Climb(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	DefaultCost = 3.f;
+	DrawColor = FColor::Orange;
+}
@@ -0,0 +1,604 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/ClimbAnalysisCommandlet.h"
+
+#include "ClimbingSystem.h"
+#include "ClimbingSystemCharacter.h"
+#include "EngineUtils.h"
+#include "Async/ParallelFor.h"
+#include "Climbing/ClimbPhysicalMaterial.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/CustomMovementComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Subsystems/ClimbSurfaceSubsystem.h"
+#include "UObject/Package.h"
+
+namespace ClimbAnalysis
+{
+	static constexpr float MinCellSize = 10.f;
+	static constexpr int32 MaxGridCellsPerAxis = 1024;
+	static constexpr int32 MaxFloorLayers = 4;
+	static constexpr float BoundsMargin = 200.f;
+	static constexpr float WalkableFloorZ = 0.71f;
+
+	/** 벽면 샘플을 바깥에서 안쪽으로 쏠 때의 여유 거리 */
+	static constexpr float FaceTraceDepth = 100.f;
+
+	/** 렛지 열에서 꼭대기까지 올라가며 판정하는 간격 */
+	static constexpr float LedgeClimbStep = 10.f;
+
+	static const FClimbSurfaceProperties DefaultSurfaceProperties;
+
+	static const FVector ProbeDirections[] = { FVector::ForwardVector, FVector::RightVector, FVector::BackwardVector, FVector::LeftVector };
+}
+
+/**
+ * 워커 스레드용 등반 규칙 쿼리
+ * 분석 월드는 틱하지 않으므로 씬 읽기 쿼리만 동시에 실행된다. 등반 불가 필터는 미리 만든 읽기 전용 스냅샷을 사용.
+ */
+class FClimbAnalysisTracer final : public IClimbRuleTracer
+{
+public:
+	FClimbAnalysisTracer(const UWorld& InWorld, const FClimbRuleSettings& InSettings, TFunctionRef<bool(const FHitResult&)> InIsClimbable)
+		: World(InWorld)
+		, Settings(InSettings)
+		, IsClimbable(InIsClimbable)
+		, LineQueryParams(SCENE_QUERY_STAT(ClimbAnalysisLineTrace), false)
+		, CapsuleQueryParams(SCENE_QUERY_STAT(ClimbAnalysisCapsuleTrace), false)
+	{
+		LineQueryParams.bReturnPhysicalMaterial = true;
+		CapsuleQueryParams.bReturnPhysicalMaterial = true;
+	}
+
+	virtual FHitResult LineTrace(const FVector& Start, const FVector& End) override
+	{
+		++NumQueries;
+
+		FHitResult Hit;
+		World.LineTraceSingleByChannel(Hit, Start, End, Settings.TraceChannel, LineQueryParams);
+		return Hit;
+	}
+
+	virtual TArray<FHitResult> CapsuleTrace(const FVector& Start, const FVector& End) override
+	{
+		++NumQueries;
+
+		TArray<FHitResult> Hits;
+		World.SweepMultiByChannel(Hits, Start, End, FQuat::Identity, Settings.TraceChannel,
+			FCollisionShape::MakeCapsule(Settings.CapsuleTraceRadius, Settings.CapsuleTraceHalfHeight), CapsuleQueryParams, FCollisionResponseParams(ECR_Overlap));
+
+		Hits.RemoveAll([this](const FHitResult& Hit) { return !IsClimbable(Hit); });
+		return Hits;
+	}
+
+	int32 NumQueries = 0;
+
+private:
+	const UWorld& World;
+	const FClimbRuleSettings& Settings;
+	TFunctionRef<bool(const FHitResult&)> IsClimbable;
+	FCollisionQueryParams LineQueryParams;
+	FCollisionQueryParams CapsuleQueryParams;
+};
+
+UClimbAnalysisCommandlet::UClimbAnalysisCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UClimbAnalysisCommandlet::Main(const FString& Params)
+{
+	FString MapName;
+	if (!FParse::Value(*Params, TEXT("Map="), MapName))
+	{
+		UE_LOG(LogClimbingSystem, Error, TEXT("ClimbAnalysis: -Map=<package path> is required"));
+		return 1;
+	}
+
+	FString CharacterClassPath;
+	FParse::Value(*Params, TEXT("Character="), CharacterClassPath);
+	FParse::Value(*Params, TEXT("CellSize="), CellSize);
+	CellSize = FMath::Max(CellSize, ClimbAnalysis::MinCellSize);
+
+	const bool bFailOnIssues = FParse::Param(*Params, TEXT("FailOnIssues"));
+
+	FString ReportPath;
+	if (!FParse::Value(*Params, TEXT("Output="), ReportPath))
+	{
+		ReportPath = FPaths::ProjectSavedDir() / TEXT("ClimbAnalysis") / FPackageName::GetShortName(MapName) + TEXT(".csv");
+	}
+
+	if (!ResolveRuleSettings(CharacterClassPath))
+	{
+		return 1;
+	}
+
+	UWorld* World = LoadAnalysisWorld(MapName);
+	if (!World)
+	{
+		UE_LOG(LogClimbingSystem, Error, TEXT("ClimbAnalysis: failed to load map %s"), *MapName);
+		return 1;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	BuildSurfaceSnapshot(World);
+
+	TArray<FClimbAnalysisProbe> Probes;
+	GatherGroundProbes(World, Probes);
+	GatherLedgeProbes(World, Probes);
+
+	TArray<FClimbAnalysisResult> Results;
+	Results.SetNum(Probes.Num());
+
+	ParallelFor(Probes.Num(), [this, World, &Probes, &Results](int32 ProbeIndex)
+	{
+		EvaluateProbe(World, Probes[ProbeIndex], Results[ProbeIndex]);
+	});
+
+	const bool bReportWritten = WriteReport(ReportPath, Probes, Results, FPlatformTime::Seconds() - StartTime);
+
+	ReleaseAnalysisWorld(World);
+
+	if (!bReportWritten)
+	{
+		return 1;
+	}
+
+	const bool bHasIssues = Results.ContainsByPredicate([](const FClimbAnalysisResult& Result)
+	{
+		return Result.bDeadEndLedge || Result.bUnreachableVault;
+	});
+
+	return bFailOnIssues && bHasIssues ? 1 : 0;
+}
+
+UWorld* UClimbAnalysisCommandlet::LoadAnalysisWorld(const FString& MapName) const
+{
+	UPackage* MapPackage = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	World->AddToRoot();
+	World->WorldType = EWorldType::Editor;
+
+	// 쿼리에 필요한 물리 씬만 만들고 시뮬레이션 / 내비게이션 / AI 는 생략
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues()
+			.CreatePhysicsScene(true)
+			.EnableTraceCollision(true)
+			.ShouldSimulatePhysics(false)
+			.CreateNavigation(false)
+			.CreateAISystem(false)
+			.AllowAudioPlayback(false)
+			.CreateFXSystem(false)
+			.SetTransactional(false));
+	}
+
+	World->UpdateWorldComponents(true, false);
+	World->FlushLevelStreaming(EFlushLevelStreamingType::Full);
+
+	return World;
+}
+
+void UClimbAnalysisCommandlet::ReleaseAnalysisWorld(UWorld* World) const
+{
+	World->CleanupWorld();
+	World->RemoveFromRoot();
+}
+
+bool UClimbAnalysisCommandlet::ResolveRuleSettings(const FString& CharacterClassPath)
+{
+	const UClass* CharacterClass = CharacterClassPath.IsEmpty()
+		? AClimbingSystemCharacter::StaticClass()
+		: LoadClass<AClimbingSystemCharacter>(nullptr, *CharacterClassPath);
+
+	const AClimbingSystemCharacter* CharacterCDO = CharacterClass ? CharacterClass->GetDefaultObject<AClimbingSystemCharacter>() : nullptr;
+	const UCustomMovementComponent* MovementCDO = CharacterCDO ? CharacterCDO->GetCustomMovementComponent() : nullptr;
+
+	if (!MovementCDO)
+	{
+		UE_LOG(LogClimbingSystem, Error, TEXT("ClimbAnalysis: %s is not a climbing character"), *CharacterClassPath);
+		return false;
+	}
+
+	RuleSettings = MovementCDO->GetClimbRuleSettings();
+	RuleSettings.EyeHeight = CharacterCDO->BaseEyeHeight;
+
+	if (const UCapsuleComponent* Capsule = CharacterCDO->GetCapsuleComponent())
+	{
+		CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+		CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	}
+
+	return true;
+}
+
+/**
+ * @brief 등반 표면 서브시스템을 채운 뒤, 워커 스레드가 읽을 속성 스냅샷과 분석 범위를 만듦
+ *
+ * 분석 월드는 BeginPlay 를 거치지 않으므로 레벨 액터를 직접 등록한다.
+ */
+void UClimbAnalysisCommandlet::BuildSurfaceSnapshot(UWorld* World)
+{
+	SurfacePropertiesSnapshot.Reset();
+	ClimbableBounds.Init();
+
+	UClimbSurfaceSubsystem* ClimbSurfaceSubsystem = World->GetSubsystem<UClimbSurfaceSubsystem>();
+	if (!ClimbSurfaceSubsystem)
+	{
+		return;
+	}
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		ClimbSurfaceSubsystem->RegisterActor(*It);
+	}
+
+	ClimbSurfaceSubsystem->ForEachRegisteredComponent([this](const UPrimitiveComponent* Component, const FClimbSurfaceProperties& Properties)
+	{
+		SurfacePropertiesSnapshot.Add(Component, Properties);
+
+		if (Properties.bClimbable && Component->GetCollisionResponseToChannel(RuleSettings.TraceChannel) != ECR_Ignore)
+		{
+			ClimbableBounds += Component->Bounds.GetBox();
+		}
+	});
+
+	if (ClimbableBounds.IsValid)
+	{
+		ClimbableBounds = ClimbableBounds.ExpandBy(FVector(ClimbAnalysis::BoundsMargin, ClimbAnalysis::BoundsMargin, 0.f));
+	}
+}
+
+const FClimbSurfaceProperties& UClimbAnalysisCommandlet::GetSurfaceProperties(const FHitResult& Hit) const
+{
+	// UClimbSurfaceSubsystem::GetSurfaceProperties 와 같은 우선순위 (캐시를 갱신하지 않는 읽기 전용 버전)
+	if (const UClimbPhysicalMaterial* ClimbPhysicalMaterial = Cast<UClimbPhysicalMaterial>(Hit.PhysMaterial.Get()))
+	{
+		return ClimbPhysicalMaterial->ClimbProperties;
+	}
+
+	const FClimbSurfaceProperties* Properties = SurfacePropertiesSnapshot.Find(Hit.GetComponent());
+	return Properties ? *Properties : ClimbAnalysis::DefaultSurfaceProperties;
+}
+
+/**
+ * @brief 분석 범위의 XY 격자마다 위에서 아래로 트레이스해 설 수 있는 바닥(최대 MaxFloorLayers 층)을 찾고,
+ * 각 바닥에서 네 방향을 바라보는 자세를 프로브로 추가
+ */
+void UClimbAnalysisCommandlet::GatherGroundProbes(const UWorld* World, TArray<FClimbAnalysisProbe>& OutProbes) const
+{
+	if (!ClimbableBounds.IsValid)
+	{
+		return;
+	}
+
+	const FVector Extent = ClimbableBounds.GetSize();
+	const int32 NumX = FMath::Clamp(FMath::CeilToInt32(Extent.X / CellSize), 1, ClimbAnalysis::MaxGridCellsPerAxis);
+	const int32 NumY = FMath::Clamp(FMath::CeilToInt32(Extent.Y / CellSize), 1, ClimbAnalysis::MaxGridCellsPerAxis);
+
+	TArray<TArray<FVector, TInlineAllocator<ClimbAnalysis::MaxFloorLayers>>> FloorsPerCell;
+	FloorsPerCell.SetNum(NumX * NumY);
+
+	ParallelFor(NumX * NumY, [this, World, NumX, &FloorsPerCell](int32 CellIndex)
+	{
+		const FVector CellCenter(
+			ClimbableBounds.Min.X + CellSize * (CellIndex % NumX + 0.5f),
+			ClimbableBounds.Min.Y + CellSize * (CellIndex / NumX + 0.5f),
+			0.f);
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbAnalysisFloorTrace), false);
+		FVector Start(CellCenter.X, CellCenter.Y, ClimbableBounds.Max.Z + CapsuleHalfHeight * 2.f);
+		const FVector End(CellCenter.X, CellCenter.Y, ClimbableBounds.Min.Z - CapsuleHalfHeight);
+
+		for (int32 Layer = 0; Layer < ClimbAnalysis::MaxFloorLayers; ++Layer)
+		{
+			FHitResult FloorHit;
+			if (!World->LineTraceSingleByChannel(FloorHit, Start, End, RuleSettings.TraceChannel, QueryParams))
+			{
+				break;
+			}
+
+			if (FloorHit.ImpactNormal.Z >= ClimbAnalysis::WalkableFloorZ)
+			{
+				FloorsPerCell[CellIndex].Add(FloorHit.ImpactPoint + FVector::UpVector * CapsuleHalfHeight);
+			}
+
+			// 같은 컴포넌트 아래층은 다시 맞지 않도록 무시 목록에 추가하고 계속 내려감
+			QueryParams.AddIgnoredComponent(FloorHit.GetComponent());
+			Start = FloorHit.ImpactPoint;
+		}
+	});
+
+	for (const TArray<FVector, TInlineAllocator<ClimbAnalysis::MaxFloorLayers>>& Floors : FloorsPerCell)
+	{
+		for (const FVector& StandLocation : Floors)
+		{
+			for (const FVector& Direction : ClimbAnalysis::ProbeDirections)
+			{
+				FClimbAnalysisProbe& Probe = OutProbes.AddDefaulted_GetRef();
+				Probe.Pose.Location = StandLocation;
+				Probe.Pose.Forward = Direction;
+				Probe.Pose.Up = FVector::UpVector;
+			}
+		}
+	}
+}
+
+void UClimbAnalysisCommandlet::GatherLedgeProbes(const UWorld* World, TArray<FClimbAnalysisProbe>& OutProbes) const
+{
+	for (const TPair<TObjectKey<UPrimitiveComponent>, FClimbSurfaceProperties>& Pair : SurfacePropertiesSnapshot)
+	{
+		const UPrimitiveComponent* Component = Pair.Key.ResolveObjectPtr();
+		if (!Component || !Pair.Value.bClimbable)
+		{
+			continue;
+		}
+
+		for (const FVector& Direction : ClimbAnalysis::ProbeDirections)
+		{
+			GatherFaceLedgeProbes(World, Component, Pair.Value, Direction, OutProbes);
+		}
+	}
+}
+
+/**
+ * @brief 면의 각 열에서 등반 가능한 가장 높은 지점을 찾아 렛지 열 프로브로 추가
+ *
+ * UClimbRoutePlannerSubsystem::BuildSurfaceFace 와 같은 방식으로 면 바깥에서 안쪽으로 트레이스한다.
+ */
+void UClimbAnalysisCommandlet::GatherFaceLedgeProbes(const UWorld* World, const UPrimitiveComponent* Component, const FClimbSurfaceProperties& Properties, const FVector& FaceDirection, TArray<FClimbAnalysisProbe>& OutProbes) const
+{
+	const FBox Bounds = Component->Bounds.GetBox();
+	const FVector Center = Bounds.GetCenter();
+	const FVector Extent = Bounds.GetExtent();
+
+	const FVector Tangent = FVector::CrossProduct(FVector::UpVector, FaceDirection);
+	const float HalfWidth = FMath::Abs(FVector::DotProduct(Extent, Tangent));
+	const float Depth = FMath::Abs(FVector::DotProduct(Extent, FaceDirection));
+
+	const int32 NumColumns = FMath::Clamp(FMath::CeilToInt32(HalfWidth * 2.f / CellSize), 1, ClimbAnalysis::MaxGridCellsPerAxis);
+	const int32 NumRows = FMath::Clamp(FMath::CeilToInt32(Extent.Z * 2.f / CellSize), 1, ClimbAnalysis::MaxGridCellsPerAxis);
+	const float ColumnStep = HalfWidth * 2.f / NumColumns;
+	const float RowStep = Extent.Z * 2.f / NumRows;
+	const float MaxSurfaceAngle = Properties.GetMaxClimbableSurfaceAngle(RuleSettings.MaxClimbableSurfaceAngle);
+
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbAnalysisFaceTrace), false);
+
+	for (int32 Column = 0; Column < NumColumns; ++Column)
+	{
+		// 위에서부터 내려오며 처음 등반 가능한 샘플이 이 열의 꼭대기
+		for (int32 Row = NumRows - 1; Row >= 0; --Row)
+		{
+			const FVector SamplePoint = Center
+				+ Tangent * (-HalfWidth + ColumnStep * (Column + 0.5f))
+				+ FVector::UpVector * (-Extent.Z + RowStep * (Row + 0.5f));
+
+			const FVector Start = SamplePoint + FaceDirection * (Depth + ClimbAnalysis::FaceTraceDepth);
+			const FVector End = SamplePoint - FaceDirection * Depth;
+
+			FHitResult Hit;
+			if (!World->LineTraceSingleByChannel(Hit, Start, End, RuleSettings.TraceChannel, QueryParams) || Hit.GetComponent() != Component)
+			{
+				continue;
+			}
+
+			// CheckShouldStopClimbing 과 같은 규칙: 너무 평평한 면은 등반 불가
+			const float SurfaceAngle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(Hit.ImpactNormal, FVector::UpVector)));
+			if (FVector::DotProduct(Hit.ImpactNormal, FaceDirection) < 0.5f || SurfaceAngle <= MaxSurfaceAngle)
+			{
+				continue;
+			}
+
+			// GetClimbRotation 과 같이 벽을 바라보고, 눈높이가 꼭대기 샘플에 오도록 매달린 자세
+			const FMatrix ClimbRotation = FRotationMatrix::MakeFromX(-Hit.ImpactNormal);
+
+			FClimbAnalysisProbe& Probe = OutProbes.AddDefaulted_GetRef();
+			Probe.Pose.Forward = ClimbRotation.GetUnitAxis(EAxis::X);
+			Probe.Pose.Up = ClimbRotation.GetUnitAxis(EAxis::Z);
+			Probe.Pose.Location = Hit.ImpactPoint + Hit.ImpactNormal * CapsuleRadius - Probe.Pose.Up * RuleSettings.EyeHeight;
+			Probe.Surface = Component;
+			Probe.bLedgeCapable = Properties.bLedgeCapable;
+			Probe.bLedgeColumn = true;
+			break;
+		}
+	}
+}
+
+void UClimbAnalysisCommandlet::EvaluateProbe(const UWorld* World, const FClimbAnalysisProbe& Probe, FClimbAnalysisResult& OutResult) const
+{
+	FClimbAnalysisTracer Tracer(*World, RuleSettings, [this](const FHitResult& Hit) { return GetSurfaceProperties(Hit).bClimbable; });
+
+	auto MeasureRule = [&Tracer, &OutResult](EClimbAnalysisRule Rule, TFunctionRef<void()> Evaluate)
+	{
+		const int32 RuleIndex = static_cast<int32>(Rule);
+		const int32 QueriesBefore = Tracer.NumQueries;
+		const uint64 CyclesBefore = FPlatformTime::Cycles64();
+
+		Evaluate();
+
+		OutResult.Cycles[RuleIndex] += FPlatformTime::Cycles64() - CyclesBefore;
+		OutResult.NumQueries[RuleIndex] += Tracer.NumQueries - QueriesBefore;
+		++OutResult.NumEvaluations[RuleIndex];
+	};
+
+	if (Probe.bLedgeColumn)
+	{
+		EvaluateLedgeColumn(Probe, Tracer, OutResult);
+		return;
+	}
+
+	MeasureRule(EClimbAnalysisRule::StartClimbing, [&]()
+	{
+		TArray<FHitResult> SurfaceHits;
+		OutResult.bCanStartClimbing = ClimbRules::CanStartClimbing(RuleSettings, Probe.Pose, Tracer, SurfaceHits);
+
+		if (OutResult.bCanStartClimbing)
+		{
+			OutResult.HitSurface = SurfaceHits[0].GetComponent();
+		}
+	});
+
+	MeasureRule(EClimbAnalysisRule::ClimbDownLedge, [&]()
+	{
+		FHitResult WalkableSurfaceHit;
+		OutResult.bCanClimbDownLedge = ClimbRules::CanClimbDownLedge(RuleSettings, Probe.Pose, Tracer, WalkableSurfaceHit)
+			&& GetSurfaceProperties(WalkableSurfaceHit).bLedgeCapable;
+	});
+
+	MeasureRule(EClimbAnalysisRule::Vault, [&]()
+	{
+		FVector VaultStartPosition;
+		FVector VaultLandPosition;
+
+		// 장애물 윗면은 있는데 착지 지점이 없으면 볼팅 몽타주를 시작할 수 없는 장애물
+		if (!ClimbRules::CanStartVaulting(RuleSettings, Probe.Pose, Tracer, VaultStartPosition, VaultLandPosition) && VaultStartPosition != FVector::ZeroVector)
+		{
+			OutResult.bUnreachableVault = true;
+			OutResult.IssueLocation = VaultStartPosition;
+		}
+	});
+}
+
+/**
+ * @brief 꼭대기 샘플 아래에서부터 위로 올라가며 CheckHasReachedLedge 가 성립하는지 확인
+ *
+ * 등반 표면(TraceClimbableSurfaces)이 끊기기 전에 CanTopOut 이 한 번도 성립하지 않으면 막다른 렛지.
+ */
+void UClimbAnalysisCommandlet::EvaluateLedgeColumn(const FClimbAnalysisProbe& Probe, FClimbAnalysisTracer& Tracer, FClimbAnalysisResult& OutResult) const
+{
+	const int32 RuleIndex = static_cast<int32>(EClimbAnalysisRule::TopOut);
+	const int32 QueriesBefore = Tracer.NumQueries;
+	const uint64 CyclesBefore = FPlatformTime::Cycles64();
+
+	const int32 NumSteps = FMath::CeilToInt32((RuleSettings.EyeHeight + CapsuleHalfHeight) / ClimbAnalysis::LedgeClimbStep);
+
+	bool bCanTopOut = false;
+	FClimbProbePose Pose = Probe.Pose;
+	TArray<FHitResult> SurfaceHits;
+
+	for (int32 Step = 0; Step < NumSteps && !bCanTopOut; ++Step)
+	{
+		if (!ClimbRules::TraceClimbableSurfaces(RuleSettings, Pose, Tracer, SurfaceHits))
+		{
+			break;
+		}
+
+		bCanTopOut = Probe.bLedgeCapable && ClimbRules::CanTopOut(RuleSettings, Pose, Tracer);
+		Pose.Location += Pose.Up * ClimbAnalysis::LedgeClimbStep;
+	}
+
+	OutResult.bDeadEndLedge = !bCanTopOut;
+	OutResult.IssueLocation = Pose.Location + Pose.Up * RuleSettings.EyeHeight;
+	OutResult.HitSurface = Probe.Surface;
+
+	OutResult.Cycles[RuleIndex] += FPlatformTime::Cycles64() - CyclesBefore;
+	OutResult.NumQueries[RuleIndex] += Tracer.NumQueries - QueriesBefore;
+	++OutResult.NumEvaluations[RuleIndex];
+}
+
+bool UClimbAnalysisCommandlet::WriteReport(const FString& ReportPath, const TArray<FClimbAnalysisProbe>& Probes, const TArray<FClimbAnalysisResult>& Results, double ElapsedSeconds) const
+{
+	auto GetSurfaceName = [](const TWeakObjectPtr<const UPrimitiveComponent>& Surface)
+	{
+		const UPrimitiveComponent* Component = Surface.Get();
+		return Component ? FString::Printf(TEXT("%s.%s"), *GetNameSafe(Component->GetOwner()), *Component->GetName()) : FString(TEXT("None"));
+	};
+
+	TArray<FString> ReportLines;
+	ReportLines.Add(TEXT("Type,Surface,X,Y,Z,DirX,DirY,DirZ"));
+
+	int32 NumClimbEntries = 0;
+	int32 NumClimbDownLedges = 0;
+	int32 NumLedgeColumns = 0;
+	int32 NumDeadEndLedges = 0;
+	int32 NumUnreachableVaults = 0;
+
+	int64 RuleQueries[static_cast<int32>(EClimbAnalysisRule::Num)] = {};
+	int64 RuleEvaluations[static_cast<int32>(EClimbAnalysisRule::Num)] = {};
+	uint64 RuleCycles[static_cast<int32>(EClimbAnalysisRule::Num)] = {};
+
+	for (int32 ProbeIndex = 0; ProbeIndex < Probes.Num(); ++ProbeIndex)
+	{
+		const FClimbAnalysisProbe& Probe = Probes[ProbeIndex];
+		const FClimbAnalysisResult& Result = Results[ProbeIndex];
+
+		for (int32 RuleIndex = 0; RuleIndex < static_cast<int32>(EClimbAnalysisRule::Num); ++RuleIndex)
+		{
+			RuleQueries[RuleIndex] += Result.NumQueries[RuleIndex];
+			RuleEvaluations[RuleIndex] += Result.NumEvaluations[RuleIndex];
+			RuleCycles[RuleIndex] += Result.Cycles[RuleIndex];
+		}
+
+		auto AddLine = [&](const TCHAR* Type, const FVector& Location)
+		{
+			ReportLines.Add(FString::Printf(TEXT("%s,%s,%.1f,%.1f,%.1f,%.3f,%.3f,%.3f"), Type, *GetSurfaceName(Result.HitSurface),
+				Location.X, Location.Y, Location.Z, Probe.Pose.Forward.X, Probe.Pose.Forward.Y, Probe.Pose.Forward.Z));
+		};
+
+		NumLedgeColumns += Probe.bLedgeColumn ? 1 : 0;
+		NumClimbDownLedges += Result.bCanClimbDownLedge ? 1 : 0;
+
+		if (Result.bCanStartClimbing)
+		{
+			++NumClimbEntries;
+			AddLine(TEXT("ClimbEntry"), Probe.Pose.Location);
+		}
+
+		if (Result.bDeadEndLedge)
+		{
+			++NumDeadEndLedges;
+			AddLine(TEXT("DeadEndLedge"), Result.IssueLocation);
+		}
+
+		if (Result.bUnreachableVault)
+		{
+			++NumUnreachableVaults;
+			AddLine(TEXT("UnreachableVault"), Result.IssueLocation);
+		}
+	}
+
+	// 규칙별 평가 1회당 쿼리 수 / 비용 (프로브 예산 산정용)
+	static const TCHAR* RuleNames[] = { TEXT("CanStartClimbing"), TEXT("CanClimbDownLedge"), TEXT("CanStartVaulting"), TEXT("CheckHasReachedLedge") };
+
+	TArray<FString> CostLines;
+	CostLines.Add(TEXT("Rule,Evaluations,AvgQueries,AvgMicroseconds,TotalMs"));
+
+	for (int32 RuleIndex = 0; RuleIndex < static_cast<int32>(EClimbAnalysisRule::Num); ++RuleIndex)
+	{
+		const double Evaluations = FMath::Max<int64>(RuleEvaluations[RuleIndex], 1);
+		const double TotalMs = FPlatformTime::ToMilliseconds64(RuleCycles[RuleIndex]);
+
+		CostLines.Add(FString::Printf(TEXT("%s,%lld,%.2f,%.2f,%.2f"), RuleNames[RuleIndex], RuleEvaluations[RuleIndex],
+			RuleQueries[RuleIndex] / Evaluations, TotalMs * 1000.0 / Evaluations, TotalMs));
+	}
+
+	const FString CostPath = FPaths::GetPath(ReportPath) / FPaths::GetBaseFilename(ReportPath) + TEXT("-Costs.csv");
+
+	if (!FFileHelper::SaveStringArrayToFile(ReportLines, *ReportPath) || !FFileHelper::SaveStringArrayToFile(CostLines, *CostPath))
+	{
+		UE_LOG(LogClimbingSystem, Error, TEXT("ClimbAnalysis: failed to write report to %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogClimbingSystem, Display, TEXT("ClimbAnalysis: %d probes in %.2fs (cell %.0fcm): %d climb entries, %d climb-down ledges, %d/%d dead-end ledges, %d unreachable vaults"),
+		Probes.Num(), ElapsedSeconds, CellSize, NumClimbEntries, NumClimbDownLedges, NumDeadEndLedges, NumLedgeColumns, NumUnreachableVaults);
+	UE_LOG(LogClimbingSystem, Display, TEXT("ClimbAnalysis: report written to %s (costs: %s)"), *ReportPath, *CostPath);
+
+	return true;
+}
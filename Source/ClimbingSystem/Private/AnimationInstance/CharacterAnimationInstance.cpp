@@ -27,6 +27,12 @@ void UCharacterAnimationInstance::NativeUpdateAnimation(float DeltaSeconds)
 	{
 		return;
 	}
+
+	// 이동 컴포넌트가 잠들어 있으면 정지 상태 값이 그대로이므로 갱신 생략
+	if (CustomMovementComponent->IsClimbTickSleeping())
+	{
+		return;
+	}
 	
 	GetGroundSpeed();
 	GetAirSpeed();
@@ -58,7 +64,7 @@ void UCharacterAnimationInstance::GetIsFalling()
 
 void UCharacterAnimationInstance::GetIsClimbing()
 {
-	bIsClimbing = CustomMovementComponent->IsClimbing();
+	bIsClimbing = CustomMovementComponent->IsInAnyClimbMode();
 }
 
 void UCharacterAnimationInstance::GetClimbVelocity()
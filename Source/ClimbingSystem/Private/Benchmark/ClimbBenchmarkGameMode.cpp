@@ -0,0 +1,300 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Benchmark/ClimbBenchmarkGameMode.h"
+
+#include "ClimbingSystem.h"
+#include "ClimbingSystemCharacter.h"
+#include "CoreGlobals.h"
+#include "EngineUtils.h"
+#include "TimerManager.h"
+#include "AI/ClimbBotController.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerStart.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace ClimbBenchmark
+{
+	static constexpr int32 NumCourseSegments = 24;
+	static constexpr float MinCourseRadius = 1500.f;
+	static constexpr float CourseMargin = 600.f;
+	static const float WallHeights[] = { 300.f, 450.f, 600.f, 800.f };
+	static constexpr float VaultObstacleHeight = 100.f;
+}
+
+AClimbBenchmarkGameMode::AClimbBenchmarkGameMode()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	BotControllerClass = AClimbBotController::StaticClass();
+}
+
+void AClimbBenchmarkGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+	Super::InitGame(MapName, Options, ErrorMessage);
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("ClimbBots="), TargetBotCount);
+	FParse::Value(CommandLine, TEXT("ClimbBotRamp="), BotRampStep);
+	FParse::Value(CommandLine, TEXT("ClimbBotStageSeconds="), StageSeconds);
+	FParse::Value(CommandLine, TEXT("ClimbBotSeed="), BotSeed);
+	bSpawnTestCourse = FParse::Param(CommandLine, TEXT("ClimbBenchCourse"));
+	bExitWhenFinished = FParse::Param(CommandLine, TEXT("ClimbBenchExit"));
+
+	BotRampStep = BotRampStep > 0 ? BotRampStep : TargetBotCount;
+	StageSeconds = FMath::Max(StageSeconds, WarmupSeconds + 1.f);
+
+	LoadedBotCharacterClass = BotCharacterClass.LoadSynchronous();
+
+	if (LoadedBotCharacterClass)
+	{
+		DefaultPawnClass = LoadedBotCharacterClass;
+	}
+
+	if (UClass* LoadedPlayerControllerClass = ClientPlayerControllerClass.LoadSynchronous())
+	{
+		PlayerControllerClass = LoadedPlayerControllerClass;
+	}
+}
+
+void AClimbBenchmarkGameMode::StartPlay()
+{
+	Super::StartPlay();
+
+	if (TargetBotCount <= 0)
+	{
+		return;
+	}
+
+	if (!LoadedBotCharacterClass)
+	{
+		UE_LOG(LogClimbingSystem, Error, TEXT("ClimbBenchmark: BotCharacterClass is not set, benchmark disabled"));
+		return;
+	}
+
+	if (bSpawnTestCourse)
+	{
+		SpawnTestCourse();
+	}
+
+	WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &ThisClass::OnWorldTickStart);
+	WorldPostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::OnWorldPostActorTick);
+
+	ReportLines.Add(TEXT("Bots,ClimbingBots,AvgGameThreadMs,MaxGameThreadMs,AvgWorldTickMs,AvgClimbTickMs,SceneQueriesPerFrame,CacheHitsPerFrame"));
+
+	SpawnBots(FMath::Min(BotRampStep, TargetBotCount));
+	GetWorldTimerManager().SetTimer(StageTimerHandle, this, &ThisClass::OnStageFinished, StageSeconds, true);
+
+	UE_LOG(LogClimbingSystem, Display, TEXT("ClimbBenchmark: target %d bots, +%d every %.1fs (seed %d)"), TargetBotCount, BotRampStep, StageSeconds, BotSeed);
+}
+
+void AClimbBenchmarkGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(WorldPostActorTickHandle);
+
+	// 중간에 종료돼도 지금까지의 단계는 남김
+	WriteReport();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+/**
+ * @brief 벤치마크 원점 주위에 원형으로 벽과 낮은 볼팅 장애물을 배치
+ *
+ * 봇이 스폰되는 격자를 감싸도록 반지름을 정하며, 세 번째 구간마다 볼팅 장애물을 둡니다.
+ * 벽은 엔진 기본 큐브를 사용하므로 별도 에셋 없이 어떤 맵에서도 동작합니다.
+ */
+void AClimbBenchmarkGameMode::SpawnTestCourse()
+{
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!CubeMesh)
+	{
+		return;
+	}
+
+	const FVector Origin = GetBenchmarkOrigin();
+	const float GridRadius = FMath::Sqrt(static_cast<float>(TargetBotCount)) * BotSpacing * 0.5f * UE_SQRT_2;
+	const float CourseRadius = FMath::Max(ClimbBenchmark::MinCourseRadius, GridRadius + ClimbBenchmark::CourseMargin);
+	const float SegmentWidth = UE_TWO_PI * CourseRadius / ClimbBenchmark::NumCourseSegments;
+
+	FRandomStream CourseRandom(BotSeed);
+
+	for (int32 Segment = 0; Segment < ClimbBenchmark::NumCourseSegments; ++Segment)
+	{
+		const float Angle = UE_TWO_PI * Segment / ClimbBenchmark::NumCourseSegments;
+		const FVector Direction(FMath::Cos(Angle), FMath::Sin(Angle), 0.f);
+
+		const bool bVaultObstacle = Segment % 3 == 0;
+		const float Height = bVaultObstacle ? ClimbBenchmark::VaultObstacleHeight : ClimbBenchmark::WallHeights[CourseRandom.RandHelper(UE_ARRAY_COUNT(ClimbBenchmark::WallHeights))];
+
+		// 큐브는 100 유닛, 중심 피벗
+		const FVector Scale(bVaultObstacle ? 0.5f : 1.f, SegmentWidth * 0.8f / 100.f, Height / 100.f);
+		const FTransform SpawnTransform(Direction.Rotation(), Origin + Direction * CourseRadius + FVector(0.f, 0.f, Height * 0.5f), Scale);
+
+		AStaticMeshActor* CourseActor = GetWorld()->SpawnActorDeferred<AStaticMeshActor>(AStaticMeshActor::StaticClass(), SpawnTransform);
+		if (!CourseActor)
+		{
+			continue;
+		}
+
+		// 정적 컴포넌트는 등록 전에만 메시를 바꿀 수 있음
+		CourseActor->GetStaticMeshComponent()->SetStaticMesh(CubeMesh);
+		CourseActor->FinishSpawning(SpawnTransform);
+	}
+}
+
+void AClimbBenchmarkGameMode::SpawnBots(int32 Count)
+{
+	UWorld* World = GetWorld();
+	const FVector Origin = GetBenchmarkOrigin();
+	const int32 GridSize = FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(TargetBotCount)));
+
+	FActorSpawnParameters ControllerSpawnParams;
+	ControllerSpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const int32 BotIndex = Bots.Num();
+		const FVector GridOffset(
+			(BotIndex % GridSize - GridSize * 0.5f) * BotSpacing,
+			(BotIndex / GridSize - GridSize * 0.5f) * BotSpacing,
+			100.f);
+		const FTransform SpawnTransform(FRotator(0.f, 360.f * BotIndex / FMath::Max(TargetBotCount, 1), 0.f), Origin + GridOffset);
+
+		AClimbingSystemCharacter* BotCharacter = World->SpawnActorDeferred<AClimbingSystemCharacter>(LoadedBotCharacterClass, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+		if (!BotCharacter)
+		{
+			continue;
+		}
+
+		BotCharacter->AutoPossessAI = EAutoPossessAI::Disabled;
+		BotCharacter->FinishSpawning(SpawnTransform);
+
+		AClimbBotController* BotController = World->SpawnActor<AClimbBotController>(BotControllerClass, SpawnTransform, ControllerSpawnParams);
+		BotController->InitializeBot(BotSeed + BotIndex);
+		BotController->Possess(BotCharacter);
+
+		Bots.Add(BotController);
+	}
+
+	// 스폰 직후 프레임은 측정에서 제외
+	CurrentSample = FBenchmarkSample();
+	SampleStartWorldTime = World->GetTimeSeconds() + WarmupSeconds;
+}
+
+void AClimbBenchmarkGameMode::OnStageFinished()
+{
+	ReportStage();
+
+	if (Bots.Num() < TargetBotCount)
+	{
+		SpawnBots(FMath::Min(BotRampStep, TargetBotCount - Bots.Num()));
+		return;
+	}
+
+	GetWorldTimerManager().ClearTimer(StageTimerHandle);
+	WriteReport();
+
+	UE_LOG(LogClimbingSystem, Display, TEXT("ClimbBenchmark: finished"));
+
+	if (bExitWhenFinished)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("ClimbBenchmark"));
+	}
+}
+
+void AClimbBenchmarkGameMode::ReportStage()
+{
+	if (CurrentSample.NumFrames == 0)
+	{
+		return;
+	}
+
+	int32 NumClimbingBots = 0;
+	for (const AClimbBotController* Bot : Bots)
+	{
+		NumClimbingBots += Bot && Bot->IsBotClimbing() ? 1 : 0;
+	}
+
+	const double NumFrames = CurrentSample.NumFrames;
+	const double AvgGameThreadMs = CurrentSample.GameThreadSeconds / NumFrames * 1000.0;
+	const double MaxGameThreadMs = CurrentSample.MaxGameThreadSeconds * 1000.0;
+	const double AvgWorldTickMs = CurrentSample.WorldTickSeconds / NumFrames * 1000.0;
+	const double AvgClimbTickMs = CurrentSample.ClimbTickSeconds / NumFrames * 1000.0;
+	const double QueriesPerFrame = CurrentSample.SceneQueries / NumFrames;
+	const double CacheHitsPerFrame = CurrentSample.QueryCacheHits / NumFrames;
+
+	UE_LOG(LogClimbingSystem, Display, TEXT("ClimbBenchmark: Bots=%d Climbing=%d GameThread=%.2fms (max %.2fms) WorldTick=%.2fms ClimbTick=%.3fms Queries/frame=%.1f CacheHits/frame=%.1f"),
+		Bots.Num(), NumClimbingBots, AvgGameThreadMs, MaxGameThreadMs, AvgWorldTickMs, AvgClimbTickMs, QueriesPerFrame, CacheHitsPerFrame);
+
+	ReportLines.Add(FString::Printf(TEXT("%d,%d,%.3f,%.3f,%.3f,%.4f,%.2f,%.2f"),
+		Bots.Num(), NumClimbingBots, AvgGameThreadMs, MaxGameThreadMs, AvgWorldTickMs, AvgClimbTickMs, QueriesPerFrame, CacheHitsPerFrame));
+
+	CurrentSample = FBenchmarkSample();
+}
+
+void AClimbBenchmarkGameMode::WriteReport()
+{
+	// 헤더만 있으면 기록할 단계가 없음
+	if (ReportLines.Num() <= 1)
+	{
+		return;
+	}
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("ClimbBenchmark") / FString::Printf(TEXT("ClimbBench-%s.csv"), *FDateTime::Now().ToString());
+	FFileHelper::SaveStringArrayToFile(ReportLines, *ReportPath);
+
+	UE_LOG(LogClimbingSystem, Display, TEXT("ClimbBenchmark: report written to %s"), *ReportPath);
+
+	ReportLines.SetNum(1);
+}
+
+void AClimbBenchmarkGameMode::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == GetWorld())
+	{
+		WorldTickStartTime = FPlatformTime::Seconds();
+	}
+}
+
+void AClimbBenchmarkGameMode::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	// 워밍업 중에도 누적 카운터는 매 프레임 비워야 다음 프레임 값이 섞이지 않음
+	const double ClimbTickSeconds = ClimbStats::MovementTickSeconds;
+	const int32 SceneQueries = ClimbStats::NumSceneQueries.exchange(0);
+	const int32 QueryCacheHits = ClimbStats::NumQueryCacheHits.exchange(0);
+	ClimbStats::MovementTickSeconds = 0.0;
+
+	if (World->GetTimeSeconds() < SampleStartWorldTime)
+	{
+		return;
+	}
+
+	// FApp::GetDeltaTime 은 프레임 제한 대기까지 포함하므로 엔진 루프가 잰 직전 프레임의 게임 스레드 시간을 사용
+	const double GameThreadSeconds = FPlatformTime::ToSeconds(GGameThreadTime);
+
+	++CurrentSample.NumFrames;
+	CurrentSample.GameThreadSeconds += GameThreadSeconds;
+	CurrentSample.MaxGameThreadSeconds = FMath::Max(CurrentSample.MaxGameThreadSeconds, GameThreadSeconds);
+	CurrentSample.WorldTickSeconds += FPlatformTime::Seconds() - WorldTickStartTime;
+	CurrentSample.ClimbTickSeconds += ClimbTickSeconds;
+	CurrentSample.SceneQueries += SceneQueries;
+	CurrentSample.QueryCacheHits += QueryCacheHits;
+}
+
+FVector AClimbBenchmarkGameMode::GetBenchmarkOrigin() const
+{
+	// 플레이어 스타트는 캡슐 중심 높이이므로 바닥 기준으로 내림
+	const TActorIterator<APlayerStart> PlayerStartIt(GetWorld());
+	return PlayerStartIt ? PlayerStartIt->GetActorLocation() - FVector(0.f, 0.f, 90.f) : FVector::ZeroVector;
+}
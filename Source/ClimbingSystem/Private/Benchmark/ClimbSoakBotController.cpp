@@ -0,0 +1,151 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Benchmark/ClimbSoakBotController.h"
+
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+
+AClimbSoakBotController::AClimbSoakBotController()
+{
+	DecisionInterval = FVector2D(0.05f, 0.6f);
+}
+
+FString AClimbSoakBotController::GetRecentActionsString() const
+{
+	FString Result;
+
+	for (int32 Offset = 0; Offset < RecentActions.Num(); ++Offset)
+	{
+		const int32 Index = (NextRecentActionIndex + Offset) % RecentActions.Num();
+		Result += Offset > 0 ? TEXT(" > ") : TEXT("");
+		Result += GetActionName(RecentActions[Index]);
+	}
+
+	return Result;
+}
+
+bool AClimbSoakBotController::CanChooseAction() const
+{
+	// 몽타주 재생 / 낙하 중에도 입력해야 끼어들기 경계 조건이 나옴
+	return true;
+}
+
+void AClimbSoakBotController::ChooseGroundAction(const FClimbProbeSnapshot& Snapshot)
+{
+	ChooseRandomAction();
+}
+
+void AClimbSoakBotController::ChooseClimbAction(const FClimbProbeSnapshot& Snapshot)
+{
+	ChooseRandomAction();
+}
+
+void AClimbSoakBotController::ChooseRandomAction()
+{
+	ACharacter* ControlledCharacter = Cast<ACharacter>(GetPawn());
+	if (!ControlledCharacter)
+	{
+		return;
+	}
+
+	// 점프 입력은 다음 결정까지만 유지
+	ControlledCharacter->StopJumping();
+
+	const ESoakAction Action = static_cast<ESoakAction>(RandomStream.RandHelper(static_cast<int32>(ESoakAction::Num)));
+
+	switch (Action)
+	{
+	case ESoakAction::EnterClimb:
+		CustomMovementComponent->TryClimbAction(EClimbAction::EnterClimb);
+		break;
+
+	case ESoakAction::TopOut:
+		CustomMovementComponent->TryClimbAction(EClimbAction::TopOut);
+		break;
+
+	case ESoakAction::ClimbDownLedge:
+		CustomMovementComponent->TryClimbAction(EClimbAction::ClimbDownLedge);
+		break;
+
+	case ESoakAction::Vault:
+		CustomMovementComponent->TryClimbAction(EClimbAction::Vault);
+		break;
+
+	case ESoakAction::HopUp:
+		CustomMovementComponent->TryClimbAction(EClimbAction::HopUp);
+		break;
+
+	case ESoakAction::HopDown:
+		CustomMovementComponent->TryClimbAction(EClimbAction::HopDown);
+		break;
+
+	case ESoakAction::HopLeft:
+		CustomMovementComponent->TryClimbAction(EClimbAction::HopLeft);
+		break;
+
+	case ESoakAction::HopRight:
+		CustomMovementComponent->TryClimbAction(EClimbAction::HopRight);
+		break;
+
+	// 아래 세 가지는 동작 재생 여부를 확인하지 않는 플레이어 입력 경로
+	case ESoakAction::ToggleClimbOn:
+		CustomMovementComponent->ToggleClimbing(true);
+		break;
+
+	case ESoakAction::ToggleClimbOff:
+		CustomMovementComponent->ToggleClimbing(false);
+		break;
+
+	case ESoakAction::RequestHop:
+		CustomMovementComponent->RequestHopping();
+		break;
+
+	case ESoakAction::Jump:
+		ControlledCharacter->Jump();
+		break;
+
+	default:
+		break;
+	}
+
+	RecordAction(Action);
+
+	// 아래쪽도 포함한 임의 방향 (지상: 월드 XY, 등반 중: 표면 기준)
+	const float Heading = RandomStream.FRandRange(0.f, UE_TWO_PI);
+	MoveInput = RandomStream.FRand() < 0.2f ? FVector2D::ZeroVector : FVector2D(FMath::Cos(Heading), FMath::Sin(Heading));
+}
+
+void AClimbSoakBotController::RecordAction(ESoakAction Action)
+{
+	++NumActions;
+
+	if (RecentActions.Num() < MaxRecentActions)
+	{
+		RecentActions.Add(Action);
+		return;
+	}
+
+	RecentActions[NextRecentActionIndex] = Action;
+	NextRecentActionIndex = (NextRecentActionIndex + 1) % MaxRecentActions;
+}
+
+const TCHAR* AClimbSoakBotController::GetActionName(ESoakAction Action)
+{
+	switch (Action)
+	{
+	case ESoakAction::EnterClimb:		return TEXT("EnterClimb");
+	case ESoakAction::TopOut:			return TEXT("TopOut");
+	case ESoakAction::ClimbDownLedge:	return TEXT("ClimbDownLedge");
+	case ESoakAction::Vault:			return TEXT("Vault");
+	case ESoakAction::HopUp:			return TEXT("HopUp");
+	case ESoakAction::HopDown:			return TEXT("HopDown");
+	case ESoakAction::HopLeft:			return TEXT("HopLeft");
+	case ESoakAction::HopRight:			return TEXT("HopRight");
+	case ESoakAction::ToggleClimbOn:	return TEXT("ToggleClimbOn");
+	case ESoakAction::ToggleClimbOff:	return TEXT("ToggleClimbOff");
+	case ESoakAction::RequestHop:		return TEXT("RequestHop");
+	case ESoakAction::Jump:				return TEXT("Jump");
+	default:							return TEXT("Idle");
+	}
+}
@@ -0,0 +1,310 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Benchmark/ClimbSoakGameMode.h"
+
+#include "ClimbingSystem.h"
+#include "TimerManager.h"
+#include "Benchmark/ClimbSoakBotController.h"
+#include "Components/CustomMovementComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace ClimbSoak
+{
+	static constexpr int32 NumHistogramBuckets = 5000;
+	static const double ReportPercentiles[] = { 50.0, 90.0, 99.0, 99.9 };
+}
+
+void AClimbSoakGameMode::FSoakTickHistogram::Add(double Microseconds)
+{
+	if (Buckets.IsEmpty())
+	{
+		Buckets.SetNumZeroed(ClimbSoak::NumHistogramBuckets);
+	}
+
+	++Buckets[FMath::Clamp(FMath::FloorToInt32(Microseconds), 0, ClimbSoak::NumHistogramBuckets - 1)];
+	++NumSamples;
+	MaxMicroseconds = FMath::Max(MaxMicroseconds, Microseconds);
+}
+
+double AClimbSoakGameMode::FSoakTickHistogram::GetPercentile(double Percentile) const
+{
+	const uint64 TargetCount = FMath::CeilToInt64(NumSamples * Percentile / 100.0);
+	uint64 Count = 0;
+
+	for (int32 Bucket = 0; Bucket < Buckets.Num(); ++Bucket)
+	{
+		Count += Buckets[Bucket];
+
+		if (Count >= TargetCount)
+		{
+			// 상한 칸은 실제 최대값으로 대체
+			return Bucket == Buckets.Num() - 1 ? MaxMicroseconds : Bucket + 1.0;
+		}
+	}
+
+	return MaxMicroseconds;
+}
+
+AClimbSoakGameMode::AClimbSoakGameMode()
+{
+	BotControllerClass = AClimbSoakBotController::StaticClass();
+}
+
+void AClimbSoakGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+	Super::InitGame(MapName, Options, ErrorMessage);
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("ClimbSoakSeconds="), SoakSeconds);
+	FParse::Value(CommandLine, TEXT("ClimbSoakOutlierMs="), OutlierTickMs);
+	bExitWhenSoakFinished = FParse::Param(CommandLine, TEXT("ClimbSoakExit"));
+}
+
+void AClimbSoakGameMode::StartPlay()
+{
+	Super::StartPlay();
+
+	if (GetBots().IsEmpty())
+	{
+		return;
+	}
+
+	FrameRandom.Initialize(GetBotSeed());
+
+	// 고정 델타 타임은 대기 없이 바로 다음 프레임을 돌리므로 헤드리스에서 많은 시퀀스를 빠르게 소화함
+	bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+	PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+	RandomizeNextFrameTime();
+
+	SoakPostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::OnSoakPostActorTick);
+	GetWorldTimerManager().SetTimer(SoakTimerHandle, this, &ThisClass::FinishSoak, SoakSeconds, false);
+
+	bSoakRunning = true;
+
+	UE_LOG(LogClimbingSystem, Display, TEXT("ClimbSoak: %d bots for %.0fs, frame time %.1f-%.1fms (seed %d)"),
+		GetBots().Num(), SoakSeconds, FrameSecondsRange.X * 1000.f, FrameSecondsRange.Y * 1000.f, GetBotSeed());
+}
+
+void AClimbSoakGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// 중간에 종료돼도 지금까지의 결과는 남김
+	if (bSoakRunning)
+	{
+		FinishSoak();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AClimbSoakGameMode::OnSoakPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	const TArray<TObjectPtr<AClimbBotController>>& Bots = GetBots();
+	BotStates.SetNum(Bots.Num());
+
+	for (int32 BotIndex = 0; BotIndex < Bots.Num(); ++BotIndex)
+	{
+		if (AClimbSoakBotController* Bot = Cast<AClimbSoakBotController>(Bots[BotIndex]))
+		{
+			SampleBot(BotIndex, Bot, DeltaSeconds);
+		}
+	}
+
+	++NumSampledFrames;
+	RandomizeNextFrameTime();
+}
+
+void AClimbSoakGameMode::SampleBot(int32 BotIndex, AClimbSoakBotController* Bot, float DeltaSeconds)
+{
+	const ACharacter* BotCharacter = Cast<ACharacter>(Bot->GetPawn());
+	const UCustomMovementComponent* Movement = BotCharacter ? Cast<UCustomMovementComponent>(BotCharacter->GetCharacterMovement()) : nullptr;
+
+	if (!Movement)
+	{
+		return;
+	}
+
+	FSoakBotState& BotState = BotStates[BotIndex];
+
+	// 잠든 틱은 이번 프레임에 실행되지 않았으므로 시간 분포에서 제외
+	if (!Movement->IsClimbTickSleeping())
+	{
+		const FName StateName = GetTickStateName(Movement);
+		const double TickMicroseconds = Movement->GetLastClimbTickSeconds() * 1000000.0;
+
+		TickHistograms.FindOrAdd(StateName).Add(TickMicroseconds);
+
+		if (TickMicroseconds >= OutlierTickMs * 1000.0)
+		{
+			++NumOutliers;
+
+			if (IssueLines.Num() < MaxIssueLines)
+			{
+				const FVector Location = BotCharacter->GetActorLocation();
+				IssueLines.Add(FString::Printf(TEXT("Outlier,%.2f,%d,%d,%s,%.1f,%.0f,%.0f,%.0f,\"%s\""),
+					GetWorld()->GetTimeSeconds(), BotIndex, Bot->GetSeed(), *StateName.ToString(), TickMicroseconds,
+					Location.X, Location.Y, Location.Z, *Bot->GetRecentActionsString()));
+			}
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	FString Failure;
+	if (!Movement->ValidateClimbState(Failure))
+	{
+		ReportFailure(BotIndex, Bot, Failure);
+	}
+#endif
+
+	// 끝나지 않는 동작 / 낙하는 멈춘 상태로 기록 (상태가 풀릴 때까지 한 번만)
+	BotState.ActionPlayingSeconds = Movement->IsClimbActionPlaying() ? BotState.ActionPlayingSeconds + DeltaSeconds : 0.f;
+	BotState.FallingSeconds = Movement->IsFalling() ? BotState.FallingSeconds + DeltaSeconds : 0.f;
+
+	const bool bStuck = BotState.ActionPlayingSeconds > MaxActionSeconds || BotState.FallingSeconds > MaxFallingSeconds;
+
+	if (bStuck && !BotState.bStuckReported)
+	{
+		ReportFailure(BotIndex, Bot, BotState.ActionPlayingSeconds > MaxActionSeconds
+			? FString::Printf(TEXT("climb action did not finish in %.1fs"), BotState.ActionPlayingSeconds)
+			: FString::Printf(TEXT("falling for %.1fs"), BotState.FallingSeconds));
+	}
+
+	BotState.bStuckReported = bStuck;
+}
+
+void AClimbSoakGameMode::ReportFailure(int32 BotIndex, const AClimbSoakBotController* Bot, const FString& Reason)
+{
+	++NumFailures;
+
+	FSoakBotState& BotState = BotStates[BotIndex];
+	if (++BotState.NumFailures > MaxFailuresPerBot)
+	{
+		return;
+	}
+
+	const FVector Location = Bot->GetPawn()->GetActorLocation();
+
+	UE_LOG(LogClimbingSystem, Warning, TEXT("ClimbSoak: bot %d (seed %d) at %s: %s [%s]"),
+		BotIndex, Bot->GetSeed(), *Location.ToCompactString(), *Reason, *Bot->GetRecentActionsString());
+
+	if (IssueLines.Num() < MaxIssueLines)
+	{
+		IssueLines.Add(FString::Printf(TEXT("Failure,%.2f,%d,%d,\"%s\",,%.0f,%.0f,%.0f,\"%s\""),
+			GetWorld()->GetTimeSeconds(), BotIndex, Bot->GetSeed(), *Reason,
+			Location.X, Location.Y, Location.Z, *Bot->GetRecentActionsString()));
+	}
+}
+
+void AClimbSoakGameMode::RandomizeNextFrameTime()
+{
+	const double NextFrameSeconds = FrameRandom.FRand() < HitchChance
+		? HitchSeconds
+		: FrameRandom.FRandRange(FrameSecondsRange.X, FrameSecondsRange.Y);
+
+	FApp::SetFixedDeltaTime(NextFrameSeconds);
+}
+
+void AClimbSoakGameMode::FinishSoak()
+{
+	if (!bSoakRunning)
+	{
+		return;
+	}
+
+	bSoakRunning = false;
+
+	FWorldDelegates::OnWorldPostActorTick.Remove(SoakPostActorTickHandle);
+	GetWorldTimerManager().ClearTimer(SoakTimerHandle);
+
+	FApp::SetUseFixedTimeStep(bPreviousUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+
+	WriteSoakReport();
+
+	if (bExitWhenSoakFinished)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("ClimbSoak"));
+	}
+}
+
+void AClimbSoakGameMode::WriteSoakReport()
+{
+	int64 NumActions = 0;
+	for (const AClimbBotController* Bot : GetBots())
+	{
+		if (const AClimbSoakBotController* SoakBot = Cast<AClimbSoakBotController>(Bot))
+		{
+			NumActions += SoakBot->GetNumActions();
+		}
+	}
+
+	TArray<FString> ReportLines;
+	ReportLines.Add(TEXT("State,Samples,P50us,P90us,P99us,P999us,MaxUs"));
+
+	for (const TPair<FName, FSoakTickHistogram>& Pair : TickHistograms)
+	{
+		const FSoakTickHistogram& Histogram = Pair.Value;
+
+		FString Line = FString::Printf(TEXT("%s,%llu"), *Pair.Key.ToString(), Histogram.NumSamples);
+		for (const double Percentile : ClimbSoak::ReportPercentiles)
+		{
+			Line += FString::Printf(TEXT(",%.0f"), Histogram.GetPercentile(Percentile));
+		}
+		Line += FString::Printf(TEXT(",%.1f"), Histogram.MaxMicroseconds);
+
+		ReportLines.Add(MoveTemp(Line));
+	}
+
+	const FString ReportDir = FPaths::ProjectSavedDir() / TEXT("ClimbSoak");
+	const FString Timestamp = FDateTime::Now().ToString();
+	const FString ReportPath = ReportDir / FString::Printf(TEXT("ClimbSoak-%s.csv"), *Timestamp);
+	const FString IssuesPath = ReportDir / FString::Printf(TEXT("ClimbSoak-%s-Issues.csv"), *Timestamp);
+
+	IssueLines.Insert(TEXT("Type,Time,Bot,Seed,Detail,TickUs,X,Y,Z,RecentActions"), 0);
+
+	FFileHelper::SaveStringArrayToFile(ReportLines, *ReportPath);
+	FFileHelper::SaveStringArrayToFile(IssueLines, *IssuesPath);
+
+	// 실패가 있으면 에러로 남겨 배치 작업의 로그 검사에 걸리게 함
+	if (NumFailures > 0)
+	{
+		UE_LOG(LogClimbingSystem, Error, TEXT("ClimbSoak: %lld frames, %lld bot actions, %d invariant/stuck failures, %d tick outliers (>= %.2fms)"),
+			NumSampledFrames, NumActions, NumFailures, NumOutliers, OutlierTickMs);
+	}
+	else
+	{
+		UE_LOG(LogClimbingSystem, Display, TEXT("ClimbSoak: %lld frames, %lld bot actions, no failures, %d tick outliers (>= %.2fms)"),
+			NumSampledFrames, NumActions, NumOutliers, OutlierTickMs);
+	}
+	UE_LOG(LogClimbingSystem, Display, TEXT("ClimbSoak: report written to %s"), *ReportPath);
+
+	IssueLines.Reset();
+}
+
+FName AClimbSoakGameMode::GetTickStateName(const UCustomMovementComponent* Movement)
+{
+	FString StateName = Movement->IsClimbing() ? TEXT("Climb") : Movement->GetMovementName();
+
+	if (Movement->IsClimbActionPlaying())
+	{
+		StateName += TEXT("+Action");
+	}
+
+	if (Movement->IsInCornerTransition())
+	{
+		StateName += TEXT("+Corner");
+	}
+
+	return FName(*StateName);
+}
@@ -0,0 +1,130 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Climbing/ClimbAsyncPhysics.h"
+
+namespace ClimbAsync
+{
+	/** 제거 입력이 유실돼도 물리 스레드 상태가 남지 않도록, 이 시간 동안 입력이 없는 등반자는 정리 */
+	static constexpr float StaleClimberSeconds = 2.f;
+
+	/** CheckHasReachedFloor / CheckHasReachedLedge 의 이동 방향 임계값 */
+	static constexpr float MinVerticalSpeed = 10.f;
+
+	/** GetClimbRotation 의 회전 보간 속도 */
+	static constexpr float RotationInterpSpeed = 5.f;
+}
+
+void FClimbAsyncSimCallback::OnPreSimulate_Internal()
+{
+	const float DeltaTime = GetDeltaTime_Internal();
+	const float SimTime = GetSimTime_Internal();
+
+	// 입력이 없는 스텝(게임 스레드가 더 느린 경우)은 마지막 입력으로 계속 시뮬레이션
+	if (const FClimbAsyncInput* Input = GetConsumerInput_Internal())
+	{
+		for (const uint32 RemovedClimber : Input->RemovedClimbers)
+		{
+			Climbers.Remove(RemovedClimber);
+		}
+
+		for (const FClimbAsyncClimberInput& ClimberInput : Input->Climbers)
+		{
+			FClimberState* State = Climbers.Find(ClimberInput.ClimberId);
+			const bool bReset = !State || State->Input.ResetSerial != ClimberInput.ResetSerial;
+
+			if (!State)
+			{
+				State = &Climbers.Add(ClimberInput.ClimberId);
+			}
+
+			State->Input = ClimberInput;
+			State->LastInputTime = SimTime;
+
+			if (bReset)
+			{
+				State->Location = ClimberInput.Location;
+				State->Rotation = ClimberInput.Rotation;
+				State->Velocity = ClimberInput.Velocity;
+				State->Transition = EClimbAsyncTransition::None;
+			}
+		}
+	}
+
+	FClimbAsyncOutput& Output = GetProducerOutputData_Internal();
+
+	for (auto It = Climbers.CreateIterator(); It; ++It)
+	{
+		FClimberState& State = It.Value();
+
+		if (SimTime - State.LastInputTime > ClimbAsync::StaleClimberSeconds)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		SimulateClimber(State, DeltaTime);
+
+		FClimbAsyncClimberOutput& ClimberOutput = Output.Climbers.AddDefaulted_GetRef();
+		ClimberOutput.ClimberId = It.Key();
+		ClimberOutput.ResetSerial = State.Input.ResetSerial;
+		ClimberOutput.Location = State.Location;
+		ClimberOutput.Rotation = State.Rotation;
+		ClimberOutput.Velocity = State.Velocity;
+		ClimberOutput.Transition = State.Transition;
+	}
+}
+
+/**
+ * @brief PhysClimb 의 이동 / 밀착 / 회전 / 바닥 · 렛지 판정을 표면 모델 위에서 한 스텝 수행
+ *
+ * 충돌 처리는 게임 스레드가 결과 위치로 스윕 이동할 때 수행한다.
+ */
+void FClimbAsyncSimCallback::SimulateClimber(FClimberState& State, float DeltaTime)
+{
+	// 전환이 결정되면 게임 스레드가 처리할 때까지 정지
+	if (State.Transition != EClimbAsyncTransition::None || DeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	const FClimbAsyncClimberInput& Input = State.Input;
+
+	// CalcVelocity (마찰 0, 등반 감속) 와 같은 가감속
+	if (!Input.InputAcceleration.IsNearlyZero())
+	{
+		State.Velocity = (State.Velocity + Input.InputAcceleration * DeltaTime).GetClampedToMaxSize(Input.MaxSpeed);
+	}
+	else
+	{
+		const float Speed = State.Velocity.Size();
+		const float NewSpeed = FMath::Max(Speed - Input.BrakingDeceleration * DeltaTime, 0.f);
+		State.Velocity = Speed > UE_KINDA_SMALL_NUMBER ? State.Velocity * (NewSpeed / Speed) : FVector::ZeroVector;
+	}
+
+	State.Location += State.Velocity * DeltaTime;
+
+	// SnapMovementToClimbableSurfaces: 게임 스레드에서는 스윕이 벽에서 멈추므로 여기서는 캡슐 반지름만큼 남기고 제한
+	const FVector Forward = State.Rotation.GetForwardVector();
+	const float DistanceToSurface = (Input.SurfaceLocation - State.Location).ProjectOnTo(Forward).Size();
+	const float SnapDistance = FMath::Min(DistanceToSurface * DeltaTime * Input.SnapSpeed, FMath::Max(DistanceToSurface - Input.CapsuleRadius, 0.f));
+	State.Location -= Input.SurfaceNormal * SnapDistance;
+
+	const FQuat TargetRotation = FRotationMatrix::MakeFromX(-Input.SurfaceNormal).ToQuat();
+	State.Rotation = FMath::QInterpTo(State.Rotation, TargetRotation, DeltaTime, ClimbAsync::RotationInterpSpeed);
+
+	const float VerticalSpeed = FVector::DotProduct(State.Velocity, State.Rotation.GetUpVector());
+
+	if (VerticalSpeed < -ClimbAsync::MinVerticalSpeed && Input.bHasFloor && State.Location.Z - Input.FloorHeight <= Input.FloorReachDistance)
+	{
+		State.Transition = EClimbAsyncTransition::ReachedFloor;
+		return;
+	}
+
+	const float EyeHeightAboveLedge = State.Location.Z + Input.EyeHeight - Input.LedgeTopHeight;
+
+	if (VerticalSpeed > ClimbAsync::MinVerticalSpeed && Input.bHasLedge && Input.bLedgeCapable && EyeHeightAboveLedge > 0.f && EyeHeightAboveLedge <= Input.LedgeReachDistance)
+	{
+		State.Transition = EClimbAsyncTransition::TopOut;
+	}
+}
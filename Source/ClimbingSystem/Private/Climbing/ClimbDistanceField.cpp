@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Climbing/ClimbDistanceField.h"
+
+void FClimbDistanceField::Reset(float InVoxelSize, float InMaxDistance)
+{
+	VoxelSize = FMath::Max(InVoxelSize, 1.f);
+	MaxDistance = FMath::Max(InMaxDistance, VoxelSize);
+	BrickIndices.Reset();
+	BrickData.Reset();
+}
+
+FIntVector FClimbDistanceField::GetBrickCoord(const FVector& WorldLocation) const
+{
+	const FVector BrickLocation = WorldLocation / GetBrickSize();
+	return FIntVector(FMath::FloorToInt(BrickLocation.X), FMath::FloorToInt(BrickLocation.Y), FMath::FloorToInt(BrickLocation.Z));
+}
+
+FVector FClimbDistanceField::GetSampleLocation(const FIntVector& BrickCoord, int32 X, int32 Y, int32 Z) const
+{
+	return FVector(BrickCoord) * GetBrickSize() + FVector(X, Y, Z) * VoxelSize;
+}
+
+uint8 FClimbDistanceField::QuantizeDistance(float Distance) const
+{
+	return static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Distance / MaxDistance * 0.5f + 0.5f, 0.f, 1.f) * 255.f));
+}
+
+void FClimbDistanceField::AddBrick(const FIntVector& BrickCoord, TArrayView<const uint8> QuantizedSamples)
+{
+	check(QuantizedSamples.Num() == SamplesPerBrick);
+
+	int32& BrickIndex = BrickIndices.FindOrAdd(BrickCoord, INDEX_NONE);
+	if (BrickIndex == INDEX_NONE)
+	{
+		BrickIndex = BrickData.Num() / SamplesPerBrick;
+		BrickData.AddUninitialized(SamplesPerBrick);
+	}
+
+	FMemory::Memcpy(&BrickData[BrickIndex * SamplesPerBrick], QuantizedSamples.GetData(), SamplesPerBrick);
+}
+
+bool FClimbDistanceField::Sample(const FVector& WorldLocation, float& OutDistance, FVector& OutGradient) const
+{
+	const FIntVector BrickCoord = GetBrickCoord(WorldLocation);
+	const int32* BrickIndex = BrickIndices.Find(BrickCoord);
+	if (!BrickIndex)
+	{
+		return false;
+	}
+
+	// 브릭 안 셀 좌표와 셀 안 비율
+	const FVector LocalVoxel = (WorldLocation - FVector(BrickCoord) * GetBrickSize()) / VoxelSize;
+	const int32 X = FMath::Clamp(FMath::FloorToInt(LocalVoxel.X), 0, BrickResolution - 1);
+	const int32 Y = FMath::Clamp(FMath::FloorToInt(LocalVoxel.Y), 0, BrickResolution - 1);
+	const int32 Z = FMath::Clamp(FMath::FloorToInt(LocalVoxel.Z), 0, BrickResolution - 1);
+	const float FX = FMath::Clamp(LocalVoxel.X - X, 0.f, 1.f);
+	const float FY = FMath::Clamp(LocalVoxel.Y - Y, 0.f, 1.f);
+	const float FZ = FMath::Clamp(LocalVoxel.Z - Z, 0.f, 1.f);
+
+	const uint8* Brick = &BrickData[*BrickIndex * SamplesPerBrick];
+	const float Scale = 2.f * MaxDistance / 255.f;
+	const float Offset = MaxDistance;
+
+	auto Fetch = [Brick, Scale, Offset, X, Y, Z](int32 DX, int32 DY, int32 DZ)
+	{
+		return Brick[GetSampleIndex(X + DX, Y + DY, Z + DZ)] * Scale - Offset;
+	};
+
+	const float C000 = Fetch(0, 0, 0), C100 = Fetch(1, 0, 0), C010 = Fetch(0, 1, 0), C110 = Fetch(1, 1, 0);
+	const float C001 = Fetch(0, 0, 1), C101 = Fetch(1, 0, 1), C011 = Fetch(0, 1, 1), C111 = Fetch(1, 1, 1);
+
+	const float C00 = FMath::Lerp(C000, C100, FX);
+	const float C10 = FMath::Lerp(C010, C110, FX);
+	const float C01 = FMath::Lerp(C001, C101, FX);
+	const float C11 = FMath::Lerp(C011, C111, FX);
+	const float C0 = FMath::Lerp(C00, C10, FY);
+	const float C1 = FMath::Lerp(C01, C11, FY);
+
+	OutDistance = FMath::Lerp(C0, C1, FZ);
+
+	// 삼선형 보간식의 축별 편미분
+	const float DX = FMath::Lerp(FMath::Lerp(C100 - C000, C110 - C010, FY), FMath::Lerp(C101 - C001, C111 - C011, FY), FZ);
+	const float DY = FMath::Lerp(C10 - C00, C11 - C01, FZ);
+	const float DZ = C1 - C0;
+	OutGradient = FVector(DX, DY, DZ) / VoxelSize;
+
+	return true;
+}
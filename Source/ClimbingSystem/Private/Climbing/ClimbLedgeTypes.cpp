@@ -0,0 +1,106 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Climbing/ClimbLedgeTypes.h"
+
+#include "Algo/BinarySearch.h"
+
+void FClimbLedgePolyline::Finalize()
+{
+	CumulativeLengths.Reset(Points.Num() + 1);
+	CumulativeLengths.Add(0.f);
+
+	for (int32 SegmentIndex = 0; SegmentIndex < GetNumSegments(); ++SegmentIndex)
+	{
+		const FVector& Start = Points[SegmentIndex];
+		const FVector& End = Points[(SegmentIndex + 1) % Points.Num()];
+		CumulativeLengths.Add(CumulativeLengths.Last() + FVector::Dist(Start, End));
+	}
+}
+
+float FClimbLedgePolyline::NormalizeDistance(float Distance) const
+{
+	const float Length = GetLength();
+	if (Length <= UE_KINDA_SMALL_NUMBER)
+	{
+		return 0.f;
+	}
+
+	if (bClosedLoop)
+	{
+		const float Wrapped = FMath::Fmod(Distance, Length);
+		return Wrapped < 0.f ? Wrapped + Length : Wrapped;
+	}
+
+	return FMath::Clamp(Distance, 0.f, Length);
+}
+
+void FClimbLedgePolyline::Evaluate(float Distance, float CornerBlendDistance, FVector& OutLocation, FVector& OutNormal, FVector& OutTangent) const
+{
+	const int32 NumSegments = GetNumSegments();
+	if (NumSegments <= 0)
+	{
+		OutLocation = Points.Num() > 0 ? Points[0] : FVector::ZeroVector;
+		OutNormal = FVector::ForwardVector;
+		OutTangent = FVector::RightVector;
+		return;
+	}
+
+	Distance = NormalizeDistance(Distance);
+
+	// 누적 거리에서 세그먼트 이분 탐색
+	const int32 SegmentIndex = FMath::Clamp(Algo::UpperBound(CumulativeLengths, Distance) - 1, 0, NumSegments - 1);
+	const FVector& Start = Points[SegmentIndex];
+	const FVector& End = Points[(SegmentIndex + 1) % Points.Num()];
+	const float SegmentStart = CumulativeLengths[SegmentIndex];
+	const float SegmentLength = CumulativeLengths[SegmentIndex + 1] - SegmentStart;
+	const float DistanceInSegment = Distance - SegmentStart;
+
+	OutTangent = (End - Start).GetSafeNormal();
+	OutLocation = Start + OutTangent * DistanceInSegment;
+	OutNormal = SegmentNormals[SegmentIndex];
+
+	if (CornerBlendDistance <= 0.f)
+	{
+		return;
+	}
+
+	// 꼭짓점 근처에서는 이웃 세그먼트 법선과 절반씩 섞음 (꼭짓점에서 정확히 중간 방향)
+	const bool bHasPrevious = bClosedLoop || SegmentIndex > 0;
+	const bool bHasNext = bClosedLoop || SegmentIndex < NumSegments - 1;
+
+	if (bHasPrevious && DistanceInSegment < CornerBlendDistance)
+	{
+		const FVector& PreviousNormal = SegmentNormals[(SegmentIndex - 1 + NumSegments) % NumSegments];
+		const float Alpha = 0.5f * (1.f - DistanceInSegment / CornerBlendDistance);
+		OutNormal = FMath::Lerp(OutNormal, PreviousNormal, Alpha).GetSafeNormal();
+	}
+	else if (bHasNext && SegmentLength - DistanceInSegment < CornerBlendDistance)
+	{
+		const FVector& NextNormal = SegmentNormals[(SegmentIndex + 1) % NumSegments];
+		const float Alpha = 0.5f * (1.f - (SegmentLength - DistanceInSegment) / CornerBlendDistance);
+		OutNormal = FMath::Lerp(OutNormal, NextNormal, Alpha).GetSafeNormal();
+	}
+}
+
+float FClimbLedgePolyline::FindClosestDistance(const FVector& LocalLocation, float& OutDistanceSquared) const
+{
+	float BestDistance = 0.f;
+	OutDistanceSquared = TNumericLimits<float>::Max();
+
+	for (int32 SegmentIndex = 0; SegmentIndex < GetNumSegments(); ++SegmentIndex)
+	{
+		const FVector& Start = Points[SegmentIndex];
+		const FVector& End = Points[(SegmentIndex + 1) % Points.Num()];
+		const FVector ClosestPoint = FMath::ClosestPointOnSegment(LocalLocation, Start, End);
+		const float DistanceSquared = FVector::DistSquared(LocalLocation, ClosestPoint);
+
+		if (DistanceSquared < OutDistanceSquared)
+		{
+			OutDistanceSquared = DistanceSquared;
+			BestDistance = CumulativeLengths[SegmentIndex] + FVector::Dist(Start, ClosestPoint);
+		}
+	}
+
+	return BestDistance;
+}
@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Climbing/ClimbProfileDataAsset.h"
+
+#include "Animation/AnimMontage.h"
+
+const FPrimaryAssetType UClimbProfileDataAsset::ClimbProfileAssetType(TEXT("ClimbProfile"));
+
+const TSoftObjectPtr<UAnimMontage>& FClimbMontageSet::GetMontage(EClimbAction Action) const
+{
+	switch (Action)
+	{
+	case EClimbAction::EnterClimb:		return IdleToClimbMontage;
+	case EClimbAction::TopOut:			return ClimbToTopMontage;
+	case EClimbAction::ClimbDownLedge:	return ClimbDownLedgeMontage;
+	case EClimbAction::Vault:			return VaultMontage;
+	case EClimbAction::HopUp:			return HopUpMontage;
+	case EClimbAction::HopDown:			return HopDownMontage;
+	case EClimbAction::HopLeft:			return HopLeftMontage;
+	case EClimbAction::HopRight:		return HopRightMontage;
+	case EClimbAction::LedgeCatch:		return LedgeCatchMontage;
+	case EClimbAction::ShimmyDrop:		return ShimmyDropMontage;
+	case EClimbAction::HopUpLeft:		return HopUpLeftMontage;
+	case EClimbAction::HopUpRight:		return HopUpRightMontage;
+	case EClimbAction::HopDownLeft:		return HopDownLeftMontage;
+	case EClimbAction::HopDownRight:	return HopDownRightMontage;
+	}
+
+	checkNoEntry();
+	return IdleToClimbMontage;
+}
+
+TSoftObjectPtr<UAnimMontage>& FClimbMontageSet::GetMontage(EClimbAction Action)
+{
+	return const_cast<TSoftObjectPtr<UAnimMontage>&>(static_cast<const FClimbMontageSet&>(*this).GetMontage(Action));
+}
+
+void FClimbMontageSet::Override(const FClimbMontageSet& Other)
+{
+	for (const EClimbAction Action : TEnumRange<EClimbAction>())
+	{
+		if (!Other.GetMontage(Action).IsNull())
+		{
+			GetMontage(Action) = Other.GetMontage(Action);
+		}
+	}
+}
+
+FPrimaryAssetId UClimbProfileDataAsset::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(ClimbProfileAssetType, GetFName());
+}
+
+FClimbMontageSet UClimbProfileDataAsset::ResolveMontages(FName Variant) const
+{
+	FClimbMontageSet ResolvedMontages = Montages;
+
+	if (const FClimbMontageSet* VariantMontages = MontageVariants.Find(Variant))
+	{
+		ResolvedMontages.Override(*VariantMontages);
+	}
+
+	return ResolvedMontages;
+}
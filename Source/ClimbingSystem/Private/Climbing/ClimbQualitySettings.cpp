@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Climbing/ClimbQualitySettings.h"
+
+#include "ClimbingSystem.h"
+#include "Components/CustomMovementComponent.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/ConfigUtilities.h"
+#include "UObject/UObjectIterator.h"
+
+namespace ClimbQuality
+{
+	static void OnClimbingQualityGroupChanged(IConsoleVariable* Variable)
+	{
+		// 엔진 sg.* 그룹과 같은 방식으로 해당 단계의 섹션을 적용
+		UE::ConfigUtilities::ApplyCVarSettingsGroupFromIni(TEXT("ClimbingQuality"), Variable->GetInt(), *GScalabilityIni, ECVF_SetByScalability);
+	}
+
+	static TAutoConsoleVariable<int32> CVarClimbingQuality(
+		TEXT("sg.ClimbingQuality"),
+		3,
+		TEXT("등반 품질 스케일러빌리티 단계 (0 = 낮음, 1 = 중간, 2 = 높음, 3 = 에픽)"),
+		FConsoleVariableDelegate::CreateStatic(&OnClimbingQualityGroupChanged),
+		ECVF_ScalabilityGroup);
+
+	static TAutoConsoleVariable<float> CVarReprobeScale(
+		TEXT("climb.Quality.ReprobeScale"),
+		1.f,
+		TEXT("등반 표면 재프로브 거리 / 각도 배율 (클수록 트레이스를 덜 함)"),
+		ECVF_Scalability);
+
+	static TAutoConsoleVariable<float> CVarIdleTickIntervalScale(
+		TEXT("climb.Quality.IdleTickIntervalScale"),
+		1.f,
+		TEXT("매달려 정지한 동안의 이동 컴포넌트 틱 간격 배율"),
+		ECVF_Scalability);
+
+	static TAutoConsoleVariable<bool> CVarHopPrefetch(
+		TEXT("climb.Quality.HopPrefetch"),
+		true,
+		TEXT("홉 후보를 비동기 트레이스로 미리 찾아둘지 여부 (끄면 홉 요청 시 필요한 방향만 동기 트레이스)"),
+		ECVF_Scalability);
+
+	static TAutoConsoleVariable<bool> CVarCapsuleSurfaceProbes(
+		TEXT("climb.Quality.CapsuleSurfaceProbes"),
+		true,
+		TEXT("벽면 프로브를 캡슐 스윕으로 할지 여부 (끄면 캡슐 높이 세 곳의 라인 트레이스)"),
+		ECVF_Scalability);
+
+	static TAutoConsoleVariable<float> CVarCapsuleTraceScale(
+		TEXT("climb.Quality.CapsuleTraceScale"),
+		1.f,
+		TEXT("벽면 프로브 캡슐 반지름 / 반높이 배율"),
+		ECVF_Scalability);
+
+	static TAutoConsoleVariable<float> CVarSurfaceFitResweepScale(
+		TEXT("climb.Quality.SurfaceFitResweepScale"),
+		1.f,
+		TEXT("거리장 표면 추종 중 다시 스윕하기까지의 거리 배율"),
+		ECVF_Scalability);
+
+	static FClimbQualitySettings CurrentSettings;
+
+	static FClimbQualitySettings ReadSettings()
+	{
+		FClimbQualitySettings Settings;
+		Settings.ReprobeScale = FMath::Max(CVarReprobeScale.GetValueOnGameThread(), 0.f);
+		Settings.IdleTickIntervalScale = FMath::Max(CVarIdleTickIntervalScale.GetValueOnGameThread(), 0.f);
+		Settings.bHopPrefetch = CVarHopPrefetch.GetValueOnGameThread();
+		Settings.bCapsuleSurfaceProbes = CVarCapsuleSurfaceProbes.GetValueOnGameThread();
+		Settings.CapsuleTraceScale = FMath::Max(CVarCapsuleTraceScale.GetValueOnGameThread(), 0.1f);
+		Settings.SurfaceFitResweepScale = FMath::Max(CVarSurfaceFitResweepScale.GetValueOnGameThread(), 0.f);
+		return Settings;
+	}
+
+	/** 어떤 CVar 든 바뀐 프레임 끝에 호출됨 */
+	static void OnConsoleVariablesChanged()
+	{
+		const FClimbQualitySettings NewSettings = ReadSettings();
+		if (NewSettings == CurrentSettings)
+		{
+			return;
+		}
+
+		CurrentSettings = NewSettings;
+
+		UE_LOG(LogClimbingSystem, Log, TEXT("Climbing quality changed (sg.ClimbingQuality=%d)"), CVarClimbingQuality.GetValueOnGameThread());
+
+		for (TObjectIterator<UCustomMovementComponent> It; It; ++It)
+		{
+			if (!It->IsTemplate() && It->IsRegistered())
+			{
+				It->OnClimbQualityChanged();
+			}
+		}
+	}
+
+	static FAutoConsoleVariableSink CVarSink(FConsoleCommandDelegate::CreateStatic(&OnConsoleVariablesChanged));
+}
+
+const FClimbQualitySettings& FClimbQualitySettings::Get()
+{
+	return ClimbQuality::CurrentSettings;
+}
@@ -0,0 +1,211 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Climbing/ClimbRootMotionSource.h"
+
+#include "AnimNotifyState_MotionWarping.h"
+#include "RootMotionModifier.h"
+#include "Animation/AnimMontage.h"
+#include "GameFramework/Character.h"
+
+FVector FClimbBakedRootMotion::GetTranslationAtTime(float Time) const
+{
+	if (Translations.IsEmpty())
+	{
+		return FVector::ZeroVector;
+	}
+
+	const float SamplePosition = FMath::Clamp(Time, 0.f, Duration) / SampleInterval;
+	const int32 SampleIndex = FMath::Min(FMath::FloorToInt32(SamplePosition), Translations.Num() - 1);
+	const int32 NextSampleIndex = FMath::Min(SampleIndex + 1, Translations.Num() - 1);
+
+	return FMath::Lerp(Translations[SampleIndex], Translations[NextSampleIndex], SamplePosition - SampleIndex);
+}
+
+namespace ClimbRootMotion
+{
+	static TMap<TObjectKey<UAnimMontage>, FClimbBakedRootMotion> BakedMontages;
+
+	static void Bake(const UAnimMontage* Montage, FClimbBakedRootMotion& OutBaked)
+	{
+		OutBaked.Duration = Montage->GetPlayLength();
+
+		const int32 NumSamples = FMath::CeilToInt32(OutBaked.Duration / OutBaked.SampleInterval) + 1;
+		OutBaked.Translations.Reserve(NumSamples);
+
+		const FAnimExtractContext ExtractContext(0.0, true);
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			const float SampleTime = FMath::Min(SampleIndex * OutBaked.SampleInterval, OutBaked.Duration);
+			OutBaked.Translations.Add(Montage->ExtractRootMotionFromTrackRange(0.f, SampleTime, ExtractContext).GetTranslation());
+		}
+
+		for (const FAnimNotifyEvent& NotifyEvent : Montage->Notifies)
+		{
+			const UAnimNotifyState_MotionWarping* WarpingNotify = Cast<UAnimNotifyState_MotionWarping>(NotifyEvent.NotifyStateClass);
+			const URootMotionModifier_Warp* WarpModifier = WarpingNotify ? Cast<URootMotionModifier_Warp>(WarpingNotify->RootMotionModifier) : nullptr;
+
+			if (WarpModifier)
+			{
+				OutBaked.WarpWindows.Add({ WarpModifier->WarpTargetName, NotifyEvent.GetTriggerTime(), NotifyEvent.GetEndTriggerTime() });
+			}
+		}
+
+		OutBaked.WarpWindows.Sort([](const FClimbBakedRootMotion::FWarpWindow& A, const FClimbBakedRootMotion::FWarpWindow& B) { return A.StartTime < B.StartTime; });
+	}
+
+	const FClimbBakedRootMotion* FindOrBake(const UAnimMontage* Montage)
+	{
+		check(IsInGameThread());
+
+		if (!Montage || Montage->GetPlayLength() <= 0.f)
+		{
+			return nullptr;
+		}
+
+		if (const FClimbBakedRootMotion* Baked = BakedMontages.Find(Montage))
+		{
+			return Baked;
+		}
+
+		FClimbBakedRootMotion& Baked = BakedMontages.Add(Montage);
+		Bake(Montage, Baked);
+		return &Baked;
+	}
+}
+
+FRootMotionSource_ClimbTransition::FRootMotionSource_ClimbTransition()
+{
+	AccumulateMode = ERootMotionAccumulateMode::Override;
+
+	// 끝나면 멈춘 상태로 다음 상태 (등반 / 걷기) 에 넘김
+	FinishVelocityParams.Mode = ERootMotionFinishVelocityMode::SetVelocity;
+	FinishVelocityParams.SetVelocity = FVector::ZeroVector;
+}
+
+void FRootMotionSource_ClimbTransition::ResolveWarpTargets(const FClimbBakedRootMotion& Baked, TFunctionRef<TOptional<FVector>(FName)> FindWarpTarget)
+{
+	WarpCorrections.Reset();
+	WarpCorrections.SetNumZeroed(Baked.WarpWindows.Num());
+
+	// 앞 구간의 보정이 반영된 궤적 기준으로 다음 구간의 보정량을 구함
+	for (int32 WindowIndex = 0; WindowIndex < Baked.WarpWindows.Num(); ++WindowIndex)
+	{
+		const FClimbBakedRootMotion::FWarpWindow& Window = Baked.WarpWindows[WindowIndex];
+
+		if (const TOptional<FVector> WarpTarget = FindWarpTarget(Window.WarpTargetName))
+		{
+			WarpCorrections[WindowIndex] = WarpTarget.GetValue() - GetLocationAtTime(Baked, Window.EndTime);
+		}
+	}
+}
+
+void FRootMotionSource_ClimbTransition::ResolveEndLocation(const FClimbBakedRootMotion& Baked, const FVector& EndLocation)
+{
+	EndCorrection = FVector::ZeroVector;
+	EndCorrection = EndLocation - GetLocationAtTime(Baked, Baked.Duration);
+}
+
+FVector FRootMotionSource_ClimbTransition::GetLocationAtTime(const FClimbBakedRootMotion& Baked, float Time) const
+{
+	FVector Location = StartLocation + RootMotionRotation.RotateVector(Baked.GetTranslationAtTime(Time));
+
+	for (int32 WindowIndex = 0; WindowIndex < WarpCorrections.Num() && WindowIndex < Baked.WarpWindows.Num(); ++WindowIndex)
+	{
+		const FClimbBakedRootMotion::FWarpWindow& Window = Baked.WarpWindows[WindowIndex];
+		const float WindowLength = FMath::Max(Window.EndTime - Window.StartTime, UE_KINDA_SMALL_NUMBER);
+		Location += WarpCorrections[WindowIndex] * FMath::Clamp((Time - Window.StartTime) / WindowLength, 0.f, 1.f);
+	}
+
+	if (Baked.Duration > UE_SMALL_NUMBER)
+	{
+		Location += EndCorrection * FMath::Clamp(Time / Baked.Duration, 0.f, 1.f);
+	}
+
+	return Location;
+}
+
+FRootMotionSource* FRootMotionSource_ClimbTransition::Clone() const
+{
+	return new FRootMotionSource_ClimbTransition(*this);
+}
+
+bool FRootMotionSource_ClimbTransition::Matches(const FRootMotionSource* Other) const
+{
+	if (!FRootMotionSource::Matches(Other))
+	{
+		return false;
+	}
+
+	// FRootMotionSource::Matches 가 같은 ScriptStruct 인지 확인
+	const FRootMotionSource_ClimbTransition* OtherCast = static_cast<const FRootMotionSource_ClimbTransition*>(Other);
+
+	return Montage == OtherCast->Montage
+		&& StartLocation.Equals(OtherCast->StartLocation, 1.f);
+}
+
+bool FRootMotionSource_ClimbTransition::MatchesAndHasSameState(const FRootMotionSource* Other) const
+{
+	return FRootMotionSource::MatchesAndHasSameState(Other) && Matches(Other);
+}
+
+bool FRootMotionSource_ClimbTransition::UpdateStateFrom(const FRootMotionSource* SourceToTakeStateFrom, bool bMarkForSimulatedCatchup)
+{
+	return FRootMotionSource::UpdateStateFrom(SourceToTakeStateFrom, bMarkForSimulatedCatchup);
+}
+
+void FRootMotionSource_ClimbTransition::PrepareRootMotion(float SimulationTime, float MovementTickTime, const ACharacter& Character, const UCharacterMovementComponent& MoveComponent)
+{
+	RootMotionParams.Clear();
+
+	const FClimbBakedRootMotion* Baked = ClimbRootMotion::FindOrBake(Montage);
+
+	if (Baked && Duration > UE_SMALL_NUMBER && MovementTickTime > UE_SMALL_NUMBER)
+	{
+		// FRootMotionSource_MoveToForce 와 같이 이번 틱 끝에 있어야 할 위치로 가는 속도를 구함
+		const float TargetTime = FMath::Min(GetTime() + SimulationTime, Duration);
+		const FVector TargetLocationThisFrame = GetLocationAtTime(*Baked, TargetTime);
+		const FVector Force = (TargetLocationThisFrame - Character.GetActorLocation()) / MovementTickTime;
+
+		RootMotionParams.Set(FTransform(Force));
+	}
+
+	SetTime(GetTime() + SimulationTime);
+}
+
+bool FRootMotionSource_ClimbTransition::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	if (!FRootMotionSource::NetSerialize(Ar, Map, bOutSuccess))
+	{
+		return false;
+	}
+
+	UObject* MontageObject = Montage;
+	Ar << MontageObject;
+	Montage = Cast<UAnimMontage>(MontageObject);
+
+	Ar << StartLocation;
+	Ar << RootMotionRotation;
+	Ar << WarpCorrections;
+	Ar << EndCorrection;
+
+	bOutSuccess = true;
+	return true;
+}
+
+UScriptStruct* FRootMotionSource_ClimbTransition::GetScriptStruct() const
+{
+	return FRootMotionSource_ClimbTransition::StaticStruct();
+}
+
+FString FRootMotionSource_ClimbTransition::ToSimpleString() const
+{
+	return FString::Printf(TEXT("[ID:%u]FRootMotionSource_ClimbTransition %s %s"), LocalID, *InstanceName.GetPlainNameString(), *GetNameSafe(Montage));
+}
+
+void FRootMotionSource_ClimbTransition::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(Montage);
+
+	FRootMotionSource::AddReferencedObjects(Collector);
+}
@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Climbing/ClimbRules.h"
+
+bool ClimbRules::TraceClimbableSurfaces(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer, TArray<FHitResult>& OutSurfaceHits)
+{
+	const FVector Start = Pose.Location + Pose.Forward * 30.f;
+	const FVector End = Start + Pose.Forward;
+
+	OutSurfaceHits = Tracer.CapsuleTrace(Start, End);
+
+	return !OutSurfaceHits.IsEmpty();
+}
+
+FHitResult ClimbRules::TraceFromEyeHeight(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer, float TraceDistance, float TraceStartOffset)
+{
+	const FVector Start = Pose.Location + Pose.Up * (Settings.EyeHeight + TraceStartOffset);
+	const FVector End = Start + Pose.Forward * TraceDistance;
+
+	return Tracer.LineTrace(Start, End);
+}
+
+bool ClimbRules::CanStartClimbing(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer, TArray<FHitResult>& OutSurfaceHits)
+{
+	return TraceClimbableSurfaces(Settings, Pose, Tracer, OutSurfaceHits) && TraceFromEyeHeight(Settings, Pose, Tracer, 100.f).bBlockingHit;
+}
+
+bool ClimbRules::CanTopOut(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer)
+{
+	// 눈높이 앞이 비어 있고, 그 지점 아래에 딛을 바닥이 있어야 함
+	const FHitResult LedgeHitResult = TraceFromEyeHeight(Settings, Pose, Tracer, 50.f, 0.f);
+
+	if (LedgeHitResult.bBlockingHit)
+	{
+		return false;
+	}
+
+	const FVector WalkableSurfaceTraceStart = LedgeHitResult.TraceEnd;
+	const FVector WalkableSurfaceTraceEnd = WalkableSurfaceTraceStart - Pose.Up * 100.f;
+
+	return Tracer.LineTrace(WalkableSurfaceTraceStart, WalkableSurfaceTraceEnd).bBlockingHit;
+}
+
+bool ClimbRules::CanClimbDownLedge(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer, FHitResult& OutWalkableSurfaceHit)
+{
+	const FVector DownVector = -Pose.Up;
+
+	const FVector WalkableSurfaceTraceStart = Pose.Location + Pose.Forward * Settings.ClimbDownWalkableSurfaceTraceOffset;
+	const FVector WalkableSurfaceTraceEnd = WalkableSurfaceTraceStart + DownVector * 100.f;
+
+	OutWalkableSurfaceHit = Tracer.LineTrace(WalkableSurfaceTraceStart, WalkableSurfaceTraceEnd);
+
+	// 바닥 바로 앞이 비어 있어야 렛지 (바닥이 없으면 더 볼 필요 없음)
+	if (!OutWalkableSurfaceHit.bBlockingHit)
+	{
+		return false;
+	}
+
+	const FVector LedgeTraceStart = WalkableSurfaceTraceStart + Pose.Forward * Settings.ClimbDownLedgeTraceOffset;
+	const FVector LedgeTraceEnd = LedgeTraceStart + DownVector * 200.f;
+
+	return !Tracer.LineTrace(LedgeTraceStart, LedgeTraceEnd).bBlockingHit;
+}
+
+/**
+ * @brief 앞쪽으로 점점 멀고 깊어지는 하향 트레이스로 볼팅 시작 / 착지 위치를 찾음
+ *
+ * 첫 스텝이 장애물 윗면(시작 위치), VaultLandTraceIndex 스텝이 착지 위치
+ */
+bool ClimbRules::CanStartVaulting(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer, FVector& OutVaultStartPosition, FVector& OutVaultLandPosition)
+{
+	OutVaultStartPosition = FVector::ZeroVector;
+	OutVaultLandPosition = FVector::ZeroVector;
+
+	for (int32 i = 0; i < Settings.VaultTraceSteps; ++i)
+	{
+		const FVector StartTrace = Pose.Location + Pose.Up * 100.f + Pose.Forward * 80.f * (i + 1);
+		const FVector EndTrace = StartTrace - Pose.Up * 100.f * (i + 1);
+
+		const FHitResult VaultTraceHit = Tracer.LineTrace(StartTrace, EndTrace);
+
+		if (i == 0 && VaultTraceHit.bBlockingHit)
+		{
+			OutVaultStartPosition = VaultTraceHit.ImpactPoint;
+		}
+
+		if (i == Settings.VaultLandTraceIndex && VaultTraceHit.bBlockingHit)
+		{
+			OutVaultLandPosition = VaultTraceHit.ImpactPoint;
+		}
+	}
+
+	return OutVaultStartPosition != FVector::ZeroVector && OutVaultLandPosition != FVector::ZeroVector;
+}
@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Climbing/ClimbSplineActor.h"
+
+#include "Components/SplineComponent.h"
+
+AClimbSplineActor::AClimbSplineActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	Spline = CreateDefaultSubobject<USplineComponent>(TEXT("Spline"));
+	SetRootComponent(Spline);
+
+	// 기본값: 3m 수직 사다리
+	Spline->ClearSplinePoints(false);
+	Spline->AddSplinePoint(FVector::ZeroVector, ESplineCoordinateSpace::Local, false);
+	Spline->AddSplinePoint(FVector(0.f, 0.f, 300.f), ESplineCoordinateSpace::Local, true);
+}
+
+float AClimbSplineActor::GetClimbLength() const
+{
+	return Spline->GetSplineLength();
+}
+
+float AClimbSplineActor::FindDistanceClosestTo(const FVector& WorldLocation) const
+{
+	const float InputKey = Spline->FindInputKeyClosestToWorldLocation(WorldLocation);
+	return Spline->GetDistanceAlongSplineAtSplineInputKey(InputKey);
+}
+
+float AClimbSplineActor::FindAngleAround(float Distance, const FVector& WorldLocation) const
+{
+	if (SplineType == EClimbSplineType::Ladder)
+	{
+		return 0.f;
+	}
+
+	const FVector SplineLocation = Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+	const FVector Tangent = GetTangent(Distance);
+	const FVector Up = Spline->GetUpVectorAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+	const FVector Right = FVector::CrossProduct(Tangent, Up);
+
+	const FVector Offset = FVector::VectorPlaneProject(WorldLocation - SplineLocation, Tangent);
+	return FMath::Atan2(FVector::DotProduct(Offset, Right), FVector::DotProduct(Offset, Up));
+}
+
+FTransform AClimbSplineActor::GetClimbTransform(float Distance, float Angle) const
+{
+	const FVector SplineLocation = Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+	const FVector Tangent = GetTangent(Distance);
+	const FVector Up = Spline->GetUpVectorAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+
+	// 접선 축으로 Up 을 돌린 방향에 매달림
+	const FVector Side = FQuat(Tangent, Angle).RotateVector(Up);
+	const FVector ClimbLocation = SplineLocation + Side * StandOffDistance;
+	const FQuat ClimbRotation = FRotationMatrix::MakeFromXZ(-Side, Tangent).ToQuat();
+
+	return FTransform(ClimbRotation, ClimbLocation);
+}
+
+FVector AClimbSplineActor::GetTangent(float Distance) const
+{
+	return Spline->GetDirectionAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+}
+
+FVector AClimbSplineActor::GetTopExitLocation() const
+{
+	const int32 LastPoint = Spline->GetNumberOfSplinePoints() - 1;
+	const FVector TopLocation = Spline->GetLocationAtSplinePoint(LastPoint, ESplineCoordinateSpace::World);
+	const FVector Up = Spline->GetUpVectorAtSplinePoint(LastPoint, ESplineCoordinateSpace::World);
+	const FVector Tangent = Spline->GetDirectionAtSplinePoint(LastPoint, ESplineCoordinateSpace::World);
+	const FVector Right = FVector::CrossProduct(Tangent, Up);
+
+	return TopLocation - Up * TopExitOffset.X + Right * TopExitOffset.Y + Tangent * TopExitOffset.Z;
+}
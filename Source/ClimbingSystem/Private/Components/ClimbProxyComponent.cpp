@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/ClimbProxyComponent.h"
+
+#include "ClimbingSystem.h"
+
+namespace ClimbProxy
+{
+	static const FName ProfileName(TEXT("ClimbProxy"));
+
+	/**
+	 * @brief 프록시를 제외한 오너의 프리미티브들이 Climb 채널을 무시하도록 설정
+	 *
+	 * 프록시가 배치된 액터는 프록시가 등반 형태를 대표하므로,
+	 * 디테일한 원본 콜리전이 등반 스윕에 다시 걸리지 않도록 한다.
+	 */
+	static void HideOwnerCollisionFromClimbChannel(const UPrimitiveComponent* ProxyComponent)
+	{
+		AActor* Owner = ProxyComponent->GetOwner();
+		if (!Owner)
+		{
+			return;
+		}
+
+		Owner->ForEachComponent<UPrimitiveComponent>(false, [](UPrimitiveComponent* Component)
+		{
+			if (Component->GetCollisionProfileName() != ProfileName)
+			{
+				Component->SetCollisionResponseToChannel(ECC_Climb, ECR_Ignore);
+			}
+		});
+	}
+}
+
+UClimbProxyBoxComponent::UClimbProxyBoxComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SetCollisionProfileName(ClimbProxy::ProfileName);
+	SetGenerateOverlapEvents(false);
+	SetCanEverAffectNavigation(false);
+	SetHiddenInGame(true);
+}
+
+void UClimbProxyBoxComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bHideOwnerCollisionFromClimbChannel)
+	{
+		ClimbProxy::HideOwnerCollisionFromClimbChannel(this);
+	}
+}
+
+UClimbProxyMeshComponent::UClimbProxyMeshComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SetCollisionProfileName(ClimbProxy::ProfileName);
+	SetGenerateOverlapEvents(false);
+	SetCanEverAffectNavigation(false);
+	SetHiddenInGame(true);
+	SetCastShadow(false);
+	bUseAsOccluder = false;
+}
+
+void UClimbProxyMeshComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bHideOwnerCollisionFromClimbChannel)
+	{
+		ClimbProxy::HideOwnerCollisionFromClimbChannel(this);
+	}
+}
@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/ClimbSpringArmComponent.h"
+
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+
+namespace ClimbCamera
+{
+	static TAutoConsoleVariable<bool> CVarUseClimbSurface(
+		TEXT("climb.Camera.UseClimbSurface"),
+		true,
+		TEXT("등반 중 카메라 스프링 암이 이동 컴포넌트의 벽면 정보로 충돌을 처리할지 여부 (끄면 매 프레임 스윕)"));
+}
+
+void UClimbSpringArmComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	const ACharacter* OwnerCharacter = Cast<ACharacter>(GetOwner());
+	ClimbMovementComponent = OwnerCharacter ? Cast<UCustomMovementComponent>(OwnerCharacter->GetCharacterMovement()) : nullptr;
+}
+
+void UClimbSpringArmComponent::UpdateDesiredArmLocation(bool bDoTrace, bool bDoLocationLag, bool bDoRotationLag, float DeltaTime)
+{
+	FVector SurfaceLocation, SurfaceNormal;
+	if (!bDoTrace || !GetClimbSurface(SurfaceLocation, SurfaceNormal))
+	{
+		// 등반을 시작하면 첫 프레임에 바로 스윕
+		ClimbProbeTimeRemaining = 0.f;
+		ClimbProbedArmLength = TNumericLimits<float>::Max();
+
+		Super::UpdateDesiredArmLocation(bDoTrace, bDoLocationLag, bDoRotationLag, DeltaTime);
+		return;
+	}
+
+	ClimbProbeTimeRemaining -= DeltaTime;
+	const bool bProbeThisFrame = ClimbProbeTimeRemaining <= 0.f;
+
+	if (bProbeThisFrame)
+	{
+		ClimbProbeTimeRemaining = ClimbProbeInterval;
+	}
+
+	Super::UpdateDesiredArmLocation(bProbeThisFrame, bDoLocationLag, bDoRotationLag, DeltaTime);
+
+	ClampArmToClimbSurface(SurfaceLocation, SurfaceNormal, bProbeThisFrame);
+}
+
+FVector UClimbSpringArmComponent::BlendLocations(const FVector& DesiredArmLocation, const FVector& TraceHitLocation, bool bHitSomething, float DeltaTime)
+{
+	// 스윕 사이 프레임에서 상한으로 쓸 팔 길이
+	ClimbProbedArmLength = bHitSomething ? FVector::Dist(PreviousArmOrigin, TraceHitLocation) : TNumericLimits<float>::Max();
+
+	return Super::BlendLocations(DesiredArmLocation, TraceHitLocation, bHitSomething, DeltaTime);
+}
+
+bool UClimbSpringArmComponent::GetClimbSurface(FVector& OutSurfaceLocation, FVector& OutSurfaceNormal) const
+{
+	if (!ClimbCamera::CVarUseClimbSurface.GetValueOnGameThread() || !ClimbMovementComponent)
+	{
+		return false;
+	}
+
+	// 스플라인 등반은 벽면 위치를 갖지 않음
+	if (!ClimbMovementComponent->IsClimbing() && !ClimbMovementComponent->IsShimmying())
+	{
+		return false;
+	}
+
+	OutSurfaceLocation = ClimbMovementComponent->GetClimbableSurfaceLocation();
+	OutSurfaceNormal = ClimbMovementComponent->GetClimbableSurfaceNormal();
+
+	return OutSurfaceNormal.IsNormalized();
+}
+
+void UClimbSpringArmComponent::ClampArmToClimbSurface(const FVector& SurfaceLocation, const FVector& SurfaceNormal, bool bProbedThisFrame)
+{
+	const FTransform& ComponentTransform = GetComponentTransform();
+	const FVector ArmOrigin = PreviousArmOrigin;
+	const FVector CameraLocation = ComponentTransform.TransformPosition(RelativeSocketLocation);
+
+	const FVector Arm = CameraLocation - ArmOrigin;
+	const float ArmLength = Arm.Size();
+	if (ArmLength <= UE_KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	const FVector ArmDirection = Arm / ArmLength;
+
+	// 이번 프레임에 스윕했다면 그 결과가 이미 반영되어 있음
+	float MaxArmLength = bProbedThisFrame ? ArmLength : FMath::Min(ArmLength, ClimbProbedArmLength);
+
+	// 팔이 벽 쪽을 향하면 카메라 구가 벽 평면 앞에 남도록 교차 거리까지 줄임
+	const float TowardWall = -FVector::DotProduct(ArmDirection, SurfaceNormal);
+	if (TowardWall > UE_KINDA_SMALL_NUMBER)
+	{
+		const float OriginHeight = FVector::DotProduct(ArmOrigin - SurfaceLocation, SurfaceNormal);
+		const float PlaneArmLength = FMath::Max((OriginHeight - ProbeSize) / TowardWall, 0.f);
+		const FVector PlaneHitLocation = ArmOrigin + ArmDirection * PlaneArmLength;
+
+		if (FVector::DistSquared(PlaneHitLocation, SurfaceLocation) <= FMath::Square(ClimbSurfacePatchRadius))
+		{
+			MaxArmLength = FMath::Min(MaxArmLength, PlaneArmLength);
+		}
+	}
+
+	if (MaxArmLength >= ArmLength)
+	{
+		return;
+	}
+
+	RelativeSocketLocation = ComponentTransform.InverseTransformPosition(ArmOrigin + ArmDirection * MaxArmLength);
+	bIsCameraFixed = true;
+
+	UpdateChildTransforms();
+}
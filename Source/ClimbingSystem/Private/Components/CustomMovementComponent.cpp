@@ -3,15 +3,364 @@
 
 #include "Components/CustomMovementComponent.h"
 
+#include "ClimbingSystem.h"
 #include "ClimbingSystemCharacter.h"
 #include "DebugHelper.h"
 #include "MotionWarpingComponent.h"
 #include "AI/NavigationSystemBase.h"
+#include "Algo/AllOf.h"
+#include "Animation/AnimMontage.h"
+#include "Climbing/ClimbQualitySettings.h"
+#include "Climbing/ClimbRootMotionSource.h"
+#include "Climbing/ClimbSplineActor.h"
 #include "Chaos/Utilities.h"
 #include "Components/CapsuleComponent.h"
+#include "Components/SplineComponent.h"
+#include "DrawDebugHelpers.h"
+#include "EngineUtils.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "GameFramework/Character.h"
+#include "GameFramework/RootMotionSource.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
+#include "LandscapeProxy.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+#include "Subsystems/ClimbAsyncPhysicsSubsystem.h"
+#include "Subsystems/ClimbDistanceFieldSubsystem.h"
+#include "Subsystems/ClimbLedgeSubsystem.h"
+#include "Subsystems/ClimbQueryCacheSubsystem.h"
+#include "Subsystems/ClimbSurfaceSubsystem.h"
+
+namespace ClimbCapsule
+{
+	static constexpr float ClimbingHalfHeight = 48.f;
+	static constexpr float StandingHalfHeight = 96.f;
+
+	/** 회전 / 캡슐 불변식 허용 오차 */
+	static constexpr float HalfHeightTolerance = 0.1f;
+	static constexpr float StandingTiltToleranceDegrees = 1.f;
+}
+
+namespace ClimbAsyncPhysics
+{
+	static TAutoConsoleVariable<bool> CVarEnable(
+		TEXT("climb.AsyncPhysics.Enable"),
+		true,
+		TEXT("bUseAsyncClimbPhysics 캐릭터의 등반 이동을 물리 스레드 콜백에서 시뮬레이션할지 여부"));
+
+	/** 눈높이 위 이 높이에서 렛지 윗면을 찾아 내려감 (물리 스레드가 위로 이동하는 동안 쓸 렛지 높이) */
+	static constexpr float LedgeProbeHeight = 100.f;
+
+	/** CanTopOut 의 앞 / 아래 트레이스 거리 */
+	static constexpr float LedgeForwardOffset = 50.f;
+	static constexpr float LedgeReachDistance = 100.f;
+
+	/** CheckHasReachedFloor 의 스윕 오프셋 */
+	static constexpr float FloorTraceOffset = 50.f;
+}
+
+namespace ClimbLedgeCatch
+{
+	/** 프로브 지점에서 렛지 윗면을 찾는 세로 범위 (눈높이 창 위아래 여유) */
+	static constexpr float ProbeMargin = 20.f;
+
+	/** 렛지 윗면 아래 이 깊이에서 잡을 벽면을 확인 */
+	static constexpr float WallProbeDepth = 15.f;
+
+	/** 비동기 트레이스 UserData: [묶음 번호 | 샘플 3비트] */
+	static constexpr uint32 BatchMask = 0x1FFFFFFF;
+
+	static uint32 EncodeUserData(uint32 Batch, int32 SampleIndex)
+	{
+		return ((Batch & BatchMask) << 3) | static_cast<uint32>(SampleIndex);
+	}
+
+	static void DecodeUserData(uint32 UserData, uint32& OutBatch, int32& OutSampleIndex)
+	{
+		OutBatch = UserData >> 3;
+		OutSampleIndex = UserData & 0x7;
+	}
+}
+
+namespace ClimbLandscape
+{
+	/** 캡슐 스윕 대신 표면을 찾을 높이 오프셋 (캡슐 반높이 비율) */
+	static const float SurfaceSampleHeights[] = { -0.5f, 0.f, 0.5f };
+	static constexpr int32 NumBisectionSteps = 8;
+
+	static bool SampleHeight(const ALandscapeProxy* Landscape, const FVector& Location, float& OutHeight)
+	{
+		// 콜리전 하이트필드를 그리드 위에서 쌍선형 보간한 높이 (구멍 / 범위 밖이면 값 없음)
+		const TOptional<float> Height = Landscape->GetHeightAtLocation(Location, EHeightfieldSource::Complex);
+		OutHeight = Height.Get(0.f);
+		return Height.IsSet();
+	}
+
+	static bool SampleNormal(const ALandscapeProxy* Landscape, const FVector& Location, FVector& OutNormal)
+	{
+		// 하이트필드 그리드 간격으로 중심 차분
+		const float GridSpacing = Landscape->GetActorScale3D().X;
+
+		float HeightLeft, HeightRight, HeightBack, HeightFront;
+		if (!SampleHeight(Landscape, Location - FVector(GridSpacing, 0.f, 0.f), HeightLeft)
+			|| !SampleHeight(Landscape, Location + FVector(GridSpacing, 0.f, 0.f), HeightRight)
+			|| !SampleHeight(Landscape, Location - FVector(0.f, GridSpacing, 0.f), HeightBack)
+			|| !SampleHeight(Landscape, Location + FVector(0.f, GridSpacing, 0.f), HeightFront))
+		{
+			return false;
+		}
+
+		OutNormal = FVector((HeightLeft - HeightRight) / (2.f * GridSpacing), (HeightBack - HeightFront) / (2.f * GridSpacing), 1.f).GetSafeNormal();
+		return true;
+	}
+
+	/**
+	 * @brief 직선이 하이트필드와 만나는 지점을 이분 탐색으로 구함
+	 *
+	 * 시작점은 지형 위, 끝점은 지형 아래에 있어야 하며, 아니면 false 를 반환합니다.
+	 */
+	static bool IntersectSegment(const ALandscapeProxy* Landscape, const FVector& Start, const FVector& End, FVector& OutPoint)
+	{
+		float StartHeight, EndHeight;
+		if (!SampleHeight(Landscape, Start, StartHeight) || !SampleHeight(Landscape, End, EndHeight))
+		{
+			return false;
+		}
+
+		if (Start.Z < StartHeight || End.Z > EndHeight)
+		{
+			return false;
+		}
+
+		float Above = 0.f;
+		float Below = 1.f;
+
+		for (int32 Step = 0; Step < NumBisectionSteps; ++Step)
+		{
+			const float Alpha = (Above + Below) * 0.5f;
+			const FVector Point = FMath::Lerp(Start, End, Alpha);
+
+			float Height;
+			if (!SampleHeight(Landscape, Point, Height))
+			{
+				return false;
+			}
+
+			if (Point.Z >= Height)
+			{
+				Above = Alpha;
+			}
+			else
+			{
+				Below = Alpha;
+			}
+		}
+
+		OutPoint = FMath::Lerp(Start, End, Below);
+		SampleHeight(Landscape, OutPoint, OutPoint.Z);
+		return true;
+	}
+}
+
+namespace ClimbHop
+{
+	/** 위 / 아래 홉의 눈높이 기준 트레이스 시작 오프셋 */
+	static constexpr float UpTraceOffset = -20.f;
+	static constexpr float DownTraceOffset = -300.f;
+	static constexpr float SafetyLedgeTraceOffset = 150.f;
+
+	/** 옆 홉은 제자리 높이 (캡슐 중심) 에서 트레이스 */
+	static constexpr float LevelTraceHeight = 0.f;
+	static constexpr float TraceDistance = 100.f;
+
+	/** 정규화한 입력과의 내적이 이 값 이상인 방향만 후보 (가장 가까운 방향과 인접한 45도 방향) */
+	static constexpr float MinInputAlignment = 0.65f;
+	static constexpr float CacheMaxAngle = 10.f;
+
+	/** 비동기 트레이스 UserData: [묶음 번호 | 방향 3비트 | 안전 트레이스 1비트] */
+	static constexpr uint32 BatchMask = 0x0FFFFFFF;
+
+	/** (오른쪽, 위) 성분 */
+	static FVector2D GetDirectionVector(EClimbHopDirection Direction)
+	{
+		switch (Direction)
+		{
+		case EClimbHopDirection::Up:		return FVector2D(0.f, 1.f);
+		case EClimbHopDirection::UpRight:	return FVector2D(1.f, 1.f);
+		case EClimbHopDirection::Right:		return FVector2D(1.f, 0.f);
+		case EClimbHopDirection::DownRight:	return FVector2D(1.f, -1.f);
+		case EClimbHopDirection::Down:		return FVector2D(0.f, -1.f);
+		case EClimbHopDirection::DownLeft:	return FVector2D(-1.f, -1.f);
+		case EClimbHopDirection::Left:		return FVector2D(-1.f, 0.f);
+		case EClimbHopDirection::UpLeft:	return FVector2D(-1.f, 1.f);
+		}
+
+		return FVector2D::ZeroVector;
+	}
+
+	/** 방향별 몽타주 슬롯 */
+	static EClimbAction GetHopAction(EClimbHopDirection Direction)
+	{
+		switch (Direction)
+		{
+		case EClimbHopDirection::Up:		return EClimbAction::HopUp;
+		case EClimbHopDirection::UpRight:	return EClimbAction::HopUpRight;
+		case EClimbHopDirection::Right:		return EClimbAction::HopRight;
+		case EClimbHopDirection::DownRight:	return EClimbAction::HopDownRight;
+		case EClimbHopDirection::Down:		return EClimbAction::HopDown;
+		case EClimbHopDirection::DownLeft:	return EClimbAction::HopDownLeft;
+		case EClimbHopDirection::Left:		return EClimbAction::HopLeft;
+		case EClimbHopDirection::UpLeft:	return EClimbAction::HopUpLeft;
+		}
+
+		return EClimbAction::HopUp;
+	}
+
+	static bool NeedsSafetyTrace(EClimbHopDirection Direction)
+	{
+		return GetDirectionVector(Direction).Y > 0.f;
+	}
+
+	static uint32 EncodeUserData(uint32 Batch, int32 DirectionIndex, bool bSafetyTrace)
+	{
+		return ((Batch & BatchMask) << 4) | (static_cast<uint32>(DirectionIndex) << 1) | (bSafetyTrace ? 1u : 0u);
+	}
+
+	static void DecodeUserData(uint32 UserData, uint32& OutBatch, int32& OutDirectionIndex, bool& bOutSafetyTrace)
+	{
+		OutBatch = UserData >> 4;
+		OutDirectionIndex = (UserData >> 1) & 0x7;
+		bOutSafetyTrace = (UserData & 1u) != 0;
+	}
+}
+
+namespace ClimbCorner
+{
+	static const FName RootMotionInstanceName(TEXT("ClimbCornerTransition"));
+
+	/** 최대 가속 대비 좌우 입력 비율이 이 값 이상일 때만 모서리를 찾음 */
+	static constexpr float MinLateralInput = 0.3f;
+	static constexpr float CacheMaxAngle = 10.f;
+
+	/** 비동기 트레이스 UserData: [요청 번호 | 트레이스 인덱스 2비트] */
+	static constexpr uint32 BatchMask = 0x3FFFFFFF;
+
+	static uint32 EncodeUserData(uint32 Batch, int32 TraceIndex)
+	{
+		return ((Batch & BatchMask) << 2) | static_cast<uint32>(TraceIndex);
+	}
+}
+
+/** 등반 규칙의 쿼리를 컴포넌트의 트레이스 헬퍼(쿼리 캐시 / 등반 불가 필터 / 디버그 드로우)로 연결 */
+class FClimbMovementRuleTracer final : public IClimbRuleTracer
+{
+public:
+	FClimbMovementRuleTracer(UCustomMovementComponent& InMovement, bool bInShowDebugShape = false, bool bInDrawPersistantShapes = false)
+		: Movement(InMovement)
+		, bShowDebugShape(bInShowDebugShape)
+		, bDrawPersistantShapes(bInDrawPersistantShapes)
+	{
+	}
+
+	virtual FHitResult LineTrace(const FVector& Start, const FVector& End) override
+	{
+		return Movement.DoLineTraceSingleByChannel(Start, End, bShowDebugShape, bDrawPersistantShapes);
+	}
+
+	virtual TArray<FHitResult> CapsuleTrace(const FVector& Start, const FVector& End) override
+	{
+		const FClimbQualitySettings& Quality = Movement.GetClimbProbeQuality();
+
+		return Quality.bCapsuleSurfaceProbes
+			? Movement.DoCapsuleTraceMultiByChannel(Start, End, bShowDebugShape, bDrawPersistantShapes, true, Quality.CapsuleTraceScale)
+			: Movement.DoLineProbeTraceMultiByChannel(Start, End, bShowDebugShape, bDrawPersistantShapes);
+	}
+
+private:
+	UCustomMovementComponent& Movement;
+	bool bShowDebugShape;
+	bool bDrawPersistantShapes;
+};
+
+/**
+ * 입력으로 시작한 등반 동작을 자율 프록시에서 예측하는 범위
+ *
+ * 범위 안에서 새 동작 몽타주가 시작되면 지정한 워프 타겟과 함께 서버에 검증을 요청하고,
+ * 몽타주 없이 등반을 잡거나 놓았으면 서버에도 같은 상태 전환을 요청한다. 서버 / 독립 실행에서는 아무것도 하지 않는다.
+ */
+struct FClimbActionPredictionScope
+{
+	explicit FClimbActionPredictionScope(UCustomMovementComponent& InMovement)
+		: Movement(InMovement)
+		, bPredicting(InMovement.ShouldPredictClimbActions() && !InMovement.bInClimbActionPredictionScope)
+	{
+		if (!bPredicting)
+		{
+			return;
+		}
+
+		Movement.bInClimbActionPredictionScope = true;
+		Movement.RecentWarpTargets.Reset();
+
+		bWasActionPlaying = Movement.IsClimbActionPlaying();
+		bWasInClimbMode = Movement.IsInAnyClimbMode();
+		bWasShimmying = Movement.IsShimmying();
+		StartLocation = Movement.UpdatedComponent->GetComponentLocation();
+		StartRotation = Movement.UpdatedComponent->GetComponentQuat();
+		PreviousMovementMode = Movement.MovementMode;
+		PreviousCustomMode = Movement.CustomMovementMode;
+	}
+
+	~FClimbActionPredictionScope()
+	{
+		if (!bPredicting)
+		{
+			return;
+		}
+
+		Movement.bInClimbActionPredictionScope = false;
+
+		if (!bWasActionPlaying && Movement.IsClimbActionPlaying())
+		{
+			Movement.SendClimbActionPrediction(StartLocation, StartRotation, PreviousMovementMode, PreviousCustomMode);
+		}
+		else if (!bWasInClimbMode && Movement.IsSplineClimbing())
+		{
+			// 스플라인 등반은 몽타주 없이 바로 모드가 바뀌므로 잡은 스플라인을 직접 알림
+			Movement.FlushServerMoves();
+			Movement.ServerStartSplineClimb(Movement.ActiveClimbSpline.Get());
+		}
+		else if (!bWasInClimbMode && Movement.IsClimbing())
+		{
+			// 몽타주 없이 일반 등반으로 들어가는 경로는 렛지 캐치 슬롯이 빈 경우뿐이므로 잡은 렛지를 직접 알림
+			Movement.FlushServerMoves();
+			Movement.ServerLedgeCatch(Movement.LedgeCatchLedgeTop, Movement.LedgeCatchDirection);
+		}
+		else if (bWasShimmying && Movement.IsClimbing())
+		{
+			Movement.FlushServerMoves();
+			Movement.ServerDropFromShimmy();
+		}
+		else if (bWasInClimbMode && !Movement.IsInAnyClimbMode())
+		{
+			Movement.ServerStopClimbing();
+		}
+	}
+
+private:
+	UCustomMovementComponent& Movement;
+	const bool bPredicting;
+
+	bool bWasActionPlaying = false;
+	bool bWasInClimbMode = false;
+	bool bWasShimmying = false;
+	FVector StartLocation = FVector::ZeroVector;
+	FQuat StartRotation = FQuat::Identity;
+	EMovementMode PreviousMovementMode = MOVE_None;
+	uint8 PreviousCustomMode = 0;
+};
 
 void UCustomMovementComponent::BeginPlay()
 {
@@ -26,27 +375,124 @@ void UCustomMovementComponent::BeginPlay()
 	}
 	
 	OwningPlayerCharacter = Cast<AClimbingSystemCharacter>(CharacterOwner);
+	ClimbSurfaceSubsystem = GetWorld()->GetSubsystem<UClimbSurfaceSubsystem>();
+	ClimbQueryCacheSubsystem = GetWorld()->GetSubsystem<UClimbQueryCacheSubsystem>();
+	ClimbAsyncPhysicsSubsystem = GetWorld()->GetSubsystem<UClimbAsyncPhysicsSubsystem>();
+	ClimbLedgeSubsystem = GetWorld()->GetSubsystem<UClimbLedgeSubsystem>();
+	ClimbDistanceFieldSubsystem = GetWorld()->GetSubsystem<UClimbDistanceFieldSubsystem>();
+
+	DefaultMeshAnimTickOption = CharacterOwner->GetMesh()->VisibilityBasedAnimTickOption;
+	UpdateServerPoseTicking();
+
+	HopTraceDelegate.BindUObject(this, &ThisClass::OnHopCandidateTraceDone);
+	CornerTraceDelegate.BindUObject(this, &ThisClass::OnCornerTraceDone);
+	LedgeCatchTraceDelegate.BindUObject(this, &ThisClass::OnLedgeCatchTraceDone);
+
+	ApplyClimbProfileTuning();
+
+	if (bPreloadClimbMontages)
+	{
+		RequestClimbMontages();
+	}
 }
 
 void UCustomMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	SCOPE_CYCLE_COUNTER(STAT_ClimbMovementTick);
+	FSimpleScopeSecondsCounter MovementTickTimer(ClimbStats::MovementTickSeconds);
+
+	LastClimbTickSeconds = 0.0;
+	FSimpleScopeSecondsCounter ComponentTickTimer(LastClimbTickSeconds);
+
+	// 낮춘 틱에서 깨어난 직후에는 누적된 시간을 한 번에 시뮬레이션하지 않음
+	if (bClampNextTickDeltaTime)
+	{
+		DeltaTime = FMath::Min(DeltaTime, GetWorld()->GetDeltaSeconds());
+		bClampNextTickDeltaTime = false;
+	}
+
+	// 이번 프레임 입력이 소비되기 전에 AI 경로 입력을 넣어야 함
+	TickClimbRoute(DeltaTime);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	UpdateBakedClimbTransition();
+	UpdateQueuedClimbAction(DeltaTime);
+	TickClimbCorrectionBlend(DeltaTime);
+
+	// 이동이 끝난 위치 기준으로, 누군가 읽어간 경우에만 프로브 결과를 갱신
+	if (bClimbProbeSnapshotRequested)
+	{
+		RefreshClimbProbeSnapshot();
+	}
+
+	// 저품질에서는 홉 후보를 미리 트레이스하지 않고 요청 시 동기 트레이스
+	if (GetClimbProbeQuality().bHopPrefetch)
+	{
+		UpdateHopCandidates();
+	}
+
+	UpdateCornerPrefetch();
+	UpdateLedgeCatch();
+	UpdateShimmyInput(DeltaTime);
+
+	UpdateClimbTickPolicy(DeltaTime);
 }
 
 void UCustomMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
 {
-	if (IsClimbing())
+	WakeClimbTick();
+
+	// 등반 진입 / 해제 시 이전 표면 캐시는 무효
+	bHasClimbSurfaceCache = false;
+	ClimbSurfaceBase.Reset();
+	InvalidateHopCandidates();
+	InvalidateCornerPrefetch();
+	InvalidateLedgeCatchProbes();
+	bLedgeCatchRequested = false;
+	StopCornerTransition();
+	ReleaseAsyncClimber();
+
+	const bool bWasInClimbMode = PreviousMovementMode == MOVE_Custom
+		&& (PreviousCustomMode == ECustomMovementMode::MOVE_Climb
+			|| PreviousCustomMode == ECustomMovementMode::MOVE_SplineClimb
+			|| PreviousCustomMode == ECustomMovementMode::MOVE_Shimmy);
+
+	// 등반 모드 사이 전환 (벽 ↔ 렛지) 은 진입 / 해제가 아니므로 캡슐 / 회전을 그대로 둠
+	if (IsInAnyClimbMode() != bWasInClimbMode && CharacterOwner->HasAuthority())
+	{
+		CharacterOwner->ForceNetUpdate();
+	}
+
+	if (IsInAnyClimbMode() && !bWasInClimbMode)
 	{
 		bOrientRotationToMovement = false;
-		CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(48.f);
+		CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(ClimbCapsule::ClimbingHalfHeight);
 
 		OnEnterClimbStateDelegate.ExecuteIfBound();
 	}
 
-	if (PreviousMovementMode == MOVE_Custom && PreviousCustomMode == ECustomMovementMode::MOVE_Climb)
+	if (PreviousMovementMode == MOVE_Custom && PreviousCustomMode == ECustomMovementMode::MOVE_SplineClimb)
+	{
+		if (UpdatedPrimitive)
+		{
+			UpdatedPrimitive->IgnoreActorWhenMoving(ActiveClimbSpline.Get(), false);
+		}
+
+		ActiveClimbSpline.Reset();
+	}
+
+	if (PreviousMovementMode == MOVE_Custom && PreviousCustomMode == ECustomMovementMode::MOVE_Shimmy)
+	{
+		ShimmyLedgeComponent.Reset();
+		ActiveShimmyLedge = FClimbLedgePolyline();
+		ShimmySpeed = 0.f;
+	}
+
+	if (bWasInClimbMode && !IsInAnyClimbMode())
 	{
 		bOrientRotationToMovement = true;
-		CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(96.f);
+		CharacterOwner->GetCapsuleComponent()->SetCapsuleHalfHeight(ClimbCapsule::StandingHalfHeight);
 
 		const FRotator DirtyRotation = UpdatedComponent->GetComponentRotation();
 		const FRotator CleanStandRotation = FRotator(0.f, DirtyRotation.Yaw, 0.f);
@@ -54,6 +500,7 @@ void UCustomMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovem
 		UpdatedComponent->SetRelativeRotation(CleanStandRotation);
 		
 		StopMovementImmediately();
+		LastClimbReleaseTime = GetWorld()->GetTimeSeconds();
 		OnExitClimbStateDelegate.ExecuteIfBound();
 	}
 
@@ -64,7 +511,24 @@ void UCustomMovementComponent::PhysCustom(float deltaTime, int32 Iterations)
 {
 	if (IsClimbing())
 	{
-		PhysClimb(deltaTime, Iterations);
+		if (ShouldUseAsyncClimbPhysics())
+		{
+			PhysClimbAsync(deltaTime, Iterations);
+		}
+		else
+		{
+			// 게임 스레드가 움직인 뒤 물리 스레드로 돌아가면 그 위치에서 다시 시작
+			bAsyncClimbNeedsReset = true;
+			PhysClimb(deltaTime, Iterations);
+		}
+	}
+	else if (IsSplineClimbing())
+	{
+		PhysSplineClimb(deltaTime, Iterations);
+	}
+	else if (IsShimmying())
+	{
+		PhysShimmy(deltaTime, Iterations);
 	}
 	Super::PhysCustom(deltaTime, Iterations);
 }
@@ -73,7 +537,18 @@ float UCustomMovementComponent::GetMaxSpeed() const
 {
 	if (IsClimbing())
 	{
-		return MaxClimbSpeed;
+		return MaxClimbSpeed * CurrentClimbSurfaceProperties.ClimbSpeedScale;
+	}
+
+	if (IsSplineClimbing())
+	{
+		const AClimbSplineActor* ClimbSpline = ActiveClimbSpline.Get();
+		return MaxClimbSpeed * (ClimbSpline ? ClimbSpline->GetClimbSpeedScale() : 1.f);
+	}
+
+	if (IsShimmying())
+	{
+		return MaxShimmySpeed;
 	}
 	
 	return Super::GetMaxSpeed();
@@ -81,7 +556,7 @@ float UCustomMovementComponent::GetMaxSpeed() const
 
 float UCustomMovementComponent::GetMaxAcceleration() const
 {
-	if (IsClimbing())
+	if (IsInAnyClimbMode())
 	{
 		return MaxClimbAcceleration;
 	}
@@ -101,16 +576,26 @@ FVector UCustomMovementComponent::ConstrainAnimRootMotionVelocity(const FVector&
 
 void UCustomMovementComponent::ToggleClimbing(bool bEnableClimb)
 {
+	WakeClimbTick();
+	RequestClimbMontages();
+
+	FClimbActionPredictionScope PredictionScope(*this);
+
 	if(bEnableClimb)
 	{
+		if (TryStartSplineClimb())
+		{
+			return;
+		}
+
 		if(CanStartClimbing())
 		{
 			//Enter the climb state
-			PlayClimbMontage(IdleToClimbMontage);
+			PlayClimbMontage(GetClimbActionMontage(EClimbAction::EnterClimb));
 		}
 		else if (CanClimbDownLedge())
 		{
-			PlayClimbMontage(ClimbDownLedgeMontage);
+			PlayClimbMontage(GetClimbActionMontage(EClimbAction::ClimbDownLedge));
 		}
 		else
 		{
@@ -124,115 +609,432 @@ void UCustomMovementComponent::ToggleClimbing(bool bEnableClimb)
 	}
 }
 
-void UCustomMovementComponent::HandleHopUp()
+/**
+ * @brief 입력 방향에 가장 가까운 도달 가능한 홉 대상으로 홉
+ *
+ * 입력을 벽면 기준 (오른쪽, 위) 평면으로 옮긴 뒤 8방향 후보 중 입력과 정렬된 방향을 점수순으로 고릅니다.
+ * 가장 가까운 방향이 막혀 있으면 인접한 45도 방향으로 대신 홉합니다.
+ */
+void UCustomMovementComponent::RequestHopping()
 {
-	FVector HopUpTargetPoint;
-	if (CheckCanHopUp(HopUpTargetPoint))
-	{
-		SetMotionWarpTarget(HopUpTargetPointName, HopUpTargetPoint);
-		PlayClimbMontage(HopUpMontage);
-	}
-}
+	WakeClimbTick();
+	RequestClimbMontages();
 
-bool UCustomMovementComponent::CheckCanHopUp(FVector& OutHopUpTargetPosition)
-{
-	const FHitResult HopUpHit = TraceFromEyeHeight(100.f, -20.f);
-	const FHitResult SafetyLedgeHit = TraceFromEyeHeight(100.f, 150.f);
+	FClimbActionPredictionScope PredictionScope(*this);
 
-	if (HopUpHit.bBlockingHit && SafetyLedgeHit.bBlockingHit)
-	{
-		OutHopUpTargetPosition = HopUpHit.ImpactPoint;
-		return true;
-	}
-	return false;
-}
+	const FVector UnrotatedLastInputVector = UKismetMathLibrary::Quat_UnrotateVector(UpdatedComponent->GetComponentQuat(), GetLastInputVector());
+	const FVector2D InputDirection = FVector2D(UnrotatedLastInputVector.Y, UnrotatedLastInputVector.Z).GetSafeNormal();
 
-void UCustomMovementComponent::HandleHopDown()
-{
-	FVector HopDownTargetPoint;
-	if (CheckCanHopDown(HopDownTargetPoint))
+	if (InputDirection.IsZero())
 	{
-		SetMotionWarpTarget(HopDownTargetPointName, HopDownTargetPoint);
-		PlayClimbMontage(HopDownMontage);
+		return;
 	}
-}
 
-bool UCustomMovementComponent::CheckCanHopDown(FVector& OutHopDownTargetPosition)
-{
-	const FHitResult HopDownHit = TraceFromEyeHeight(100.f, -300.f);
-
-	if (HopDownHit.bBlockingHit)
+	EClimbHopDirection HopDirection;
+	FVector HopTargetPosition;
+	if (FindHopTarget(InputDirection, HopDirection, HopTargetPosition))
 	{
-		OutHopDownTargetPosition = HopDownHit.ImpactPoint;
-		return true;
+		StartHop(HopDirection, HopTargetPosition);
 	}
-	
-	return false;
 }
 
-void UCustomMovementComponent::RequestHopping()
+UAnimMontage* UCustomMovementComponent::GetClimbActionMontage(EClimbAction Action) const
 {
-	const FVector UnrotatedLastInputVector = UKismetMathLibrary::Quat_UnrotateVector(UpdatedComponent->GetComponentQuat(), GetLastInputVector());
-
-	const float DotResult = FVector::DotProduct(UnrotatedLastInputVector.GetSafeNormal(), FVector::UpVector);
-	
-
-	if (DotResult >= 0.9f)
-	{
-		HandleHopUp();
-	}
-	else if (DotResult <= -0.9f)
-	{
-		HandleHopDown();
-	}
+	// 아직 로드되지 않았으면 nullptr (PlayClimbMontage 가 무시)
+	const int32 ActionIndex = static_cast<int32>(Action);
+	return LoadedClimbMontages.IsValidIndex(ActionIndex) ? LoadedClimbMontages[ActionIndex].Get() : nullptr;
 }
 
-bool UCustomMovementComponent::IsClimbing() const
+float UCustomMovementComponent::GetClimbActionDuration(EClimbAction Action) const
 {
-	return MovementMode == MOVE_Custom && CustomMovementMode == ECustomMovementMode::MOVE_Climb;
+	const UAnimMontage* Montage = GetClimbActionMontage(Action);
+	return Montage ? Montage->GetPlayLength() : 0.f;
 }
 
-FVector UCustomMovementComponent::GetUnrotatedClimbVelocity() const
+bool UCustomMovementComponent::TryClimbAction(EClimbAction Action)
 {
-	return UKismetMathLibrary::Quat_UnrotateVector(UpdatedComponent->GetComponentQuat(), Velocity);
-}
+	WakeClimbTick();
+	RequestClimbMontages();
 
-bool UCustomMovementComponent::CanStartClimbing()
-{
-	if (IsFalling() || !TraceClimbableSurfaces() || !TraceFromEyeHeight(100.f).bBlockingHit)
+	FClimbActionPredictionScope PredictionScope(*this);
+
+	if (IsClimbActionPlaying())
 	{
 		return false;
 	}
 
-	return true;
-}
-
-bool UCustomMovementComponent::CheckShouldStopClimbing()
-{
-	if (ClimbableSurfacesTracedResults.IsEmpty())
+	switch (Action)
 	{
-		return true;
-	}
+	case EClimbAction::EnterClimb:
+		if (TryStartSplineClimb())
+		{
+			break;
+		}
 
-	const float DotResult = FVector::DotProduct(CurrentClimbableSurfaceNormal, FVector::UpVector);
-	const float DegreeDifferent = FMath::RadiansToDegrees(FMath::Acos(DotResult));
+		if (CanStartClimbing())
+		{
+			PlayClimbMontage(GetClimbActionMontage(EClimbAction::EnterClimb));
+		}
+		break;
 
-	if (DegreeDifferent <= MaxClimbableSurfaceAngle)
-	{
-		return true;
-	}
+	case EClimbAction::TopOut:
+		if ((IsClimbing() && CanTopOut()) || IsShimmying())
+		{
+			StopClimbing();
+			PlayClimbMontage(GetClimbActionMontage(EClimbAction::TopOut));
+		}
+		break;
 
-	return false;
-}
+	case EClimbAction::ClimbDownLedge:
+		if (CanClimbDownLedge())
+		{
+			PlayClimbMontage(GetClimbActionMontage(EClimbAction::ClimbDownLedge));
+		}
+		break;
 
-bool UCustomMovementComponent::CheckHasReachedFloor()
-{
-	// 캐릭터의 '아래 방향' 벡터를 계산 (UpVector의 반대)
-	// 캐릭터가 회전해 있을 수 있으므로, 단순히 FVector::DownVector를 쓰는 대신 컴포넌트의 실제 Up 방향을 기준으로 계산함.
-	const FVector DownVector = -UpdatedComponent->GetUpVector();
+	case EClimbAction::Vault:
+		TryStartVaulting();
+		break;
 
-	// 트레이스 시작 위치를 약간 아래로 오프셋 (50cm 정도)
-	// 캐릭터가 벽을 타고 내려올 때 바닥 근처를 탐색하기 위함.
+	case EClimbAction::HopUp:
+		if (IsClimbing())
+		{
+			HandleHop(EClimbHopDirection::Up);
+		}
+		break;
+
+	case EClimbAction::HopDown:
+		if (IsClimbing())
+		{
+			HandleHop(EClimbHopDirection::Down);
+		}
+		break;
+
+	case EClimbAction::HopLeft:
+		if (IsClimbing())
+		{
+			HandleHop(EClimbHopDirection::Left);
+		}
+		break;
+
+	case EClimbAction::HopRight:
+		if (IsClimbing())
+		{
+			HandleHop(EClimbHopDirection::Right);
+		}
+		break;
+
+	case EClimbAction::HopUpLeft:
+		if (IsClimbing())
+		{
+			HandleHop(EClimbHopDirection::UpLeft);
+		}
+		break;
+
+	case EClimbAction::HopUpRight:
+		if (IsClimbing())
+		{
+			HandleHop(EClimbHopDirection::UpRight);
+		}
+		break;
+
+	case EClimbAction::HopDownLeft:
+		if (IsClimbing())
+		{
+			HandleHop(EClimbHopDirection::DownLeft);
+		}
+		break;
+
+	case EClimbAction::HopDownRight:
+		if (IsClimbing())
+		{
+			HandleHop(EClimbHopDirection::DownRight);
+		}
+		break;
+
+	case EClimbAction::LedgeCatch:
+		// 아직 후보가 없으면 요청을 기억해 두고 프로브 결과가 들어오는 틱에 잡음
+		if (!TryLedgeCatch() && IsFalling())
+		{
+			bLedgeCatchRequested = true;
+		}
+		break;
+
+	case EClimbAction::ShimmyDrop:
+		TryDropFromShimmy();
+		break;
+	}
+
+	return IsClimbActionPlaying();
+}
+
+bool UCustomMovementComponent::IsClimbActionPlaying() const
+{
+	return ActiveClimbTransitionSourceId != 0 || (OwningPlayerAnimInstance && OwningPlayerAnimInstance->IsAnyMontagePlaying());
+}
+
+#if !UE_BUILD_SHIPPING
+bool UCustomMovementComponent::ValidateClimbState(FString& OutFailure) const
+{
+	if (!CharacterOwner || !UpdatedComponent)
+	{
+		return true;
+	}
+
+	const FVector Location = UpdatedComponent->GetComponentLocation();
+	if (Location.ContainsNaN() || Velocity.ContainsNaN())
+	{
+		OutFailure = FString::Printf(TEXT("NaN location/velocity (%s / %s)"), *Location.ToString(), *Velocity.ToString());
+		return false;
+	}
+
+	const bool bClimbing = IsInAnyClimbMode();
+	const bool bActionPlaying = IsClimbActionPlaying();
+
+	// OnMovementModeChanged 가 등반 진입 / 해제 시 캡슐을 바꿈
+	const float ExpectedHalfHeight = bClimbing ? ClimbCapsule::ClimbingHalfHeight : ClimbCapsule::StandingHalfHeight;
+	const float HalfHeight = CharacterOwner->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+	if (!FMath::IsNearlyEqual(HalfHeight, ExpectedHalfHeight, ClimbCapsule::HalfHeightTolerance))
+	{
+		OutFailure = FString::Printf(TEXT("capsule half-height %.1f, expected %.1f (%s)"), HalfHeight, ExpectedHalfHeight, bClimbing ? TEXT("climbing") : TEXT("not climbing"));
+		return false;
+	}
+
+	if (bOrientRotationToMovement == bClimbing)
+	{
+		OutFailure = FString::Printf(TEXT("bOrientRotationToMovement=%d while %s"), bOrientRotationToMovement, bClimbing ? TEXT("climbing") : TEXT("not climbing"));
+		return false;
+	}
+
+	if (!bClimbing && bCornerTransitionActive)
+	{
+		OutFailure = TEXT("corner transition active outside climb mode");
+		return false;
+	}
+
+	const FRotator Rotation = UpdatedComponent->GetComponentRotation();
+
+	// 등반 해제 시 요 회전만 남기므로, 동작 몽타주가 없는 지상 / 공중 상태에서는 기울어져 있으면 안 됨
+	if (!bClimbing && !bActionPlaying
+		&& (FMath::Abs(Rotation.Pitch) > ClimbCapsule::StandingTiltToleranceDegrees || FMath::Abs(Rotation.Roll) > ClimbCapsule::StandingTiltToleranceDegrees))
+	{
+		OutFailure = FString::Printf(TEXT("tilted while not climbing (%s)"), *Rotation.ToString());
+		return false;
+	}
+
+	// 동작 / 모서리 전환 없이 등반 중이면 PhysClimb 가 유지한 표면이 있어야 하고, 그 표면을 등지면 안 됨
+	if (IsSplineClimbing() && !ActiveClimbSpline.IsValid())
+	{
+		OutFailure = TEXT("spline climbing without a spline");
+		return false;
+	}
+
+	if (IsShimmying() && !ShimmyLedgeComponent.IsValid())
+	{
+		OutFailure = TEXT("shimmying without a ledge");
+		return false;
+	}
+
+	// 스플라인 등반은 표면을 트레이스하지 않으므로 제외
+	if (IsClimbing() && !bActionPlaying && !bCornerTransitionActive)
+	{
+		if (ClimbableSurfacesTracedResults.IsEmpty())
+		{
+			OutFailure = TEXT("climbing without a tracked surface");
+			return false;
+		}
+
+		if (FVector::DotProduct(UpdatedComponent->GetForwardVector(), -CurrentClimbableSurfaceNormal) <= 0.f)
+		{
+			OutFailure = FString::Printf(TEXT("facing away from climb surface (forward %s, normal %s)"),
+				*UpdatedComponent->GetForwardVector().ToString(), *CurrentClimbableSurfaceNormal.ToString());
+			return false;
+		}
+	}
+
+	return true;
+}
+#endif
+
+const FClimbProbeSnapshot& UCustomMovementComponent::RequestClimbProbeSnapshot()
+{
+	// 잠든 상태에서는 갱신할 틱이 없으므로 깨움
+	if (IsClimbTickSleeping())
+	{
+		WakeClimbTick();
+	}
+
+	if (ClimbProbeSnapshot.FrameNumber + 1 < GFrameCounter)
+	{
+		RefreshClimbProbeSnapshot();
+	}
+
+	bClimbProbeSnapshotRequested = true;
+	return ClimbProbeSnapshot;
+}
+
+/**
+ * @brief 등반 동작 가능 여부를 한 번에 프로브해 스냅샷으로 저장
+ *
+ * 등반 중에는 PhysClimb 가 이번 프레임에 이미 구한 표면 정보를 재사용하고 홉 / 탑아웃만 확인하며,
+ * 지상에서는 등반 시작 / 렛지 내려가기 / 볼팅을 확인합니다.
+ *
+ * @note 같은 프레임에 여러 번 요청되어도 트레이스는 한 번만 수행됩니다.
+ */
+void UCustomMovementComponent::RefreshClimbProbeSnapshot()
+{
+	bClimbProbeSnapshotRequested = false;
+
+	if (ClimbProbeSnapshot.FrameNumber == GFrameCounter)
+	{
+		return;
+	}
+
+	const FVector ProbeLocation = UpdatedComponent->GetComponentLocation();
+	const FQuat ProbeRotation = UpdatedComponent->GetComponentQuat();
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// 같은 이동 모드에서 자세가 거의 그대로이고 재판정 간격이 지나지 않았으면 트레이스가 필요한 판정은 이전 값을 재사용
+	const bool bReuseTracedVerdicts = ClimbProbeSnapshot.FrameNumber != 0
+		&& SnapshotMovementMode == MovementMode && SnapshotCustomMovementMode == CustomMovementMode
+		&& CurrentTime - SnapshotProbeTime < ClimbProbeSnapshotInterval
+		&& FVector::DistSquared(ProbeLocation, SnapshotProbeLocation) <= FMath::Square(ClimbProbeSnapshotReprobeDistance)
+		&& ProbeRotation.AngularDistance(SnapshotProbeRotation) <= FMath::DegreesToRadians(ClimbProbeSnapshotReprobeAngle);
+
+	FClimbProbeSnapshot NewSnapshot = bReuseTracedVerdicts ? ClimbProbeSnapshot : FClimbProbeSnapshot();
+	NewSnapshot.FrameNumber = GFrameCounter;
+	NewSnapshot.bIsClimbing = IsClimbing();
+	NewSnapshot.bIsShimmying = IsShimmying();
+
+	if (NewSnapshot.bIsClimbing)
+	{
+		// 홉 가능 여부는 비동기로 평가된 후보 캐시를 읽음 (캐시가 낡았으면 다음 프레임에 채워짐)
+		FVector HopTargetPosition;
+		NewSnapshot.bCanHopUp = GetCachedHopCandidate(EClimbHopDirection::Up, HopTargetPosition);
+		NewSnapshot.bCanHopDown = GetCachedHopCandidate(EClimbHopDirection::Down, HopTargetPosition);
+		NewSnapshot.bCanHopLeft = GetCachedHopCandidate(EClimbHopDirection::Left, HopTargetPosition);
+		NewSnapshot.bCanHopRight = GetCachedHopCandidate(EClimbHopDirection::Right, HopTargetPosition);
+		NewSnapshot.bCanHopUpLeft = GetCachedHopCandidate(EClimbHopDirection::UpLeft, HopTargetPosition);
+		NewSnapshot.bCanHopUpRight = GetCachedHopCandidate(EClimbHopDirection::UpRight, HopTargetPosition);
+		NewSnapshot.bCanHopDownLeft = GetCachedHopCandidate(EClimbHopDirection::DownLeft, HopTargetPosition);
+		NewSnapshot.bCanHopDownRight = GetCachedHopCandidate(EClimbHopDirection::DownRight, HopTargetPosition);
+		bHopCandidatesRequested |= !IsHopCandidateCacheValid();
+
+		// 표면은 이동 중 이미 프로브한 결과를 그대로 사용
+		NewSnapshot.SurfaceNormal = CurrentClimbableSurfaceNormal;
+		NewSnapshot.SurfaceProperties = CurrentClimbSurfaceProperties;
+
+		if (!bReuseTracedVerdicts)
+		{
+			NewSnapshot.bCanTopOut = CanTopOut();
+		}
+	}
+	else if (IsFalling())
+	{
+		// 공중에서는 예측 궤적 프로브 결과만 읽음 (벽 확인은 실제로 잡을 때)
+		NewSnapshot.bCanCatchLedge = bHasLedgeCatchCandidate;
+	}
+	else if (IsMovingOnGround() && !bReuseTracedVerdicts)
+	{
+		FVector VaultStartPosition;
+		FVector VaultLandPosition;
+		NewSnapshot.bCanStartClimbing = CanStartClimbing();
+		NewSnapshot.bCanClimbDownLedge = CanClimbDownLedge();
+		NewSnapshot.bCanVault = CanStartVaulting(VaultStartPosition, VaultLandPosition);
+
+		if (NewSnapshot.bCanStartClimbing && ClimbSurfaceSubsystem)
+		{
+			NewSnapshot.SurfaceNormal = ClimbableSurfacesTracedResults[0].Normal;
+			NewSnapshot.SurfaceProperties = ClimbSurfaceSubsystem->GetSurfaceProperties(ClimbableSurfacesTracedResults[0]);
+		}
+	}
+
+	if (!bReuseTracedVerdicts)
+	{
+		SnapshotProbeLocation = ProbeLocation;
+		SnapshotProbeRotation = ProbeRotation;
+		SnapshotProbeTime = CurrentTime;
+		SnapshotMovementMode = MovementMode;
+		SnapshotCustomMovementMode = CustomMovementMode;
+	}
+
+	ClimbProbeSnapshot = NewSnapshot;
+}
+
+bool UCustomMovementComponent::IsClimbing() const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == ECustomMovementMode::MOVE_Climb;
+}
+
+bool UCustomMovementComponent::IsSplineClimbing() const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == ECustomMovementMode::MOVE_SplineClimb;
+}
+
+bool UCustomMovementComponent::IsShimmying() const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == ECustomMovementMode::MOVE_Shimmy;
+}
+
+bool UCustomMovementComponent::IsInAnyClimbMode() const
+{
+	return IsClimbing() || IsSplineClimbing() || IsShimmying();
+}
+
+FVector UCustomMovementComponent::GetUnrotatedClimbVelocity() const
+{
+	return UKismetMathLibrary::Quat_UnrotateVector(UpdatedComponent->GetComponentQuat(), Velocity);
+}
+
+bool UCustomMovementComponent::CanStartClimbing()
+{
+	if (IsFalling())
+	{
+		return false;
+	}
+
+	FClimbMovementRuleTracer Tracer(*this);
+	return ClimbRules::CanStartClimbing(GetClimbRuleSettings(), GetClimbProbePose(), Tracer, ClimbableSurfacesTracedResults);
+}
+
+bool UCustomMovementComponent::CheckShouldStopClimbing()
+{
+	if (ClimbableSurfacesTracedResults.IsEmpty())
+	{
+		return true;
+	}
+
+	const float DotResult = FVector::DotProduct(CurrentClimbableSurfaceNormal, FVector::UpVector);
+	const float DegreeDifferent = FMath::RadiansToDegrees(FMath::Acos(DotResult));
+
+	// 표면별로 지정된 각도가 있으면 그 값을 우선 사용
+	if (DegreeDifferent <= CurrentClimbSurfaceProperties.GetMaxClimbableSurfaceAngle(MaxClimbableSurfaceAngle))
+	{
+		return true;
+	}
+
+	return false;
+}
+
+bool UCustomMovementComponent::CheckHasReachedFloor()
+{
+	// 아래로 이동 중일 때만 바닥 도달로 판단하므로, 그 외에는 스윕을 생략
+	if (GetUnrotatedClimbVelocity().Z >= -10.f)
+	{
+		return false;
+	}
+
+	if (const ALandscapeProxy* Landscape = GetTrackedLandscape())
+	{
+		return CheckHasReachedLandscapeFloor(Landscape);
+	}
+
+	// 캐릭터의 '아래 방향' 벡터를 계산 (UpVector의 반대)
+	// 캐릭터가 회전해 있을 수 있으므로, 단순히 FVector::DownVector를 쓰는 대신 컴포넌트의 실제 Up 방향을 기준으로 계산함.
+	const FVector DownVector = -UpdatedComponent->GetUpVector();
+
+	// 트레이스 시작 위치를 약간 아래로 오프셋 (50cm 정도)
+	// 캐릭터가 벽을 타고 내려올 때 바닥 근처를 탐색하기 위함.
 	const FVector StartOffset = DownVector * 50.f;
 
 	// 캡슐 트레이스 시작/끝 위치 계산
@@ -243,7 +1045,8 @@ bool UCustomMovementComponent::CheckHasReachedFloor()
 
 	// 캡슐 모양으로 아래 방향에 충돌체를 쏴서 바닥을 탐지
 	// 여러 개의 충돌 결과를 받을 수 있음.
-	TArray<FHitResult> PossibleFloorHits = DoCapsuleTraceMultiByObject(Start, End, false, false);
+	// 바닥은 등반 불가로 태그되어 있어도 감지되어야 하므로 필터링하지 않음
+	TArray<FHitResult> PossibleFloorHits = DoCapsuleTraceMultiByChannel(Start, End, false, false, false);
 
 	// 아무 것도 감지되지 않았다면 바닥에 닿지 않은 상태이므로 false 반환
 	if (PossibleFloorHits.IsEmpty())
@@ -254,15 +1057,12 @@ bool UCustomMovementComponent::CheckHasReachedFloor()
 	// 감지된 충돌 결과들(PossibleFloorHits)을 하나씩 검사
 	for (const FHitResult& PossibleResult : PossibleFloorHits)
 	{
-		// 바닥 조건 판정:
-		// 1. 충돌한 면의 노멀(ImpactNormal)이 위쪽 방향(FVector::UpVector)과 거의 평행해야 함
+		// 바닥 조건 판정 (아래로 이동 중인지는 함수 시작에서 확인):
+		// 충돌한 면의 노멀(ImpactNormal)이 위쪽 방향(FVector::UpVector)과 거의 평행해야 함
 		//    - 즉, 수평면(바닥)에 가까운 면이어야 함.
-		// 2. 현재 속도의 Z값이 -10.f보다 작아야 함
-		//    - 캐릭터가 실제로 아래쪽으로 이동 중일 때만 바닥 도착으로 간주.
-		const bool bFloorReached = FVector::Parallel(-PossibleResult.ImpactNormal, FVector::UpVector) && GetUnrotatedClimbVelocity().Z < -10.f;
-			// GetUnrotatedClimbVelocity().Z < -10.f;
+		const bool bFloorReached = FVector::Parallel(-PossibleResult.ImpactNormal, FVector::UpVector);
 
-		// 위 두 조건을 만족하면 바닥에 도달했다고 판단하고 true 반환
+		// 조건을 만족하면 바닥에 도달했다고 판단하고 true 반환
 		if (bFloorReached)
 		{
 			return true;
@@ -275,24 +1075,25 @@ bool UCustomMovementComponent::CheckHasReachedFloor()
 
 bool UCustomMovementComponent::CheckHasReachedLedge()
 {
-	// FHitResult LedgeHitResult = TraceFromEyeHeight(100.f, 50.f);
-	FHitResult LedgeHitResult = TraceFromEyeHeight(50.f, 0.f);
+	// 위로 등반 중일 때만 렛지에 도달한 것으로 간주
+	return GetUnrotatedClimbVelocity().Z > 10.f && CanTopOut();
+}
 
-	if (!LedgeHitResult.bBlockingHit)
+bool UCustomMovementComponent::CanTopOut()
+{
+	// 렛지로 올라설 수 없는 표면으로 태그된 경우
+	if (!CurrentClimbSurfaceProperties.bLedgeCapable)
 	{
-		const FVector WalkableSurfaceTraceStart = LedgeHitResult.TraceEnd;
-		const FVector DownVector = -UpdatedComponent->GetUpVector();
-		const FVector WalkableSurfaceTraceEnd = WalkableSurfaceTraceStart + DownVector * 100.f;
-
-		FHitResult WalkableSurfaceHitResult = DoLineTraceSingleByObject(WalkableSurfaceTraceStart, WalkableSurfaceTraceEnd, false, false);
+		return false;
+	}
 
-		if (WalkableSurfaceHitResult.bBlockingHit && GetUnrotatedClimbVelocity().Z > 10.f)
-		{
-			return true;
-		}
+	if (const ALandscapeProxy* Landscape = GetTrackedLandscape())
+	{
+		return CanTopOutOnLandscape(Landscape);
 	}
 
-	return false;
+	FClimbMovementRuleTracer Tracer(*this);
+	return ClimbRules::CanTopOut(GetClimbRuleSettings(), GetClimbProbePose(), Tracer);
 }
 
 bool UCustomMovementComponent::CanClimbDownLedge()
@@ -302,24 +1103,12 @@ bool UCustomMovementComponent::CanClimbDownLedge()
 		return false;
 	}
 
-	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
-	const FVector ComponentForward = UpdatedComponent->GetForwardVector();
-	const FVector DownVector = -UpdatedComponent->GetUpVector();
-
-	const FVector WalkableSurfaceTraceStart = ComponentLocation + ComponentForward * ClimbDownWalkableSurfaceTraceOffset;
-	const FVector WalkableSurfaceTraceEnd = WalkableSurfaceTraceStart + DownVector * 100.f;
-
-	const FHitResult WalkableSurfaceHit = DoLineTraceSingleByObject(WalkableSurfaceTraceStart, WalkableSurfaceTraceEnd, false, false);
+	FClimbMovementRuleTracer Tracer(*this);
+	FHitResult WalkableSurfaceHit;
 
-	const FVector LedgeTraceStart = WalkableSurfaceHit.TraceStart + ComponentForward * ClimbDownLedgeTraceOffset;
-	const FVector LedgeTraceEnd = LedgeTraceStart + DownVector * 200.f;
-	// const FVector LedgeTraceEnd = LedgeTraceStart + DownVector * 300.f;
-
-	const FHitResult LedgeTraceHit = DoLineTraceSingleByObject(LedgeTraceStart, LedgeTraceEnd, false, false);
-
-	if (WalkableSurfaceHit.bBlockingHit && !LedgeTraceHit.bBlockingHit)
+	if (ClimbRules::CanClimbDownLedge(GetClimbRuleSettings(), GetClimbProbePose(), Tracer, WalkableSurfaceHit))
 	{
-		return true;
+		return !ClimbSurfaceSubsystem || ClimbSurfaceSubsystem->GetSurfaceProperties(WalkableSurfaceHit).bLedgeCapable;
 	}
 
 	return false;
@@ -349,44 +1138,8 @@ bool UCustomMovementComponent::CanStartVaulting(FVector& OutVaultStartPosition,
 		return false;
 	}
 
-	OutVaultStartPosition = FVector::ZeroVector;
-	OutVaultLandPosition = FVector::ZeroVector;
-	
-	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
-	const FVector ComponentForward = UpdatedComponent->GetForwardVector();
-	const FVector UpVector = UpdatedComponent->GetUpVector();
-	const FVector DownVector = -UpdatedComponent->GetUpVector();
-
-	for (int32 i = 0; i < VaultTraceSteps; ++i)
-	{
-		const FVector StartTrace = ComponentLocation + UpVector * 100.f + ComponentForward * 80.f * (i + 1);
-		const FVector EndTrace = StartTrace + DownVector * 100.f * (i + 1);
-
-		const FHitResult VaultTraceHit = DoLineTraceSingleByObject(StartTrace, EndTrace, false, false);
-
-		const FVector VaultingTraceHitImpactPoint = VaultTraceHit.ImpactPoint;
-
-		// 첫번째 볼팅 위치 선정
-		if (i == 0 && VaultTraceHit.bBlockingHit)
-		{
-			OutVaultStartPosition = VaultingTraceHitImpactPoint;
-		}
-
-		if (i == VaultLandTraceIndex && VaultTraceHit.bBlockingHit)
-		{
-			OutVaultLandPosition = VaultingTraceHitImpactPoint;
-		}
-	}
-
-	if (OutVaultStartPosition != FVector::ZeroVector && OutVaultLandPosition != FVector::ZeroVector)
-	{
-		return true;
-	}
-	else
-	{
-		return false;
-	}
-	
+	FClimbMovementRuleTracer Tracer(*this);
+	return ClimbRules::CanStartVaulting(GetClimbRuleSettings(), GetClimbProbePose(), Tracer, OutVaultStartPosition, OutVaultLandPosition);
 }
 
 void UCustomMovementComponent::TryStartVaulting()
@@ -400,7 +1153,7 @@ void UCustomMovementComponent::TryStartVaulting()
 		SetMotionWarpTarget(VaultLandPointName, VaultLandPosition);
 		
 		StartClimbing();
-		PlayClimbMontage(VaultMontage);
+		PlayClimbMontage(GetClimbActionMontage(EClimbAction::Vault));
 	}
 }
 
@@ -416,18 +1169,41 @@ void UCustomMovementComponent::StopClimbing()
 
 void UCustomMovementComponent::PhysClimb(float deltaTime, int32 Iterations)
 {
+	SCOPE_CYCLE_COUNTER(STAT_PhysClimb);
+
 	// 너무 짧은 델타 타임(즉, 거의 시간이 흐르지 않은 프레임)에서는 물리 계산을 생략
 	if (deltaTime < MIN_TICK_TIME)
 	{
 		return;
 	}
 
-	TraceClimbableSurfaces();
-	ProcessClimbableSurfaceInfo();
+	// 미리 찾아 둔 모서리에 도달했으면 전환 시작. 전환 중에는 표면이 스윕 범위를 벗어나므로 표면 추적 / 이탈 판정을 생략
+	const bool bInCornerTransition = bCornerTransitionActive || TryStartCornerTransition();
 
-	if (CheckShouldStopClimbing() || CheckHasReachedFloor())
+	if (!bInCornerTransition)
 	{
-		StopClimbing();
+		// 베이스 기준으로 움직이지 않았다면 (정지해 매달려 있거나 베이스와 함께 이동 중) 캐시된 표면을 재사용
+		if (CanReuseClimbSurfaceCache())
+		{
+			RestoreClimbSurfaceFromBase();
+		}
+		else if (!SampleClimbSurfaceFromDistanceField())
+		{
+			// 랜드스케이프 위에서는 하이트필드를 직접 샘플링하고, 실패하면 (가장자리 / 구멍) 스윕으로 대체
+			const ALandscapeProxy* Landscape = GetTrackedLandscape();
+			if (!Landscape || !TraceLandscapeClimbableSurfaces(Landscape))
+			{
+				TraceClimbableSurfaces();
+			}
+
+			ProcessClimbableSurfaceInfo();
+			UpdateClimbSurfaceBase();
+		}
+
+		if (CheckShouldStopClimbing() || CheckHasReachedFloor())
+		{
+			StopClimbing();
+		}
 	}
 
 	// 루트 모션(root motion) 적용 전의 속도를 복원
@@ -473,12 +1249,17 @@ void UCustomMovementComponent::PhysClimb(float deltaTime, int32 Iterations)
 		Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / deltaTime;
 	}
 
+	if (bInCornerTransition)
+	{
+		TickCornerTransition(deltaTime);
+		return;
+	}
+
 	SnapMovementToClimbableSurfaces(deltaTime);
 
 	if (CheckHasReachedLedge())
 	{
-		StopClimbing();
-		PlayClimbMontage(ClimbToTopMontage);
+		HandleReachedLedge();
 	}
 }
 
@@ -504,6 +1285,7 @@ void UCustomMovementComponent::ProcessClimbableSurfaceInfo()
 	// 현재 등반 가능한 표면의 위치와 노멀(법선 벡터)을 초기화
 	CurrentClimbableSurfaceLocation = FVector::ZeroVector;
 	CurrentClimbableSurfaceNormal = FVector::ZeroVector;
+	CurrentClimbSurfaceProperties = FClimbSurfaceProperties();
 	
 	// 등반 가능한 표면을 감지한 결과(Trace 결과)가 없으면 바로 반환
 	if (ClimbableSurfacesTracedResults.IsEmpty())
@@ -523,23 +1305,146 @@ void UCustomMovementComponent::ProcessClimbableSurfaceInfo()
 
 	// 평균 노멀 계산 후 단위 벡터로 정규화
 	CurrentClimbableSurfaceNormal = CurrentClimbableSurfaceNormal.GetSafeNormal();
+
+	// 스윕 결과는 거리순으로 정렬되어 있으므로 가장 가까운 표면의 속성을 사용 (캐시 조회이므로 O(1))
+	if (ClimbSurfaceSubsystem)
+	{
+		CurrentClimbSurfaceProperties = ClimbSurfaceSubsystem->GetSurfaceProperties(ClimbableSurfacesTracedResults[0]);
+	}
 }
 
 /**
- * @brief 캐릭터를 현재 등반 가능한 표면에 부드럽게 밀착시키는 함수입니다.
- *
- * 캐릭터의 현재 위치와 등반 표면의 위치(`CurrentClimbableSurfaceLocation`)를 비교하여,
- * 캐릭터가 벽면과 일정 거리 이상 떨어져 있을 경우, 표면 방향으로 보정 이동시킵니다.
- * 
- * @param DeltaTime 프레임 간 경과 시간 (프레임 독립적 보간용)
- *
- * 동작 과정:
- * 1. 캐릭터의 전방 벡터(`ForwardVector`)와 위치를 구합니다.
- * 2. 캐릭터에서 벽까지의 벡터를 전방축에 투영하여 벽과의 거리(떨어진 정도)를 계산합니다.  
- * 3. 그 거리만큼 벽의 법선 반대 방향(-Normal)으로 이동 벡터(`SnapVector`)를 구합니다.  
- * 4. `MoveComponent()`를 통해 부드럽게 이동시켜 벽면에 밀착시킵니다.
+ * @brief 가장 가까운 표면을 등반 베이스로 삼아 표면 정보를 베이스 로컬 공간에 캐싱
  *
- * @note 등반 중 캐릭터가 벽에서 미세하게 떨어져 있거나, 
+ * 표면이 움직이는 프리미티브(엘리베이터, 배, 회전 발판 등)라면 무브먼트 베이스로 지정하여
+ * UpdateBasedMovement 가 매 틱 캐릭터를 베이스와 함께 이동 / 회전시키도록 합니다.
+ */
+void UCustomMovementComponent::UpdateClimbSurfaceBase()
+{
+	UPrimitiveComponent* SurfaceComponent = ClimbableSurfacesTracedResults.IsEmpty() ? nullptr : ClimbableSurfacesTracedResults[0].GetComponent();
+	UPrimitiveComponent* DesiredMovementBase = MovementBaseUtility::IsDynamicBase(SurfaceComponent) ? SurfaceComponent : nullptr;
+
+	if (GetMovementBase() != DesiredMovementBase)
+	{
+		CharacterOwner->SetBase(DesiredMovementBase);
+	}
+
+	// 렛지에 도달하기 전에 쉬미할 렛지를 비동기로 추출해 둠 (캐시에 있으면 조회만)
+	if (bEnableLedgeShimmy && ClimbLedgeSubsystem && SurfaceComponent && SurfaceComponent != ClimbSurfaceBase.Get())
+	{
+		ClimbLedgeSubsystem->RequestLedges(SurfaceComponent, true);
+	}
+
+	ClimbSurfaceBase = SurfaceComponent;
+	bHasClimbSurfaceCache = SurfaceComponent != nullptr;
+
+	if (!bHasClimbSurfaceCache)
+	{
+		return;
+	}
+
+	// 베이스 스케일과 무관하게 거리 임계값을 쓰도록 스케일 없는 변환 사용
+	const FTransform BaseTransform = SurfaceComponent->GetComponentTransform();
+	LocalClimbableSurfaceLocation = BaseTransform.InverseTransformPositionNoScale(CurrentClimbableSurfaceLocation);
+	LocalClimbableSurfaceNormal = BaseTransform.InverseTransformVectorNoScale(CurrentClimbableSurfaceNormal);
+	LocalClimbProbeLocation = BaseTransform.InverseTransformPositionNoScale(UpdatedComponent->GetComponentLocation());
+	LocalClimbProbeRotation = BaseTransform.InverseTransformRotation(UpdatedComponent->GetComponentQuat());
+}
+
+bool UCustomMovementComponent::CanReuseClimbSurfaceCache() const
+{
+	// 루트 모션(홉 등)은 한 틱에 크게 움직일 수 있으므로 항상 다시 트레이스
+	if (!bHasClimbSurfaceCache || ClimbableSurfacesTracedResults.IsEmpty() || HasAnimRootMotion() || CurrentRootMotion.HasOverrideVelocity())
+	{
+		return false;
+	}
+
+	const UPrimitiveComponent* SurfaceComponent = ClimbSurfaceBase.Get();
+	if (!SurfaceComponent)
+	{
+		return false;
+	}
+
+	const FTransform BaseTransform = SurfaceComponent->GetComponentTransform();
+	const FVector LocalLocation = BaseTransform.InverseTransformPositionNoScale(UpdatedComponent->GetComponentLocation());
+	const FQuat LocalRotation = BaseTransform.InverseTransformRotation(UpdatedComponent->GetComponentQuat());
+
+	const float ReprobeScale = GetClimbProbeQuality().ReprobeScale;
+
+	return FVector::DistSquared(LocalLocation, LocalClimbProbeLocation) <= FMath::Square(ClimbReprobeDistance * ReprobeScale)
+		&& LocalRotation.AngularDistance(LocalClimbProbeRotation) <= FMath::DegreesToRadians(ClimbReprobeAngle * ReprobeScale);
+}
+
+void UCustomMovementComponent::RestoreClimbSurfaceFromBase()
+{
+	const FTransform BaseTransform = ClimbSurfaceBase->GetComponentTransform();
+	CurrentClimbableSurfaceLocation = BaseTransform.TransformPositionNoScale(LocalClimbableSurfaceLocation);
+	CurrentClimbableSurfaceNormal = BaseTransform.TransformVectorNoScale(LocalClimbableSurfaceNormal);
+}
+
+/**
+ * @brief 정적 표면 위에서 마지막 스윕 근처를 움직이는 동안 스윕 대신 거리장으로 표면 위치 / 법선을 갱신
+ *
+ * 표면 속성 / 베이스 / 트레이스 결과는 마지막 스윕 것을 그대로 쓰고, 스윕 위치에서 멀어지거나 법선이 달라지면
+ * false 를 반환해 스윕으로 정밀하게 다시 잡습니다 (필드에 없는 지오메트리도 그때 감지됨).
+ */
+bool UCustomMovementComponent::SampleClimbSurfaceFromDistanceField()
+{
+	if (!bUseClimbDistanceField || !ClimbDistanceFieldSubsystem || !bHasClimbSurfaceCache || ClimbableSurfacesTracedResults.IsEmpty()
+		|| HasAnimRootMotion() || CurrentRootMotion.HasOverrideVelocity())
+	{
+		return false;
+	}
+
+	// 필드는 정적 지오메트리로만 빌드됨
+	const UPrimitiveComponent* SurfaceComponent = ClimbSurfaceBase.Get();
+	if (!SurfaceComponent || SurfaceComponent->Mobility != EComponentMobility::Static)
+	{
+		return false;
+	}
+
+	const FTransform BaseTransform = SurfaceComponent->GetComponentTransform();
+	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+
+	if (FVector::DistSquared(ComponentLocation, BaseTransform.TransformPositionNoScale(LocalClimbProbeLocation)) > FMath::Square(ClimbDistanceFieldResweepDistance * GetClimbProbeQuality().SurfaceFitResweepScale))
+	{
+		return false;
+	}
+
+	float SurfaceDistance;
+	FVector SurfaceNormal;
+	if (!ClimbDistanceFieldSubsystem->SampleDistance(ComponentLocation, SurfaceDistance, SurfaceNormal))
+	{
+		return false;
+	}
+
+	const FVector SweptNormal = BaseTransform.TransformVectorNoScale(LocalClimbableSurfaceNormal);
+	if (FVector::DotProduct(SurfaceNormal, SweptNormal) < FMath::Cos(FMath::DegreesToRadians(ClimbDistanceFieldMaxNormalDeviation)))
+	{
+		return false;
+	}
+
+	CurrentClimbableSurfaceLocation = ComponentLocation - SurfaceNormal * SurfaceDistance;
+	CurrentClimbableSurfaceNormal = SurfaceNormal;
+
+	return true;
+}
+
+/**
+ * @brief 캐릭터를 현재 등반 가능한 표면에 부드럽게 밀착시키는 함수입니다.
+ *
+ * 캐릭터의 현재 위치와 등반 표면의 위치(`CurrentClimbableSurfaceLocation`)를 비교하여,
+ * 캐릭터가 벽면과 일정 거리 이상 떨어져 있을 경우, 표면 방향으로 보정 이동시킵니다.
+ * 
+ * @param DeltaTime 프레임 간 경과 시간 (프레임 독립적 보간용)
+ *
+ * 동작 과정:
+ * 1. 캐릭터의 전방 벡터(`ForwardVector`)와 위치를 구합니다.
+ * 2. 캐릭터에서 벽까지의 벡터를 전방축에 투영하여 벽과의 거리(떨어진 정도)를 계산합니다.  
+ * 3. 그 거리만큼 벽의 법선 반대 방향(-Normal)으로 이동 벡터(`SnapVector`)를 구합니다.  
+ * 4. `MoveComponent()`를 통해 부드럽게 이동시켜 벽면에 밀착시킵니다.
+ *
+ * @note 등반 중 캐릭터가 벽에서 미세하게 떨어져 있거나, 
  *       프레임별 위치 보정이 필요한 상황에서 사용됩니다.
  *
  * @see UPrimitiveComponent::MoveComponent
@@ -574,12 +1479,40 @@ void UCustomMovementComponent::SnapMovementToClimbableSurfaces(float DeltaTime)
 
 void UCustomMovementComponent::PlayClimbMontage(TObjectPtr<UAnimMontage> MontageToPlay)
 {
-	if (!MontageToPlay || !OwningPlayerAnimInstance || OwningPlayerAnimInstance->IsAnyMontagePlaying())
+	if (!MontageToPlay || IsClimbActionPlaying())
+	{
+		return;
+	}
+
+	// 끝날 때 같은 동작으로 처리하도록 시작 시점 프로필 기준의 동작을 기록 (재생 중 프로필이 바뀌어도 유지)
+	EClimbAction Action;
+	if (FindClimbActionForMontage(MontageToPlay, Action))
+	{
+		PlayingClimbActionMontage = MontageToPlay;
+		PlayingClimbAction = Action;
+	}
+	else
+	{
+		PlayingClimbActionMontage = nullptr;
+	}
+
+	WakeClimbTick();
+
+	// 리플리케이션 그래프가 멀리 있는 등반 캐릭터를 드물게 보내므로 전환 시작은 바로 보냄
+	if (CharacterOwner->HasAuthority())
+	{
+		CharacterOwner->ForceNetUpdate();
+	}
+
+	if (UsesBakedClimbTransitions() && StartBakedClimbTransition(MontageToPlay))
 	{
 		return;
 	}
 
-	OwningPlayerAnimInstance->Montage_Play(MontageToPlay);
+	if (OwningPlayerAnimInstance)
+	{
+		OwningPlayerAnimInstance->Montage_Play(MontageToPlay);
+	}
 }
 
 void UCustomMovementComponent::SetMotionWarpTarget(const FName& InWarpTargetName, const FVector& InTargetPosition)
@@ -589,6 +1522,19 @@ void UCustomMovementComponent::SetMotionWarpTarget(const FName& InWarpTargetName
 		return;
 	}
 
+	FClimbPredictedWarpTarget* RecentWarpTarget = RecentWarpTargets.FindByPredicate([&InWarpTargetName](const FClimbPredictedWarpTarget& WarpTarget)
+	{
+		return WarpTarget.Name == InWarpTargetName;
+	});
+
+	if (!RecentWarpTarget)
+	{
+		RecentWarpTarget = &RecentWarpTargets.AddDefaulted_GetRef();
+		RecentWarpTarget->Name = InWarpTargetName;
+	}
+
+	RecentWarpTarget->Location = InTargetPosition;
+
 	OwningPlayerCharacter->GetMotionWarpingComponent()->AddOrUpdateWarpTargetFromLocation(InWarpTargetName, InTargetPosition);
 }
 
@@ -617,6 +1563,13 @@ FQuat UCustomMovementComponent::GetClimbRotation(float DeltaTime)
 	// 현재 캐릭터(또는 이동 컴포넌트)의 회전값(쿼터니언 형태)을 가져옴
 	const FQuat CurrentQuat = UpdatedComponent->GetComponentQuat();
 
+	// 모서리 전환 중에는 전환 진행도에 맞춰 새 면을 향하도록 회전
+	if (bCornerTransitionActive)
+	{
+		const float TransitionAlpha = FMath::Clamp(CornerTransitionElapsed / CornerTransitionDurationTotal, 0.f, 1.f);
+		return FQuat::Slerp(CornerTransitionStartRotation, CornerTransitionTargetRotation, FMath::SmoothStep(0.f, 1.f, TransitionAlpha));
+	}
+
 	// 루트모션 애니메이션이 활성화되어 있거나, 현재 루트모션이 강제로 속도를 덮어쓰는 중이면
 	// 애니메이션 주도 하에 회전해야 하므로 현재 회전을 그대로 반환
 	if (HasAnimRootMotion() || CurrentRootMotion.HasOverrideVelocity())
@@ -636,102 +1589,2788 @@ FQuat UCustomMovementComponent::GetClimbRotation(float DeltaTime)
 
 void UCustomMovementComponent::OnClimbMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 {
+	// 서버가 거절해 되돌린 예측 몽타주는 상태를 바꾸지 않음 (블렌드 아웃이 끝나면 기록 해제)
+	if (Montage && Montage == RolledBackClimbMontage)
+	{
+		if (!OwningPlayerAnimInstance || !OwningPlayerAnimInstance->Montage_IsActive(Montage))
+		{
+			RolledBackClimbMontage = nullptr;
+		}
+
+		return;
+	}
+
+	// 블렌드 아웃 / 종료 중 먼저 온 이벤트에서 한 번만 처리
+	if (!Montage || Montage != PlayingClimbActionMontage)
+	{
+		return;
+	}
+
+	PlayingClimbActionMontage = nullptr;
+
 	// 클라이밍 상태로 진입
-	if (Montage == IdleToClimbMontage || Montage == ClimbDownLedgeMontage)
+	if (PlayingClimbAction == EClimbAction::EnterClimb || PlayingClimbAction == EClimbAction::ClimbDownLedge)
 	{
 		StartClimbing();
 		StopMovementImmediately();
 	}
 	
-	if (Montage == ClimbToTopMontage || Montage == VaultMontage)
+	if (PlayingClimbAction == EClimbAction::TopOut || PlayingClimbAction == EClimbAction::Vault)
 	{
 		SetMovementMode(MOVE_Walking);
 	}
 }
 
-TArray<FHitResult> UCustomMovementComponent::DoCapsuleTraceMultiByObject(const FVector & Start, const FVector & End, bool bShowDebugShape, bool bDrawPersistantShapes)
-{	
-	TArray<FHitResult> OutCapsuleTraceHitResults;
+void UCustomMovementComponent::FollowClimbRoute(const TArray<FClimbRouteWaypoint>& InRoute, FOnClimbRouteFinished InOnFinished)
+{
+	AbortClimbRoute();
+	WakeClimbTick();
+
+	if (InRoute.IsEmpty())
+	{
+		InOnFinished.ExecuteIfBound(true);
+		return;
+	}
+
+	ActiveClimbRoute = InRoute;
+	ActiveClimbRouteIndex = 0;
+	ClimbRouteClosestDistance = TNumericLimits<float>::Max();
+	ClimbRouteStuckTime = 0.f;
+	bClimbRouteActionIssued = false;
+	OnClimbRouteFinished = MoveTemp(InOnFinished);
+}
+
+void UCustomMovementComponent::AbortClimbRoute()
+{
+	if (IsFollowingClimbRoute())
+	{
+		FinishClimbRoute(false);
+	}
+}
+
+/**
+ * @brief AI 등반 경로를 한 틱 진행
+ *
+ * 현재 웨이포인트에 도달하는 데 필요한 엣지 종류에 따라
+ * 이동 입력을 넣거나(Climb / TopOut), 등반 동작(ToggleClimbing, 홉)을 요청합니다.
+ * 동작 몽타주가 재생되는 동안에는 대기하고, 일정 시간 진행이 없으면 경로를 실패 처리합니다.
+ */
+void UCustomMovementComponent::TickClimbRoute(float DeltaTime)
+{
+	if (!IsFollowingClimbRoute())
+	{
+		return;
+	}
+
+	// 등반 동작 몽타주가 재생 중이면 끝날 때까지 대기
+	if (IsClimbActionPlaying())
+	{
+		return;
+	}
 
-	EDrawDebugTrace::Type DebugTraceType = EDrawDebugTrace::None;
+	const FClimbRouteWaypoint& Waypoint = ActiveClimbRoute[ActiveClimbRouteIndex];
+	const FVector ToWaypoint = Waypoint.Location - UpdatedComponent->GetComponentLocation();
+	const float DistanceToWaypoint = ToWaypoint.Size();
 
-	if(bShowDebugShape)
+	// 목표에 가까워지지 않는 상태가 계속되면 경로 실패
+	if (DistanceToWaypoint < ClimbRouteClosestDistance - 1.f)
+	{
+		ClimbRouteClosestDistance = DistanceToWaypoint;
+		ClimbRouteStuckTime = 0.f;
+	}
+	else
 	{
-		DebugTraceType = EDrawDebugTrace::ForOneFrame;
+		ClimbRouteStuckTime += DeltaTime;
 
-		if(bDrawPersistantShapes)
+		if (ClimbRouteStuckTime > ClimbRouteStuckTimeout)
 		{
-			DebugTraceType = EDrawDebugTrace::Persistent;
+			FinishClimbRoute(false);
+			return;
 		}
 	}
 
-	UKismetSystemLibrary::CapsuleTraceMultiForObjects(
-		this,
-		Start,
-		End,
-		ClimbCapsuleTraceRadius,
-		ClimbCapsuleTraceHalfHeight,
-		ClimbableSurfaceTraceTypes,
-		false,
-		TArray<AActor*>(),
-		DebugTraceType,
-		OutCapsuleTraceHitResults,
-		false
-	);
-
-	return OutCapsuleTraceHitResults;
+	TickClimbRouteAction(Waypoint, ToWaypoint);
 }
 
-FHitResult UCustomMovementComponent::DoLineTraceSingleByObject(const FVector& Start, const FVector& End, bool bInShowDebugShape, bool bInDrawPersistantShapes)
+void UCustomMovementComponent::TickClimbRouteAction(const FClimbRouteWaypoint& Waypoint, const FVector& ToWaypoint)
 {
-	FHitResult OutResult;
-	
-	EDrawDebugTrace::Type DebugTraceType = EDrawDebugTrace::None;
-
-	if (bInShowDebugShape)
+	switch (Waypoint.ArrivalEdge)
 	{
-		DebugTraceType = EDrawDebugTrace::ForOneFrame;
+	case EClimbRouteEdgeType::Climb:
+		if (!IsClimbing())
+		{
+			FinishClimbRoute(false);
+		}
+		else if (ToWaypoint.Size() <= ClimbRouteAcceptanceRadius)
+		{
+			AdvanceClimbRoute();
+		}
+		else
+		{
+			AddInputVector(ToWaypoint.GetSafeNormal());
+		}
+		break;
+
+	case EClimbRouteEdgeType::Enter:
+	case EClimbRouteEdgeType::ClimbDown:
+	case EClimbRouteEdgeType::Vault:
+		if (bClimbRouteActionIssued)
+		{
+			// 몽타주 종료 후: 볼팅은 걷기로, 나머지는 등반 상태로 끝나야 성공
+			const bool bSucceeded = Waypoint.ArrivalEdge == EClimbRouteEdgeType::Vault ? !IsClimbing() : IsClimbing();
+			bSucceeded ? AdvanceClimbRoute() : FinishClimbRoute(false);
+			break;
+		}
+
+		ToggleClimbing(true);
+
+		if (IsClimbActionPlaying())
+		{
+			bClimbRouteActionIssued = true;
+		}
+		else
+		{
+			// 아직 동작 조건이 맞지 않으면 목표 쪽으로 걸어가면서 다음 틱에 다시 시도
+			AddInputVector(FVector(ToWaypoint.X, ToWaypoint.Y, 0.f).GetSafeNormal());
+		}
+		break;
+
+	case EClimbRouteEdgeType::HopUp:
+	case EClimbRouteEdgeType::HopDown:
+		if (bClimbRouteActionIssued || !IsClimbing())
+		{
+			IsClimbing() ? AdvanceClimbRoute() : FinishClimbRoute(false);
+			break;
+		}
+
+		HandleHop(Waypoint.ArrivalEdge == EClimbRouteEdgeType::HopUp ? EClimbHopDirection::Up : EClimbHopDirection::Down);
+
+		if (IsClimbActionPlaying())
+		{
+			bClimbRouteActionIssued = true;
+		}
+		else
+		{
+			FinishClimbRoute(false);
+		}
+		break;
 
-		if (bInDrawPersistantShapes)
+	case EClimbRouteEdgeType::TopOut:
+		if (IsClimbing())
+		{
+			// 렛지를 감지할 때까지 위로 등반 (CheckHasReachedLedge 가 ClimbToTop 을 재생)
+			AddInputVector(UpdatedComponent->GetUpVector());
+		}
+		else if (IsMovingOnGround())
 		{
-			DebugTraceType = EDrawDebugTrace::Persistent;
+			AdvanceClimbRoute();
+		}
+		else
+		{
+			FinishClimbRoute(false);
+		}
+		break;
 
+	case EClimbRouteEdgeType::Drop:
+		if (IsClimbing())
+		{
+			ToggleClimbing(false);
+		}
+		else if (IsMovingOnGround())
+		{
+			AdvanceClimbRoute();
 		}
+		break;
 	}
-	
-	UKismetSystemLibrary::LineTraceSingleForObjects(
-	this,
-		Start,
-		End,
-		ClimbableSurfaceTraceTypes,
-		false,
-		TArray<AActor*>(),
-		DebugTraceType,
-		OutResult,
-		false
-	);
+}
 
-	return OutResult;
+void UCustomMovementComponent::AdvanceClimbRoute()
+{
+	++ActiveClimbRouteIndex;
+	ClimbRouteClosestDistance = TNumericLimits<float>::Max();
+	ClimbRouteStuckTime = 0.f;
+	bClimbRouteActionIssued = false;
+
+	if (!IsFollowingClimbRoute())
+	{
+		FinishClimbRoute(true);
+	}
 }
 
-bool UCustomMovementComponent::TraceClimbableSurfaces()
+void UCustomMovementComponent::FinishClimbRoute(bool bSuccess)
 {
-	const FVector StartOffset = UpdatedComponent->GetForwardVector() * 30.f;
-	const FVector Start = UpdatedComponent->GetComponentLocation() + StartOffset;
-	const FVector End = Start + UpdatedComponent->GetForwardVector();
-	
-	ClimbableSurfacesTracedResults = DoCapsuleTraceMultiByObject(Start, End, false, false);
+	// 콜백 안에서 새 경로를 시작할 수 있으므로 상태를 먼저 정리
+	const FOnClimbRouteFinished FinishedDelegate = MoveTemp(OnClimbRouteFinished);
+	OnClimbRouteFinished.Unbind();
 
-	return !ClimbableSurfacesTracedResults.IsEmpty();
+	ActiveClimbRoute.Reset();
+	ActiveClimbRouteIndex = INDEX_NONE;
+	bClimbRouteActionIssued = false;
+
+	FinishedDelegate.ExecuteIfBound(bSuccess);
 }
 
-FHitResult UCustomMovementComponent::TraceFromEyeHeight(float TraceDistance, float TraceStartOffset, bool bInShowDebugShape, bool bInDrawPersistantShapes)
+#pragma region Climb Profile
+
+void UCustomMovementComponent::SetClimbProfile(UClimbProfileDataAsset* InClimbProfile, FName InVariant)
 {
-	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
-	const FVector EyeHeightOffset = UpdatedComponent->GetUpVector() * (CharacterOwner->BaseEyeHeight + TraceStartOffset);
+	if (ClimbProfile == InClimbProfile && ClimbProfileVariant == InVariant)
+	{
+		return;
+	}
+
+	ClimbProfile = InClimbProfile;
+	ClimbProfileVariant = InVariant;
+
+	ApplyClimbProfileTuning();
+
+	// 이전 몽타주는 새 세트가 로드될 때까지 유지 (재생 중인 몽타주가 끊기지 않도록)
+	const bool bWasRequested = bClimbMontagesRequested;
+	bClimbMontagesRequested = false;
+
+	if (bWasRequested || bPreloadClimbMontages)
+	{
+		RequestClimbMontages();
+	}
+}
+
+void UCustomMovementComponent::ApplyClimbProfileTuning()
+{
+	if (!ClimbProfile)
+	{
+		return;
+	}
+
+	const FClimbTuning& Tuning = ClimbProfile->Tuning;
+	ClimbCapsuleTraceRadius = Tuning.ClimbCapsuleTraceRadius;
+	ClimbCapsuleTraceHalfHeight = Tuning.ClimbCapsuleTraceHalfHeight;
+	MaxBreakClimbDeceleration = Tuning.MaxBreakClimbDeceleration;
+	MaxClimbSpeed = Tuning.MaxClimbSpeed;
+	MaxClimbAcceleration = Tuning.MaxClimbAcceleration;
+	ClimbDownWalkableSurfaceTraceOffset = Tuning.ClimbDownWalkableSurfaceTraceOffset;
+	ClimbDownLedgeTraceOffset = Tuning.ClimbDownLedgeTraceOffset;
+	MaxClimbableSurfaceAngle = Tuning.MaxClimbableSurfaceAngle;
+}
+
+FClimbMontageSet UCustomMovementComponent::GetComponentClimbMontages() const
+{
+	FClimbMontageSet ComponentMontages;
+	ComponentMontages.IdleToClimbMontage = IdleToClimbMontage;
+	ComponentMontages.ClimbToTopMontage = ClimbToTopMontage;
+	ComponentMontages.ClimbDownLedgeMontage = ClimbDownLedgeMontage;
+	ComponentMontages.VaultMontage = VaultMontage;
+	ComponentMontages.HopUpMontage = HopUpMontage;
+	ComponentMontages.HopDownMontage = HopDownMontage;
+	ComponentMontages.HopLeftMontage = HopLeftMontage;
+	ComponentMontages.HopRightMontage = HopRightMontage;
+	ComponentMontages.LedgeCatchMontage = LedgeCatchMontage;
+	ComponentMontages.ShimmyDropMontage = ShimmyDropMontage;
+	ComponentMontages.HopUpLeftMontage = HopUpLeftMontage;
+	ComponentMontages.HopUpRightMontage = HopUpRightMontage;
+	ComponentMontages.HopDownLeftMontage = HopDownLeftMontage;
+	ComponentMontages.HopDownRightMontage = HopDownRightMontage;
+	return ComponentMontages;
+}
+
+/**
+ * @brief 현재 프로필 (없으면 컴포넌트 기본값) 의 몽타주를 에셋 매니저로 비동기 로드
+ *
+ * 로드가 끝나기 전까지 GetClimbActionMontage 는 nullptr 을 반환하므로 해당 동작은 재생되지 않습니다.
+ * 이미 요청했다면 아무것도 하지 않습니다.
+ */
+void UCustomMovementComponent::RequestClimbMontages()
+{
+	if (bClimbMontagesRequested)
+	{
+		return;
+	}
+
+	bClimbMontagesRequested = true;
+	ActiveClimbMontages = ClimbProfile ? ClimbProfile->ResolveMontages(ClimbProfileVariant) : GetComponentClimbMontages();
+
+	TArray<FSoftObjectPath> MontagePaths;
+	for (const EClimbAction Action : TEnumRange<EClimbAction>())
+	{
+		const TSoftObjectPtr<UAnimMontage>& Montage = ActiveClimbMontages.GetMontage(Action);
+		if (!Montage.IsNull())
+		{
+			MontagePaths.AddUnique(Montage.ToSoftObjectPath());
+		}
+	}
+
+	if (ClimbMontagesHandle.IsValid())
+	{
+		ClimbMontagesHandle->CancelHandle();
+	}
+
+	ClimbMontagesHandle = MontagePaths.IsEmpty()
+		? nullptr
+		: UAssetManager::GetStreamableManager().RequestAsyncLoad(MontagePaths, FStreamableDelegate::CreateUObject(this, &ThisClass::OnClimbMontagesLoaded));
+
+	// 로드할 게 없으면 콜백이 오지 않음
+	if (!ClimbMontagesHandle.IsValid())
+	{
+		OnClimbMontagesLoaded();
+	}
+}
+
+void UCustomMovementComponent::OnClimbMontagesLoaded()
+{
+	LoadedClimbMontages.Reset();
+
+	for (const EClimbAction Action : TEnumRange<EClimbAction>())
+	{
+		LoadedClimbMontages.Add(ActiveClimbMontages.GetMontage(Action).Get());
+	}
+
+	// 서버에서 구운 전환을 쓰면 첫 재생 때 멈추지 않도록 로드 시점에 미리 구움
+	if (GetNetMode() == NM_DedicatedServer && bUseBakedClimbTransitionsOnServer)
+	{
+		for (const UAnimMontage* LoadedMontage : LoadedClimbMontages)
+		{
+			ClimbRootMotion::FindOrBake(LoadedMontage);
+		}
+	}
+
+	bClimbMontagesLoaded = true;
+}
 
-	const FVector Start = ComponentLocation + EyeHeightOffset;
-	const FVector End = Start + UpdatedComponent->GetForwardVector() * TraceDistance;
+#pragma endregion
 
-	return DoLineTraceSingleByObject(Start, End, bInShowDebugShape, bInDrawPersistantShapes);
+#pragma region Hop
+
+bool UCustomMovementComponent::HandleHop(EClimbHopDirection Direction)
+{
+	FVector HopTargetPosition;
+	const bool bFoundTarget = IsHopCandidateCacheValid()
+		? GetCachedHopCandidate(Direction, HopTargetPosition)
+		: TraceHopCandidate(Direction, HopTargetPosition);
+
+	if (bFoundTarget)
+	{
+		StartHop(Direction, HopTargetPosition);
+	}
+
+	return bFoundTarget;
+}
+
+void UCustomMovementComponent::StartHop(EClimbHopDirection Direction, const FVector& TargetPosition)
+{
+	LastHopDirection = Direction;
+
+	const FVector2D DirectionVector = ClimbHop::GetDirectionVector(Direction);
+
+	// 대각선 슬롯이 비어 있으면 위 / 아래 몽타주를 옆으로 워핑 (대각선 몽타주도 위 / 아래 홉과 같은 워프 타겟을 씀)
+	UAnimMontage* HopMontage = GetClimbActionMontage(ClimbHop::GetHopAction(Direction));
+	if (!HopMontage && DirectionVector.X != 0.f && DirectionVector.Y != 0.f)
+	{
+		HopMontage = GetClimbActionMontage(DirectionVector.Y > 0.f ? EClimbAction::HopUp : EClimbAction::HopDown);
+	}
+
+	if (DirectionVector.Y > 0.f)
+	{
+		SetMotionWarpTarget(HopUpTargetPointName, TargetPosition);
+	}
+	else if (DirectionVector.Y < 0.f)
+	{
+		SetMotionWarpTarget(HopDownTargetPointName, TargetPosition);
+	}
+	else
+	{
+		SetMotionWarpTarget(HopLateralTargetPointName, TargetPosition);
+	}
+
+	PlayClimbMontage(HopMontage);
+
+	// 홉 이후 위치에서는 후보가 모두 달라짐
+	InvalidateHopCandidates();
+}
+
+/**
+ * @brief 입력 방향과 정렬된 후보 중 도달 가능한 첫 대상을 찾음
+ *
+ * 후보 캐시가 유효하면 트레이스 없이 캐시에서 고르고, 아니면 정렬 순서대로 필요한 후보만 동기 트레이스합니다.
+ * (입력과 정렬된 후보는 최대 세 방향이라 8방향 전체를 트레이스하지 않음)
+ */
+bool UCustomMovementComponent::FindHopTarget(const FVector2D& InputDirection, EClimbHopDirection& OutDirection, FVector& OutTargetPosition)
+{
+	TArray<TPair<float, EClimbHopDirection>, TInlineAllocator<NumHopDirections>> RankedDirections;
+
+	for (const EClimbHopDirection Direction : TEnumRange<EClimbHopDirection>())
+	{
+		const float Alignment = FVector2D::DotProduct(InputDirection, ClimbHop::GetDirectionVector(Direction).GetSafeNormal());
+		if (Alignment >= ClimbHop::MinInputAlignment)
+		{
+			RankedDirections.Emplace(Alignment, Direction);
+		}
+	}
+
+	RankedDirections.Sort([](const TPair<float, EClimbHopDirection>& A, const TPair<float, EClimbHopDirection>& B) { return A.Key > B.Key; });
+
+	const bool bUseCache = IsHopCandidateCacheValid();
+	if (!bUseCache)
+	{
+		bHopCandidatesRequested = true;
+	}
+
+	for (const TPair<float, EClimbHopDirection>& RankedDirection : RankedDirections)
+	{
+		const bool bReachable = bUseCache
+			? GetCachedHopCandidate(RankedDirection.Value, OutTargetPosition)
+			: TraceHopCandidate(RankedDirection.Value, OutTargetPosition);
+
+		if (bReachable)
+		{
+			OutDirection = RankedDirection.Value;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool UCustomMovementComponent::TraceHopCandidate(EClimbHopDirection Direction, FVector& OutTargetPosition)
+{
+	if (!HasHopMontage(Direction))
+	{
+		return false;
+	}
+
+	FVector Start;
+	FVector End;
+	GetHopTrace(Direction, false, Start, End);
+
+	const FHitResult HopHit = DoLineTraceSingleByChannel(Start, End, false, false);
+	if (!HopHit.bBlockingHit)
+	{
+		return false;
+	}
+
+	if (ClimbHop::NeedsSafetyTrace(Direction))
+	{
+		GetHopTrace(Direction, true, Start, End);
+		if (!DoLineTraceSingleByChannel(Start, End, false, false).bBlockingHit)
+		{
+			return false;
+		}
+	}
+
+	OutTargetPosition = HopHit.ImpactPoint;
+	return true;
+}
+
+void UCustomMovementComponent::GetHopTrace(EClimbHopDirection Direction, bool bSafetyTrace, FVector& OutStart, FVector& OutEnd) const
+{
+	const FVector2D DirectionVector = ClimbHop::GetDirectionVector(Direction);
+
+	// 캡슐 중심 기준 높이
+	float TraceHeight = ClimbHop::LevelTraceHeight;
+	if (DirectionVector.Y > 0.f)
+	{
+		TraceHeight = CharacterOwner->BaseEyeHeight + (bSafetyTrace ? ClimbHop::SafetyLedgeTraceOffset : ClimbHop::UpTraceOffset);
+	}
+	else if (DirectionVector.Y < 0.f)
+	{
+		TraceHeight = CharacterOwner->BaseEyeHeight + ClimbHop::DownTraceOffset;
+	}
+
+	OutStart = UpdatedComponent->GetComponentLocation()
+		+ UpdatedComponent->GetUpVector() * TraceHeight
+		+ UpdatedComponent->GetRightVector() * (DirectionVector.X * HopLateralDistance);
+	OutEnd = OutStart + UpdatedComponent->GetForwardVector() * ClimbHop::TraceDistance;
+}
+
+bool UCustomMovementComponent::IsHopCandidateCacheValid() const
+{
+	if (!bHasHopCandidates || !IsClimbing())
+	{
+		return false;
+	}
+
+	return FVector::DistSquared(UpdatedComponent->GetComponentLocation(), HopCandidatesProbeLocation) <= FMath::Square(HopCacheInvalidateDistance)
+		&& FMath::RadiansToDegrees(UpdatedComponent->GetComponentQuat().AngularDistance(HopCandidatesProbeRotation)) <= ClimbHop::CacheMaxAngle;
+}
+
+bool UCustomMovementComponent::GetCachedHopCandidate(EClimbHopDirection Direction, FVector& OutTargetPosition) const
+{
+	if (!IsHopCandidateCacheValid() || !HasHopMontage(Direction))
+	{
+		return false;
+	}
+
+	const FClimbHopCandidate& Candidate = HopCandidates[static_cast<int32>(Direction)];
+	if (!Candidate.bReachable)
+	{
+		return false;
+	}
+
+	// 캐시 이후 조금 움직인 만큼 대상도 옮김
+	OutTargetPosition = Candidate.TargetPosition + (UpdatedComponent->GetComponentLocation() - HopCandidatesProbeLocation);
+	return true;
+}
+
+/**
+ * @brief 옆 홉은 HopLeft / HopRight 몽타주가 있어야 함 (없으면 후보에서 빠져 입력과 인접한 대각선 홉으로 대체)
+ *
+ * 위 / 아래와 대각선은 항상 후보 (대각선은 전용 몽타주가 없으면 HopUp / HopDown 몽타주를 워핑).
+ */
+bool UCustomMovementComponent::HasHopMontage(EClimbHopDirection Direction) const
+{
+	switch (Direction)
+	{
+	case EClimbHopDirection::Left:	return GetClimbActionMontage(EClimbAction::HopLeft) != nullptr;
+	case EClimbHopDirection::Right:	return GetClimbActionMontage(EClimbAction::HopRight) != nullptr;
+	default:						return true;
+	}
+}
+
+/**
+ * @brief 필요할 때만 홉 후보 배치를 요청
+ *
+ * 캐시가 낡았고 진행 중인 배치가 없을 때, 누군가 홉을 요청했거나 등반자가 입력을 넣고 있는데 막혀 멈춰 있으면
+ * (벽 끝에서 홉하려는 순간) 미리 채워 둡니다. 입력 없이 쉬고 있는 등반자는 트레이스하지 않습니다.
+ */
+void UCustomMovementComponent::UpdateHopCandidates()
+{
+	if (!IsClimbing() || PendingHopTraceCount > 0 || IsHopCandidateCacheValid())
+	{
+		return;
+	}
+
+	const bool bHopIntent = !GetLastInputVector().IsNearlyZero() && Velocity.IsNearlyZero(1.f);
+
+	if (bHopCandidatesRequested || bHopIntent)
+	{
+		RequestHopCandidateTraces();
+	}
+}
+
+/**
+ * @brief 8방향 후보 (+ 위쪽 방향의 안전 트레이스) 를 한 묶음의 비동기 라인 트레이스로 요청
+ *
+ * 결과는 다음 프레임 비동기 트레이스 처리 시점에 OnHopCandidateTraceDone 으로 돌아오며,
+ * 묶음의 모든 결과가 모이면 한 번에 후보 캐시를 교체합니다.
+ */
+void UCustomMovementComponent::RequestHopCandidateTraces()
+{
+	bHopCandidatesRequested = false;
+	++HopTraceBatch;
+	PendingHopTraceCount = 0;
+	PendingHopProbeLocation = UpdatedComponent->GetComponentLocation();
+	PendingHopProbeRotation = UpdatedComponent->GetComponentQuat();
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbHopTrace), false);
+	AddClimbQueryIgnoredOwner(QueryParams);
+
+	for (const EClimbHopDirection Direction : TEnumRange<EClimbHopDirection>())
+	{
+		const int32 DirectionIndex = static_cast<int32>(Direction);
+		PendingHopCandidates[DirectionIndex] = FClimbHopCandidate();
+
+		const int32 NumTraces = ClimbHop::NeedsSafetyTrace(Direction) ? 2 : 1;
+		for (int32 TraceIndex = 0; TraceIndex < NumTraces; ++TraceIndex)
+		{
+			const bool bSafetyTrace = TraceIndex > 0;
+
+			FVector Start;
+			FVector End;
+			GetHopTrace(Direction, bSafetyTrace, Start, End);
+
+			INC_DWORD_STAT(STAT_ClimbSceneQueries);
+			++ClimbStats::NumSceneQueries;
+
+			GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, ClimbTraceChannel, QueryParams, FCollisionResponseParams::DefaultResponseParam,
+				&HopTraceDelegate, ClimbHop::EncodeUserData(HopTraceBatch, DirectionIndex, bSafetyTrace));
+
+			++PendingHopTraceCount;
+		}
+	}
+}
+
+void UCustomMovementComponent::OnHopCandidateTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	uint32 Batch;
+	int32 DirectionIndex;
+	bool bSafetyTrace;
+	ClimbHop::DecodeUserData(TraceDatum.UserData, Batch, DirectionIndex, bSafetyTrace);
+
+	// 무효화 이후 도착한 이전 묶음 결과는 버림
+	if (Batch != (HopTraceBatch & ClimbHop::BatchMask) || PendingHopTraceCount <= 0)
+	{
+		return;
+	}
+
+	const FHitResult* BlockingHit = TraceDatum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+
+	FClimbHopCandidate& Candidate = PendingHopCandidates[DirectionIndex];
+	if (bSafetyTrace)
+	{
+		Candidate.bSafetyHit = BlockingHit != nullptr;
+	}
+	else if (BlockingHit)
+	{
+		Candidate.bHopHit = true;
+		Candidate.TargetPosition = BlockingHit->ImpactPoint;
+	}
+
+	if (--PendingHopTraceCount > 0)
+	{
+		return;
+	}
+
+	for (const EClimbHopDirection Direction : TEnumRange<EClimbHopDirection>())
+	{
+		FClimbHopCandidate& Completed = PendingHopCandidates[static_cast<int32>(Direction)];
+		Completed.bReachable = Completed.bHopHit && (Completed.bSafetyHit || !ClimbHop::NeedsSafetyTrace(Direction));
+		HopCandidates[static_cast<int32>(Direction)] = Completed;
+	}
+
+	HopCandidatesProbeLocation = PendingHopProbeLocation;
+	HopCandidatesProbeRotation = PendingHopProbeRotation;
+	bHasHopCandidates = true;
+}
+
+void UCustomMovementComponent::InvalidateHopCandidates()
+{
+	bHasHopCandidates = false;
+	PendingHopTraceCount = 0;
+	++HopTraceBatch;
+}
+
+#pragma endregion
+
+#pragma region Spline Climb
+
+/**
+ * @brief 잡을 수 있는 거리의 사다리 / 파이프를 찾아 스플라인 등반을 시작
+ *
+ * 스플라인 액터는 콜리전이 없어도 되도록 트레이스 대신 스플라인에 직접 투영해 찾습니다 (입력 시점에만 호출).
+ */
+bool UCustomMovementComponent::TryStartSplineClimb()
+{
+	if (IsInAnyClimbMode() || IsClimbActionPlaying())
+	{
+		return false;
+	}
+
+	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+	const FVector ComponentForward = UpdatedComponent->GetForwardVector();
+
+	AClimbSplineActor* BestSpline = nullptr;
+	float BestDistanceSquared = FMath::Square(SplineGrabDistance);
+
+	for (TActorIterator<AClimbSplineActor> It(GetWorld()); It; ++It)
+	{
+		AClimbSplineActor* ClimbSpline = *It;
+
+		if (!ClimbSpline->GetSpline()->Bounds.GetBox().ExpandBy(SplineGrabDistance).IsInsideOrOn(ComponentLocation))
+		{
+			continue;
+		}
+
+		const float Distance = ClimbSpline->FindDistanceClosestTo(ComponentLocation);
+		const FTransform ClimbTransform = ClimbSpline->GetClimbTransform(Distance, ClimbSpline->FindAngleAround(Distance, ComponentLocation));
+
+		// 사다리는 정면에서만 잡음
+		if (ClimbSpline->GetSplineType() == EClimbSplineType::Ladder && FVector::DotProduct(ComponentForward, ClimbTransform.GetRotation().GetForwardVector()) <= 0.f)
+		{
+			continue;
+		}
+
+		const float DistanceSquared = FVector::DistSquared(ComponentLocation, ClimbTransform.GetLocation());
+		if (DistanceSquared < BestDistanceSquared)
+		{
+			BestDistanceSquared = DistanceSquared;
+			BestSpline = ClimbSpline;
+		}
+	}
+
+	if (!BestSpline)
+	{
+		return false;
+	}
+
+	StartSplineClimb(BestSpline);
+	return true;
+}
+
+void UCustomMovementComponent::StartSplineClimb(AClimbSplineActor* ClimbSpline)
+{
+	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+
+	ActiveClimbSpline = ClimbSpline;
+	SplineClimbDistance = ClimbSpline->FindDistanceClosestTo(ComponentLocation);
+	SplineClimbAngle = ClimbSpline->FindAngleAround(SplineClimbDistance, ComponentLocation);
+
+	// 사다리 / 파이프 자체의 콜리전에 막히지 않도록 (위치는 스플라인이 결정)
+	UpdatedPrimitive->IgnoreActorWhenMoving(ClimbSpline, true);
+
+	StopMovementImmediately();
+	SetMovementMode(MOVE_Custom, ECustomMovementMode::MOVE_SplineClimb);
+}
+
+/**
+ * @brief 스플라인 위 1차원 이동
+ *
+ * 입력과 속도를 접선 방향 성분만 남겨 가감속한 뒤, 스플라인 위 새 거리의 트랜스폼으로 스윕 이동합니다.
+ * 표면 트레이스가 없으므로 PhysClimb 보다 훨씬 저렴합니다.
+ */
+void UCustomMovementComponent::PhysSplineClimb(float deltaTime, int32 Iterations)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PhysSplineClimb);
+
+	if (deltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	AClimbSplineActor* ClimbSpline = ActiveClimbSpline.Get();
+	if (!ClimbSpline)
+	{
+		StopClimbing();
+		return;
+	}
+
+	const FVector Tangent = ClimbSpline->GetTangent(SplineClimbDistance);
+
+	RestorePreAdditiveRootMotionVelocity();
+
+	if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+	{
+		Acceleration = Acceleration.ProjectOnToNormal(Tangent);
+		Velocity = Velocity.ProjectOnToNormal(Tangent);
+		CalcVelocity(deltaTime, 0.f, true, MaxBreakClimbDeceleration);
+	}
+
+	ApplyRootMotionToVelocity(deltaTime);
+
+	const float ClimbLength = ClimbSpline->GetClimbLength();
+	const float SpeedAlongSpline = FVector::DotProduct(Velocity, Tangent);
+	const float NewDistance = FMath::Clamp(SplineClimbDistance + SpeedAlongSpline * deltaTime, 0.f, ClimbLength);
+
+	// 아래 끝에서는 그대로 내려서고, 위 끝에서는 올라섬
+	if (SpeedAlongSpline < 0.f && NewDistance <= 0.f)
+	{
+		StopClimbing();
+		return;
+	}
+
+	if (SpeedAlongSpline > 0.f && NewDistance >= ClimbLength && ClimbSpline->CanExitAtTop())
+	{
+		ExitSplineClimbAtTop(ClimbSpline);
+		return;
+	}
+
+	const FTransform ClimbTransform = ClimbSpline->GetClimbTransform(NewDistance, SplineClimbAngle);
+	const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+	const FVector Adjusted = ClimbTransform.GetLocation() - OldLocation;
+
+	FHitResult Hit(1.f);
+	SafeMoveUpdatedComponent(Adjusted, ClimbTransform.GetRotation(), true, Hit);
+
+	if (Hit.Time < 1.f)
+	{
+		HandleImpact(Hit, deltaTime, Adjusted);
+
+		// 다른 물체에 막혔으면 실제 위치를 스플라인에 다시 투영
+		SplineClimbDistance = ClimbSpline->FindDistanceClosestTo(UpdatedComponent->GetComponentLocation());
+	}
+	else
+	{
+		SplineClimbDistance = NewDistance;
+	}
+
+	// 등반 입력 축 (AClimbingSystemCharacter::HandleClimbMovementInput) 은 스플라인을 향하는 면을 기준으로 함
+	CurrentClimbableSurfaceNormal = -ClimbTransform.GetRotation().GetForwardVector();
+
+	if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+	{
+		Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / deltaTime;
+	}
+}
+
+void UCustomMovementComponent::ExitSplineClimbAtTop(const AClimbSplineActor* ClimbSpline)
+{
+	const FVector ExitLocation = ClimbSpline->GetTopExitLocation() + FVector::UpVector * CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	UAnimMontage* TopOutMontage = GetClimbActionMontage(EClimbAction::TopOut);
+
+	StopClimbing();
+
+	// TopOut 몽타주에는 스플라인 출구용 워핑 구간이 없으므로 구운 궤적의 끝을 출구에 맞춘 루트 모션 소스로 옮김
+	if (TopOutMontage && StartBakedClimbTransition(TopOutMontage, ExitLocation))
+	{
+		PlayingClimbActionMontage = TopOutMontage;
+		PlayingClimbAction = EClimbAction::TopOut;
+
+		if (!UsesBakedClimbTransitions() && OwningPlayerAnimInstance)
+		{
+			// 애님 루트 모션이 루트 모션 소스보다 우선하므로 몽타주는 포즈만 재생
+			OwningPlayerAnimInstance->Montage_Play(TopOutMontage);
+
+			if (FAnimMontageInstance* MontageInstance = OwningPlayerAnimInstance->GetActiveInstanceForMontage(TopOutMontage))
+			{
+				MontageInstance->PushDisableRootMotion();
+			}
+		}
+
+		return;
+	}
+
+	// 몽타주가 아직 로드되지 않았으면 내릴 지점으로 바로 옮김
+	CharacterOwner->TeleportTo(ExitLocation, FRotator(0.f, UpdatedComponent->GetComponentRotation().Yaw, 0.f));
+}
+
+#pragma endregion
+
+#pragma region Ledge Shimmy
+
+void UCustomMovementComponent::HandleReachedLedge()
+{
+	if (TryStartShimmy())
+	{
+		return;
+	}
+
+	StopClimbing();
+	PlayClimbMontage(GetClimbActionMontage(EClimbAction::TopOut));
+}
+
+/**
+ * @brief 지금 오르던 표면의 렛지 폴리라인에 매달림
+ *
+ * 렛지는 UClimbLedgeSubsystem 이 프리미티브별로 한 번 추출해 둔 캐시를 쓰므로 여기서는 씬 쿼리를 하지 않습니다.
+ * 등반을 시작할 때 요청한 추출이 아직 끝나지 않았으면 매달리지 않고 TopOut 합니다.
+ */
+bool UCustomMovementComponent::TryStartShimmy()
+{
+	if (!bEnableLedgeShimmy || !ClimbLedgeSubsystem || ClimbableSurfacesTracedResults.IsEmpty())
+	{
+		return false;
+	}
+
+	UPrimitiveComponent* LedgeComponent = ClimbableSurfacesTracedResults[0].GetComponent();
+	const FVector EyeLocation = UpdatedComponent->GetComponentLocation() + UpdatedComponent->GetUpVector() * CharacterOwner->BaseEyeHeight;
+
+	FClimbLedgePolyline Ledge;
+	float LedgeDistance = 0.f;
+	if (!ClimbLedgeSubsystem->FindClosestLedge(LedgeComponent, EyeLocation, ShimmyGrabDistance, Ledge, LedgeDistance))
+	{
+		return false;
+	}
+
+	ShimmyLedgeComponent = LedgeComponent;
+	ActiveShimmyLedge = MoveTemp(Ledge);
+	ShimmyDistance = LedgeDistance;
+
+	// 오르던 벽면 위쪽 가장자리여야 함 (윗면 반대편 / 옆면 가장자리가 더 가까운 경우 제외)
+	FVector LipLocation, LedgeNormal, LedgeTangent;
+	EvaluateShimmyLedge(ShimmyDistance, LipLocation, LedgeNormal, LedgeTangent);
+
+	if (FVector::DotProduct(LedgeNormal.GetSafeNormal2D(), CurrentClimbableSurfaceNormal.GetSafeNormal2D()) < 0.5f)
+	{
+		ShimmyLedgeComponent.Reset();
+		ActiveShimmyLedge = FClimbLedgePolyline();
+		return false;
+	}
+
+	ShimmySpeed = 0.f;
+	ShimmyTopOutHeldTime = 0.f;
+
+	StopMovementImmediately();
+	SetMovementMode(MOVE_Custom, ECustomMovementMode::MOVE_Shimmy);
+
+	return true;
+}
+
+/**
+ * @brief 매달린 상태의 위 / 아래 입력을 TopOut / 벽으로 내려가기 동작으로 바꿈
+ *
+ * 이동 시뮬레이션 안에서 모드를 바꾸면 몽타주 / 예측 경로를 건너뛰므로, 조종하는 쪽에서 TryClimbAction 으로 요청합니다.
+ * 원격 클라이언트의 서버 쪽은 예측 요청으로 따라옵니다.
+ */
+void UCustomMovementComponent::UpdateShimmyInput(float DeltaTime)
+{
+	if (!IsShimmying() || !CharacterOwner->IsLocallyControlled() || IsClimbActionPlaying())
+	{
+		ShimmyTopOutHeldTime = 0.f;
+		return;
+	}
+
+	const float VerticalInput = FVector::DotProduct(GetLastInputVector(), UpdatedComponent->GetUpVector());
+
+	ShimmyTopOutHeldTime = VerticalInput > 0.5f ? ShimmyTopOutHeldTime + DeltaTime : 0.f;
+
+	if (ShimmyTopOutHeldTime >= ShimmyTopOutHoldTime)
+	{
+		ShimmyTopOutHeldTime = 0.f;
+		TryClimbAction(EClimbAction::TopOut);
+	}
+	else if (VerticalInput < -0.5f)
+	{
+		TryClimbAction(EClimbAction::ShimmyDrop);
+	}
+}
+
+/**
+ * @brief 매달린 렛지에서 아래 벽면 등반으로 내려감
+ *
+ * 슬롯이 비어 있으면 몽타주 없이 바로 등반 모드로 바꾸고 (예측 범위가 서버에 알림), 로드 중이면 다음 입력에서 다시 시도합니다.
+ */
+bool UCustomMovementComponent::TryDropFromShimmy()
+{
+	if (!IsShimmying())
+	{
+		return false;
+	}
+
+	UAnimMontage* DropMontage = GetClimbActionMontage(EClimbAction::ShimmyDrop);
+	if (!DropMontage && !ActiveClimbMontages.GetMontage(EClimbAction::ShimmyDrop).IsNull())
+	{
+		return false;
+	}
+
+	StartClimbing();
+
+	if (DropMontage)
+	{
+		PlayClimbMontage(DropMontage);
+	}
+
+	return true;
+}
+
+void UCustomMovementComponent::PhysShimmy(float deltaTime, int32 Iterations)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PhysShimmy);
+
+	if (deltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	FVector LipLocation, LedgeNormal, LedgeTangent;
+	if (!EvaluateShimmyLedge(ShimmyDistance, LipLocation, LedgeNormal, LedgeTangent))
+	{
+		StopClimbing();
+		return;
+	}
+
+	RestorePreAdditiveRootMotionVelocity();
+
+	if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+	{
+		// 입력은 벽 등반과 같은 표면 기준 축으로 들어옴: 옆 성분만 가장자리를 따라 이동 (위 / 아래는 UpdateShimmyInput)
+		Acceleration = Acceleration.ProjectOnToNormal(LedgeTangent);
+		Velocity = LedgeTangent * ShimmySpeed;
+		CalcVelocity(deltaTime, 0.f, true, MaxBreakClimbDeceleration);
+		ShimmySpeed = FVector::DotProduct(Velocity, LedgeTangent);
+	}
+
+	ApplyRootMotionToVelocity(deltaTime);
+
+	// 닫힌 루프는 모서리를 돌아 계속 이어지고, 열린 렛지의 끝 (틈) 에서는 멈춤
+	const float UnclampedDistance = ShimmyDistance + ShimmySpeed * deltaTime;
+	const float NewDistance = ActiveShimmyLedge.NormalizeDistance(UnclampedDistance);
+
+	if (!ActiveShimmyLedge.bClosedLoop && NewDistance != UnclampedDistance)
+	{
+		ShimmySpeed = 0.f;
+	}
+
+	EvaluateShimmyLedge(NewDistance, LipLocation, LedgeNormal, LedgeTangent);
+
+	const FVector HangNormal = LedgeNormal.GetSafeNormal2D();
+	const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+	const FVector Adjusted = GetShimmyHangLocation(LipLocation, LedgeNormal) - OldLocation;
+	const FQuat HangRotation = FRotationMatrix::MakeFromXZ(-HangNormal, FVector::UpVector).ToQuat();
+
+	FHitResult Hit(1.f);
+	SafeMoveUpdatedComponent(Adjusted, HangRotation, true, Hit);
+
+	if (Hit.Time < 1.f)
+	{
+		// 다른 물체에 막혔으면 가장자리 위치를 유지 (다음 틱에 같은 거리에서 다시 매달림)
+		HandleImpact(Hit, deltaTime, Adjusted);
+		ShimmySpeed = 0.f;
+	}
+	else
+	{
+		ShimmyDistance = NewDistance;
+	}
+
+	// 등반 입력 축 (AClimbingSystemCharacter::HandleClimbMovementInput) 이 모서리를 도는 동안 함께 회전하도록
+	CurrentClimbableSurfaceNormal = HangNormal;
+	CurrentClimbableSurfaceLocation = LipLocation;
+
+	if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+	{
+		Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / deltaTime;
+	}
+}
+
+bool UCustomMovementComponent::EvaluateShimmyLedge(float Distance, FVector& OutLipLocation, FVector& OutNormal, FVector& OutTangent) const
+{
+	const UPrimitiveComponent* LedgeComponent = ShimmyLedgeComponent.Get();
+	if (!LedgeComponent || ActiveShimmyLedge.GetNumSegments() <= 0)
+	{
+		return false;
+	}
+
+	ActiveShimmyLedge.Evaluate(Distance, ShimmyCornerBlendDistance, OutLipLocation, OutNormal, OutTangent);
+
+	const FTransform& LedgeTransform = LedgeComponent->GetComponentTransform();
+	OutLipLocation = LedgeTransform.TransformPositionNoScale(OutLipLocation);
+	OutNormal = LedgeTransform.TransformVectorNoScale(OutNormal);
+	OutTangent = LedgeTransform.TransformVectorNoScale(OutTangent);
+
+	return true;
+}
+
+FVector UCustomMovementComponent::GetShimmyHangLocation(const FVector& LipLocation, const FVector& LedgeNormal) const
+{
+	return LipLocation + LedgeNormal.GetSafeNormal2D() * ShimmyHangOffset.X - FVector::UpVector * ShimmyHangOffset.Y;
+}
+
+#pragma endregion
+
+#pragma region Ledge Catch
+
+void UCustomMovementComponent::UpdateLedgeCatch()
+{
+	// 방금 놓은 벽을 바로 다시 잡지 않도록 쿨다운 동안은 프로브도 보내지 않음
+	if (!IsFalling() || IsClimbActionPlaying() || IsLedgeCatchOnCooldown())
+	{
+		return;
+	}
+
+	// 자동 캐치가 꺼져 있으면 수동 요청이 들어온 낙하에서만 프로브
+	if (!bAutoLedgeCatch && !bLedgeCatchRequested)
+	{
+		return;
+	}
+
+	if (bHasLedgeCatchCandidate)
+	{
+		FClimbActionPredictionScope PredictionScope(*this);
+
+		if (TryLedgeCatch())
+		{
+			return;
+		}
+	}
+
+	if (PendingLedgeCatchTraceCount == 0)
+	{
+		RequestLedgeCatchProbes();
+	}
+}
+
+/**
+ * @brief 현재 속도 / 중력으로 예측한 포물선 위 지점마다 손 닿는 거리 앞을 내려다보는 비동기 라인 트레이스를 요청
+ *
+ * 결과는 다음 프레임에 OnLedgeCatchTraceDone 으로 돌아오며, 묶음이 끝나면 바로 다음 묶음을 요청합니다.
+ */
+void UCustomMovementComponent::RequestLedgeCatchProbes()
+{
+	// 수평 이동 방향으로 잡음 (거의 수직으로 떨어지는 중이면 바라보는 방향)
+	const FVector HorizontalVelocity(Velocity.X, Velocity.Y, 0.f);
+	const FVector CatchDirection = HorizontalVelocity.SizeSquared() > FMath::Square(10.f)
+		? HorizontalVelocity.GetSafeNormal()
+		: UpdatedComponent->GetForwardVector().GetSafeNormal2D();
+
+	++LedgeCatchTraceBatch;
+	PendingLedgeCatchTraceCount = 0;
+	PendingLedgeCatchSampleCount = FMath::Clamp(LedgeCatchNumSamples, 1, MaxLedgeCatchSamples);
+	PendingLedgeCatchDirection = CatchDirection;
+
+	const FVector StartLocation = UpdatedComponent->GetComponentLocation();
+	const FVector Gravity(0.f, 0.f, GetGravityZ());
+	const float EyeHeight = CharacterOwner->BaseEyeHeight;
+	const float ReachDistance = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius() + LedgeCatchReach;
+
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbLedgeCatchTrace), false, CharacterOwner);
+
+	for (int32 SampleIndex = 0; SampleIndex < PendingLedgeCatchSampleCount; ++SampleIndex)
+	{
+		PendingLedgeCatchSamples[SampleIndex] = FLedgeCatchSample();
+
+		const float SampleTime = LedgeCatchPredictionTime * (SampleIndex + 1) / PendingLedgeCatchSampleCount;
+		const FVector PredictedLocation = StartLocation + Velocity * SampleTime + 0.5f * Gravity * FMath::Square(SampleTime);
+		const FVector ProbeLocation = PredictedLocation + CatchDirection * ReachDistance;
+
+		const FVector Start = ProbeLocation + FVector::UpVector * (EyeHeight + LedgeCatchEyeWindow.Y + ClimbLedgeCatch::ProbeMargin);
+		const FVector End = ProbeLocation + FVector::UpVector * (EyeHeight + LedgeCatchEyeWindow.X - ClimbLedgeCatch::ProbeMargin);
+
+		INC_DWORD_STAT(STAT_ClimbSceneQueries);
+		++ClimbStats::NumSceneQueries;
+
+		GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, ClimbTraceChannel, QueryParams, FCollisionResponseParams::DefaultResponseParam,
+			&LedgeCatchTraceDelegate, ClimbLedgeCatch::EncodeUserData(LedgeCatchTraceBatch, SampleIndex));
+
+		++PendingLedgeCatchTraceCount;
+	}
+}
+
+void UCustomMovementComponent::OnLedgeCatchTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	uint32 Batch;
+	int32 SampleIndex;
+	ClimbLedgeCatch::DecodeUserData(TraceDatum.UserData, Batch, SampleIndex);
+
+	// 무효화 이후 도착한 이전 묶음 결과는 버림
+	if (Batch != (LedgeCatchTraceBatch & ClimbLedgeCatch::BatchMask) || PendingLedgeCatchTraceCount <= 0)
+	{
+		return;
+	}
+
+	// 벽 안에서 시작했으면 (벽이 더 높음) 아직 렛지가 아님
+	const FHitResult* BlockingHit = TraceDatum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+	if (BlockingHit && !BlockingHit->bStartPenetrating && IsWalkable(*BlockingHit))
+	{
+		PendingLedgeCatchSamples[SampleIndex].bHit = true;
+		PendingLedgeCatchSamples[SampleIndex].LedgeTop = BlockingHit->ImpactPoint;
+	}
+
+	if (--PendingLedgeCatchTraceCount > 0)
+	{
+		return;
+	}
+
+	bHasLedgeCatchCandidate = false;
+
+	for (int32 Index = 0; Index < PendingLedgeCatchSampleCount; ++Index)
+	{
+		if (PendingLedgeCatchSamples[Index].bHit)
+		{
+			LedgeCatchLedgeTop = PendingLedgeCatchSamples[Index].LedgeTop;
+			LedgeCatchDirection = PendingLedgeCatchDirection;
+			bHasLedgeCatchCandidate = true;
+			break;
+		}
+	}
+}
+
+void UCustomMovementComponent::InvalidateLedgeCatchProbes()
+{
+	bHasLedgeCatchCandidate = false;
+	PendingLedgeCatchTraceCount = 0;
+	++LedgeCatchTraceBatch;
+}
+
+bool UCustomMovementComponent::TryLedgeCatch()
+{
+	if (!IsFalling() || !bHasLedgeCatchCandidate || IsClimbActionPlaying() || IsLedgeCatchOnCooldown())
+	{
+		return false;
+	}
+
+	// 슬롯이 비어 있으면 몽타주 없이 렛지 아래 벽에 바로 매달리고, 로드 중이면 다음 틱에 다시 시도
+	RequestClimbMontages();
+
+	UAnimMontage* CatchMontage = GetClimbActionMontage(EClimbAction::LedgeCatch);
+	const bool bHasCatchMontageSlot = !ActiveClimbMontages.GetMontage(EClimbAction::LedgeCatch).IsNull();
+
+	if (!CatchMontage && bHasCatchMontageSlot)
+	{
+		return false;
+	}
+
+	// 예측한 렛지가 지금 눈높이 창과 손 닿는 거리 안에 들어왔는지
+	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+	const float EyeZ = ComponentLocation.Z + CharacterOwner->BaseEyeHeight;
+	const float LedgeHeightFromEye = LedgeCatchLedgeTop.Z - EyeZ;
+
+	if (LedgeHeightFromEye < LedgeCatchEyeWindow.X || LedgeHeightFromEye > LedgeCatchEyeWindow.Y)
+	{
+		return false;
+	}
+
+	const float ReachDistance = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius() + LedgeCatchReach;
+
+	// 렛지 바로 아래에 잡고 매달릴 등반 가능한 벽면이 있어야 함
+	const FVector WallTraceStart(ComponentLocation.X, ComponentLocation.Y, LedgeCatchLedgeTop.Z - ClimbLedgeCatch::WallProbeDepth);
+	const FVector WallTraceEnd = WallTraceStart + LedgeCatchDirection * ReachDistance;
+	const FHitResult WallHit = DoLineTraceSingleByChannel(WallTraceStart, WallTraceEnd, false, false);
+
+	if (!WallHit.bBlockingHit || WallHit.bStartPenetrating)
+	{
+		return false;
+	}
+
+	const FClimbSurfaceProperties& WallProperties = ClimbSurfaceSubsystem ? ClimbSurfaceSubsystem->GetSurfaceProperties(WallHit) : CurrentClimbSurfaceProperties;
+	const float WallAngle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(WallHit.ImpactNormal, FVector::UpVector)));
+
+	if (!WallProperties.bClimbable || !WallProperties.bLedgeCapable || WallAngle <= WallProperties.GetMaxClimbableSurfaceAngle(MaxClimbableSurfaceAngle))
+	{
+		return false;
+	}
+
+	// 벽을 바라보며 등반 상태로 들어가고, 손이 렛지 끝에 맞도록 워핑
+	const FVector LedgeLip(WallHit.ImpactPoint.X, WallHit.ImpactPoint.Y, LedgeCatchLedgeTop.Z);
+
+	UpdatedComponent->SetWorldRotation(FRotationMatrix::MakeFromX(-WallHit.ImpactNormal.GetSafeNormal2D()).ToQuat());
+	StopMovementImmediately();
+	bLedgeCatchRequested = false;
+	StartClimbing();
+
+	if (CatchMontage)
+	{
+		SetMotionWarpTarget(LedgeCatchPointName, LedgeLip);
+		PlayClimbMontage(CatchMontage);
+	}
+
+	return true;
+}
+
+bool UCustomMovementComponent::IsLedgeCatchOnCooldown() const
+{
+	return GetWorld()->GetTimeSeconds() - LastClimbReleaseTime < LedgeCatchRegrabCooldown;
+}
+
+#pragma endregion
+
+#pragma region Climb Prediction
+
+bool UCustomMovementComponent::ShouldPredictClimbActions() const
+{
+	return CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_AutonomousProxy;
+}
+
+/**
+ * @brief 방금 시작한 동작 몽타주와 워프 타겟을 서버에 보내 검증을 요청
+ *
+ * 서버가 같은 위치에서 판정하도록 쌓아 둔 이동을 먼저 보냅니다.
+ */
+void UCustomMovementComponent::SendClimbActionPrediction(const FVector& StartLocation, const FQuat& StartRotation, EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+	UAnimMontage* Montage = OwningPlayerAnimInstance ? OwningPlayerAnimInstance->GetCurrentActiveMontage() : nullptr;
+
+	if (!Montage || Montage != PlayingClimbActionMontage)
+	{
+		return;
+	}
+
+	FClimbActionPrediction Prediction;
+	Prediction.Action = PlayingClimbAction;
+
+	Prediction.PredictionId = ++NextClimbPredictionId;
+	Prediction.HopDirection = LastHopDirection;
+	Prediction.WarpTargets = RecentWarpTargets;
+
+	PendingClimbPrediction.Montage = Montage;
+	PendingClimbPrediction.StartLocation = StartLocation;
+	PendingClimbPrediction.StartRotation = StartRotation;
+	PendingClimbPrediction.PreviousMovementMode = PreviousMovementMode;
+	PendingClimbPrediction.PreviousCustomMode = PreviousCustomMode;
+	PendingClimbPrediction.PredictionId = Prediction.PredictionId;
+	PendingClimbPrediction.bActive = true;
+
+	RolledBackClimbMontage = nullptr;
+
+	FlushServerMoves();
+	ServerRequestClimbAction(Prediction);
+}
+
+bool UCustomMovementComponent::FindClimbActionForMontage(const UAnimMontage* Montage, EClimbAction& OutAction) const
+{
+	if (!Montage)
+	{
+		return false;
+	}
+
+	for (const EClimbAction Action : TEnumRange<EClimbAction>())
+	{
+		if (GetClimbActionMontage(Action) == Montage)
+		{
+			OutAction = Action;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UCustomMovementComponent::ServerRequestClimbAction_Implementation(const FClimbActionPrediction& Prediction)
+{
+	// 연속 동작 (홉 → 홉 등) 은 서버의 이전 동작이 아직 끝나지 않았을 때 도착하므로 끝날 때까지 보류
+	if (IsClimbActionPlaying())
+	{
+		if (QueuedClimbAction.bActive)
+		{
+			ClientRejectClimbAction(QueuedClimbAction.Prediction.PredictionId);
+		}
+
+		QueuedClimbAction.Prediction = Prediction;
+		QueuedClimbAction.TimeRemaining = ClimbActionQueueTimeout;
+		QueuedClimbAction.bActive = true;
+		return;
+	}
+
+	ValidateClimbActionPrediction(Prediction);
+}
+
+/**
+ * @brief 보류한 동작 요청을 서버의 이전 동작이 끝난 틱에 판정
+ *
+ * 제한 시간 안에 끝나지 않으면 거절합니다.
+ */
+void UCustomMovementComponent::UpdateQueuedClimbAction(float DeltaTime)
+{
+	if (!QueuedClimbAction.bActive)
+	{
+		return;
+	}
+
+	if (!IsClimbActionPlaying())
+	{
+		QueuedClimbAction.bActive = false;
+		ValidateClimbActionPrediction(QueuedClimbAction.Prediction);
+		return;
+	}
+
+	QueuedClimbAction.TimeRemaining -= DeltaTime;
+
+	if (QueuedClimbAction.TimeRemaining <= 0.f)
+	{
+		QueuedClimbAction.bActive = false;
+		ClientRejectClimbAction(QueuedClimbAction.Prediction.PredictionId);
+	}
+}
+
+/**
+ * @brief 클라이언트가 예측한 동작을 서버 프로브로 다시 판정
+ *
+ * 같은 동작 경로를 그대로 실행해 서버 자신의 워프 타겟을 얻고, 클라이언트 타겟이 허용 오차 안이면 클라이언트 타겟으로
+ * 덮어써 양쪽 루트 모션을 일치시킵니다. 벗어나면 서버 타겟으로 진행하고 클라이언트에 보정 타겟을 보냅니다.
+ */
+void UCustomMovementComponent::ValidateClimbActionPrediction(const FClimbActionPrediction& Prediction)
+{
+	RecentWarpTargets.Reset();
+
+	switch (Prediction.Action)
+	{
+	case EClimbAction::HopUp:
+	case EClimbAction::HopDown:
+	case EClimbAction::HopLeft:
+	case EClimbAction::HopRight:
+	case EClimbAction::HopUpLeft:
+	case EClimbAction::HopUpRight:
+	case EClimbAction::HopDownLeft:
+	case EClimbAction::HopDownRight:
+		// 대각선 슬롯이 비어 위 / 아래 몽타주로 재생한 홉까지 실제 방향으로 판정
+		WakeClimbTick();
+		RequestClimbMontages();
+
+		if (IsClimbing())
+		{
+			HandleHop(Prediction.HopDirection);
+		}
+		break;
+
+	case EClimbAction::LedgeCatch:
+		// 서버는 수동 캐치에서 렛지 프로브를 돌리지 않으므로 클라이언트가 워핑한 렛지 끝을 후보로 다시 판정
+		if (const FClimbPredictedWarpTarget* LedgeLip = Prediction.WarpTargets.FindByPredicate([this](const FClimbPredictedWarpTarget& WarpTarget)
+			{
+				return WarpTarget.Name == LedgeCatchPointName;
+			}))
+		{
+			ServerLedgeCatch_Implementation(LedgeLip->Location, (LedgeLip->Location - UpdatedComponent->GetComponentLocation()).GetSafeNormal2D());
+		}
+		break;
+
+	default:
+		TryClimbAction(Prediction.Action);
+		break;
+	}
+
+	if (!IsClimbActionPlaying())
+	{
+		ClientRejectClimbAction(Prediction.PredictionId);
+		return;
+	}
+
+	const float ToleranceSquared = FMath::Square(PredictedWarpTargetTolerance);
+	const bool bWithinTolerance = RecentWarpTargets.Num() == Prediction.WarpTargets.Num()
+		&& Algo::AllOf(RecentWarpTargets, [&Prediction, ToleranceSquared](const FClimbPredictedWarpTarget& ServerWarpTarget)
+		{
+			const FClimbPredictedWarpTarget* ClientWarpTarget = Prediction.WarpTargets.FindByPredicate([&ServerWarpTarget](const FClimbPredictedWarpTarget& WarpTarget)
+			{
+				return WarpTarget.Name == ServerWarpTarget.Name;
+			});
+
+			return ClientWarpTarget && FVector::DistSquared(ClientWarpTarget->Location, ServerWarpTarget.Location) <= ToleranceSquared;
+		});
+
+	if (!bWithinTolerance)
+	{
+		ClientConfirmClimbAction(Prediction.PredictionId, RecentWarpTargets);
+		return;
+	}
+
+	for (const FClimbPredictedWarpTarget& ClientWarpTarget : Prediction.WarpTargets)
+	{
+		SetMotionWarpTarget(ClientWarpTarget.Name, ClientWarpTarget.Location);
+	}
+
+	ClientConfirmClimbAction(Prediction.PredictionId, TArray<FClimbPredictedWarpTarget>());
+}
+
+/**
+ * @brief 클라이언트가 잡은 스플라인을 서버에서도 잡음
+ *
+ * 잡을 수 있는 거리 (+ 예측 허용 오차) 밖이면 무시하고, 이후 이동 보정이 클라이언트를 서버 상태로 되돌립니다.
+ */
+void UCustomMovementComponent::ServerStartSplineClimb_Implementation(AClimbSplineActor* ClimbSpline)
+{
+	if (!ClimbSpline || IsInAnyClimbMode() || IsClimbActionPlaying())
+	{
+		return;
+	}
+
+	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+	const float Distance = ClimbSpline->FindDistanceClosestTo(ComponentLocation);
+	const FVector GrabLocation = ClimbSpline->GetClimbTransform(Distance, ClimbSpline->FindAngleAround(Distance, ComponentLocation)).GetLocation();
+
+	if (FVector::DistSquared(ComponentLocation, GrabLocation) > FMath::Square(SplineGrabDistance + PredictedWarpTargetTolerance))
+	{
+		return;
+	}
+
+	WakeClimbTick();
+	StartSplineClimb(ClimbSpline);
+}
+
+/**
+ * @brief 클라이언트가 몽타주 없이 잡은 렛지를 서버에서도 잡음
+ *
+ * 서버 자신의 벽 트레이스 / 눈높이 창으로 다시 판정하고, 실패하면 이후 이동 보정이 클라이언트를 낙하 상태로 되돌립니다.
+ */
+void UCustomMovementComponent::ServerLedgeCatch_Implementation(FVector_NetQuantize10 LedgeTop, FVector_NetQuantizeNormal Direction)
+{
+	if (IsInAnyClimbMode() || IsClimbActionPlaying())
+	{
+		return;
+	}
+
+	WakeClimbTick();
+
+	LedgeCatchLedgeTop = LedgeTop;
+	LedgeCatchDirection = FVector(Direction).GetSafeNormal2D();
+	bHasLedgeCatchCandidate = true;
+
+	TryLedgeCatch();
+}
+
+void UCustomMovementComponent::ServerDropFromShimmy_Implementation()
+{
+	if (!IsClimbActionPlaying())
+	{
+		WakeClimbTick();
+		TryDropFromShimmy();
+	}
+}
+
+void UCustomMovementComponent::ServerStopClimbing_Implementation()
+{
+	if (IsInAnyClimbMode())
+	{
+		WakeClimbTick();
+		StopClimbing();
+	}
+}
+
+void UCustomMovementComponent::ClientConfirmClimbAction_Implementation(uint8 PredictionId, const TArray<FClimbPredictedWarpTarget>& ServerWarpTargets)
+{
+	if (!PendingClimbPrediction.bActive || PendingClimbPrediction.PredictionId != PredictionId)
+	{
+		return;
+	}
+
+	PendingClimbPrediction.bActive = false;
+
+	// 재생 중인 워핑 구간이 남은 시간 동안 서버 타겟으로 휘어 들어감 (작은 보정 한 번)
+	for (const FClimbPredictedWarpTarget& ServerWarpTarget : ServerWarpTargets)
+	{
+		SetMotionWarpTarget(ServerWarpTarget.Name, ServerWarpTarget.Location);
+	}
+}
+
+/**
+ * @brief 서버가 판정하지 못한 예측 동작을 되돌림
+ *
+ * 몽타주를 멈추고 예측 직전 위치 / 이동 모드로 돌아가되, 메시는 예측한 위치에 남겨 두고 짧게 블렌드해
+ * 순간이동처럼 보이지 않게 합니다. 서버는 움직이지 않았으므로 이후 위치 보정은 작게 끝납니다.
+ */
+void UCustomMovementComponent::ClientRejectClimbAction_Implementation(uint8 PredictionId)
+{
+	if (!PendingClimbPrediction.bActive || PendingClimbPrediction.PredictionId != PredictionId)
+	{
+		return;
+	}
+
+	PendingClimbPrediction.bActive = false;
+	WakeClimbTick();
+
+	UAnimMontage* PredictedMontage = PendingClimbPrediction.Montage.Get();
+	if (PredictedMontage && OwningPlayerAnimInstance && OwningPlayerAnimInstance->Montage_IsPlaying(PredictedMontage))
+	{
+		RolledBackClimbMontage = PredictedMontage;
+		PlayingClimbActionMontage = nullptr;
+		OwningPlayerAnimInstance->Montage_Stop(ClimbCorrectionBlendTime, PredictedMontage);
+	}
+
+	const FVector PredictedLocation = UpdatedComponent->GetComponentLocation();
+
+	SetMovementMode(PendingClimbPrediction.PreviousMovementMode, PendingClimbPrediction.PreviousCustomMode);
+	UpdatedComponent->SetWorldLocationAndRotation(PendingClimbPrediction.StartLocation, PendingClimbPrediction.StartRotation, false, nullptr, ETeleportType::TeleportPhysics);
+	StopMovementImmediately();
+
+	ClimbCorrectionOffset = PredictedLocation - PendingClimbPrediction.StartLocation;
+	ClimbCorrectionBlendRemaining = ClimbCorrectionBlendTime;
+	TickClimbCorrectionBlend(0.f);
+}
+
+void UCustomMovementComponent::TickClimbCorrectionBlend(float DeltaTime)
+{
+	if (ClimbCorrectionBlendRemaining <= 0.f || !CharacterOwner)
+	{
+		return;
+	}
+
+	ClimbCorrectionBlendRemaining = FMath::Max(ClimbCorrectionBlendRemaining - DeltaTime, 0.f);
+
+	const float BlendAlpha = ClimbCorrectionBlendTime > UE_KINDA_SMALL_NUMBER ? ClimbCorrectionBlendRemaining / ClimbCorrectionBlendTime : 0.f;
+	const FVector LocalOffset = UpdatedComponent->GetComponentQuat().UnrotateVector(ClimbCorrectionOffset * BlendAlpha);
+
+	CharacterOwner->GetMesh()->SetRelativeLocation(CharacterOwner->GetBaseTranslationOffset() + LocalOffset);
+}
+
+#pragma endregion
+
+#pragma region Baked Transition
+
+/**
+ * @brief 몽타주 대신 구운 루트 모션을 쓸지 여부
+ *
+ * 데디케이티드 서버에서 서버가 직접 조종하는 캐릭터만 해당합니다.
+ * 원격 플레이어의 캐릭터는 클라이언트가 몽타주 루트 모션으로 이동을 예측하므로 서버도 몽타주를 재생해야 합니다.
+ */
+bool UCustomMovementComponent::UsesBakedClimbTransitions() const
+{
+	return bUseBakedClimbTransitionsOnServer
+		&& GetNetMode() == NM_DedicatedServer
+		&& CharacterOwner
+		&& CharacterOwner->IsLocallyControlled();
+}
+
+/**
+ * @brief 몽타주를 구운 루트 모션 소스로 재생
+ *
+ * 직전에 SetMotionWarpTarget 으로 지정한 워프 타겟을 읽어 몽타주의 워핑 구간 보정량을 계산합니다.
+ * 모션 워핑 타겟은 캐릭터 발 위치 기준이므로 캡슐 반높이만큼 올려 액터 위치 기준으로 맞춥니다.
+ * EndLocation (액터 위치 기준) 을 주면 워핑 구간과 상관없이 궤적이 그 지점에서 끝나도록 보정합니다.
+ */
+bool UCustomMovementComponent::StartBakedClimbTransition(UAnimMontage* Montage, const TOptional<FVector>& EndLocation)
+{
+	const FClimbBakedRootMotion* Baked = ClimbRootMotion::FindOrBake(Montage);
+	if (!Baked)
+	{
+		return false;
+	}
+
+	const TSharedPtr<FRootMotionSource_ClimbTransition> ClimbTransition = MakeShared<FRootMotionSource_ClimbTransition>();
+	ClimbTransition->InstanceName = Montage->GetFName();
+	ClimbTransition->Priority = 10;
+	ClimbTransition->Montage = Montage;
+	ClimbTransition->Duration = Baked->Duration;
+	ClimbTransition->StartLocation = UpdatedComponent->GetComponentLocation();
+	ClimbTransition->RootMotionRotation = UpdatedComponent->GetComponentQuat() * CharacterOwner->GetBaseRotationOffset();
+
+	const UMotionWarpingComponent* MotionWarping = OwningPlayerCharacter ? OwningPlayerCharacter->GetMotionWarpingComponent() : nullptr;
+	const FVector RootToActorOffset = UpdatedComponent->GetUpVector() * CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+
+	ClimbTransition->ResolveWarpTargets(*Baked, [MotionWarping, &RootToActorOffset](FName WarpTargetName) -> TOptional<FVector>
+	{
+		const FMotionWarpingTarget* WarpTarget = MotionWarping ? MotionWarping->FindWarpTarget(WarpTargetName) : nullptr;
+		return WarpTarget ? TOptional<FVector>(WarpTarget->GetLocation() + RootToActorOffset) : TOptional<FVector>();
+	});
+
+	if (EndLocation.IsSet())
+	{
+		ClimbTransition->ResolveEndLocation(*Baked, EndLocation.GetValue());
+	}
+
+	ActiveClimbTransitionSourceId = ApplyRootMotionSource(ClimbTransition);
+	ActiveClimbTransitionMontage = Montage;
+
+	return ActiveClimbTransitionSourceId != 0;
+}
+
+/**
+ * @brief 구운 전환이 끝났는지 확인하고 몽타주 종료와 같은 상태 전환을 수행
+ *
+ * 이동이 끝난 뒤 호출되므로 소스가 완료 / 제거된 틱에 바로 다음 상태로 넘어갑니다.
+ */
+void UCustomMovementComponent::UpdateBakedClimbTransition()
+{
+	if (CharacterOwner && CharacterOwner->GetController() != PoseTickController.Get())
+	{
+		UpdateServerPoseTicking();
+	}
+
+	if (ActiveClimbTransitionSourceId == 0)
+	{
+		return;
+	}
+
+	const TSharedPtr<FRootMotionSource> ClimbTransition = GetRootMotionSourceByID(ActiveClimbTransitionSourceId);
+	if (!ClimbTransition.IsValid() || ClimbTransition->Status.HasFlag(ERootMotionSourceStatusFlags::Finished))
+	{
+		FinishBakedClimbTransition(false);
+	}
+}
+
+void UCustomMovementComponent::FinishBakedClimbTransition(bool bInterrupted)
+{
+	UAnimMontage* FinishedMontage = ActiveClimbTransitionMontage;
+
+	RemoveRootMotionSourceByID(ActiveClimbTransitionSourceId);
+	ActiveClimbTransitionSourceId = 0;
+	ActiveClimbTransitionMontage = nullptr;
+
+	OnClimbMontageEnded(FinishedMontage, bInterrupted);
+}
+
+/**
+ * @brief 구운 전환을 쓰는 서버 캐릭터는 포즈 틱을 끔
+ *
+ * 데디케이티드 서버는 렌더링하지 않으므로 OnlyTickPoseWhenRendered 이면 포즈를 틱하지 않습니다.
+ * 빙의 대상이 바뀌면 (AI ↔ 원격 플레이어) 다시 판단합니다.
+ */
+void UCustomMovementComponent::UpdateServerPoseTicking()
+{
+	PoseTickController = CharacterOwner->GetController();
+
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		return;
+	}
+
+	CharacterOwner->GetMesh()->VisibilityBasedAnimTickOption = UsesBakedClimbTransitions()
+		? EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered
+		: DefaultMeshAnimTickOption;
+}
+
+#pragma endregion
+
+#pragma region Corner
+
+/**
+ * @brief 좌우 입력 방향으로 모서리 프리페치를 유지
+ *
+ * 등반 중 좌우 입력이 있고, 같은 방향의 유효한 프리페치가 없으며 진행 중인 요청도 없을 때만 요청합니다.
+ * "모서리 없음" 결과도 캐시하므로 긴 벽을 따라 이동할 때는 CornerProbeDistance 의 절반마다 한 번만 트레이스합니다.
+ */
+void UCustomMovementComponent::UpdateCornerPrefetch()
+{
+	if (!IsClimbing() || bCornerTransitionActive || PendingCornerTraceCount > 0 || IsClimbActionPlaying())
+	{
+		return;
+	}
+
+	const float LateralSign = GetClimbLateralInputSign();
+	if (LateralSign != 0.f && !IsCornerPrefetchValid(LateralSign))
+	{
+		RequestCornerPrefetch(LateralSign);
+	}
+}
+
+bool UCustomMovementComponent::IsCornerPrefetchValid(float LateralSign) const
+{
+	if (!CornerPrefetch.bValid || CornerPrefetch.LateralSign != LateralSign)
+	{
+		return false;
+	}
+
+	return FVector::DistSquared(UpdatedComponent->GetComponentLocation(), CornerPrefetch.ProbeLocation) <= FMath::Square(CornerProbeDistance * 0.5f)
+		&& FMath::RadiansToDegrees(UpdatedComponent->GetComponentQuat().AngularDistance(CornerPrefetch.ProbeRotation)) <= ClimbCorner::CacheMaxAngle;
+}
+
+float UCustomMovementComponent::GetClimbLateralInputSign() const
+{
+	const FVector UnrotatedAcceleration = UKismetMathLibrary::Quat_UnrotateVector(UpdatedComponent->GetComponentQuat(), Acceleration);
+	const float LateralInput = UnrotatedAcceleration.Y / FMath::Max(GetMaxAcceleration(), UE_KINDA_SMALL_NUMBER);
+
+	return FMath::Abs(LateralInput) >= ClimbCorner::MinLateralInput ? FMath::Sign(LateralInput) : 0.f;
+}
+
+/**
+ * @brief 진행 방향 앞의 모서리를 세 개의 비동기 라인 트레이스로 미리 조사
+ *
+ * 0: 벽과 평행하게 진행 방향으로 (안쪽 모서리의 새 벽)
+ * 1: 진행 방향 앞 지점에서 벽 쪽으로 (현재 벽이 이어지는지)
+ * 2: 벽 뒤쪽에서 되돌아오는 방향으로 (바깥 모서리의 옆면)
+ */
+void UCustomMovementComponent::RequestCornerPrefetch(float LateralSign)
+{
+	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+	const FVector ComponentForward = UpdatedComponent->GetForwardVector();
+	const FVector LateralDirection = UpdatedComponent->GetRightVector() * LateralSign;
+	const float WallDistance = FMath::Max(FVector::DotProduct(CurrentClimbableSurfaceLocation - ComponentLocation, ComponentForward), 0.f);
+	const float WrapDepth = WallDistance + ClimbCapsuleTraceRadius;
+
+	++CornerTraceBatch;
+	PendingCornerPrefetch = FClimbCornerPrefetch();
+	PendingCornerPrefetch.ProbeLocation = ComponentLocation;
+	PendingCornerPrefetch.ProbeRotation = UpdatedComponent->GetComponentQuat();
+	PendingCornerPrefetch.LateralDirection = LateralDirection;
+	PendingCornerPrefetch.LateralSign = LateralSign;
+	PendingCornerPrefetch.WallDistance = WallDistance;
+	PendingCornerSurfaceNormal = CurrentClimbableSurfaceNormal;
+
+	const FVector AheadLocation = ComponentLocation + LateralDirection * CornerProbeDistance;
+	const FVector TraceStarts[NumCornerTraces] = { ComponentLocation, AheadLocation, AheadLocation + ComponentForward * WrapDepth };
+	const FVector TraceEnds[NumCornerTraces] = { AheadLocation, AheadLocation + ComponentForward * WrapDepth, ComponentLocation + ComponentForward * WrapDepth };
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbCornerTrace), false);
+	AddClimbQueryIgnoredOwner(QueryParams);
+
+	for (int32 TraceIndex = 0; TraceIndex < NumCornerTraces; ++TraceIndex)
+	{
+		PendingCornerHits[TraceIndex] = FHitResult();
+
+		INC_DWORD_STAT(STAT_ClimbSceneQueries);
+		++ClimbStats::NumSceneQueries;
+
+		GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, TraceStarts[TraceIndex], TraceEnds[TraceIndex], ClimbTraceChannel, QueryParams, FCollisionResponseParams::DefaultResponseParam,
+			&CornerTraceDelegate, ClimbCorner::EncodeUserData(CornerTraceBatch, TraceIndex));
+	}
+
+	PendingCornerTraceCount = NumCornerTraces;
+}
+
+void UCustomMovementComponent::OnCornerTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	const uint32 Batch = TraceDatum.UserData >> 2;
+	const int32 TraceIndex = TraceDatum.UserData & 0x3;
+
+	// 무효화 이후 도착한 이전 요청 결과는 버림
+	if (Batch != (CornerTraceBatch & ClimbCorner::BatchMask) || PendingCornerTraceCount <= 0 || TraceIndex >= NumCornerTraces)
+	{
+		return;
+	}
+
+	if (const FHitResult* BlockingHit = TraceDatum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; }))
+	{
+		PendingCornerHits[TraceIndex] = *BlockingHit;
+	}
+
+	if (--PendingCornerTraceCount == 0)
+	{
+		ResolveCornerPrefetch();
+	}
+}
+
+/**
+ * @brief 모인 트레이스 결과로 모서리 종류와 전환 목표를 결정
+ *
+ * 목표 위치는 새 면에서 현재 벽과 같은 거리 (WallDistance) 만큼 떨어진 지점입니다.
+ */
+void UCustomMovementComponent::ResolveCornerPrefetch()
+{
+	FClimbCornerPrefetch& Result = PendingCornerPrefetch;
+	Result.bValid = true;
+
+	auto IsCornerFace = [this](const FHitResult& Hit)
+	{
+		if (!Hit.bBlockingHit || (ClimbSurfaceSubsystem && !ClimbSurfaceSubsystem->GetSurfaceProperties(Hit).bClimbable))
+		{
+			return false;
+		}
+
+		const float AngleToCurrentFace = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(FVector::DotProduct(Hit.ImpactNormal, PendingCornerSurfaceNormal), -1.f, 1.f)));
+		return AngleToCurrentFace >= CornerMinAngle;
+	};
+
+	const FHitResult& InsideHit = PendingCornerHits[0];
+	const FHitResult& ForwardHit = PendingCornerHits[1];
+	const FHitResult& WrapHit = PendingCornerHits[2];
+
+	const FHitResult* FaceHit = nullptr;
+	if (IsCornerFace(InsideHit))
+	{
+		Result.Type = EClimbCornerType::Inside;
+		FaceHit = &InsideHit;
+	}
+	else if (!ForwardHit.bBlockingHit && IsCornerFace(WrapHit))
+	{
+		Result.Type = EClimbCornerType::Outside;
+		FaceHit = &WrapHit;
+	}
+
+	if (FaceHit)
+	{
+		Result.FacePoint = FaceHit->ImpactPoint;
+		Result.FaceNormal = FaceHit->ImpactNormal;
+		Result.TargetLocation = FaceHit->ImpactPoint + FaceHit->ImpactNormal * Result.WallDistance;
+	}
+
+	CornerPrefetch = Result;
+}
+
+void UCustomMovementComponent::InvalidateCornerPrefetch()
+{
+	CornerPrefetch = FClimbCornerPrefetch();
+	PendingCornerTraceCount = 0;
+	++CornerTraceBatch;
+}
+
+/**
+ * @brief 프리페치된 모서리에 충분히 가까워졌으면 루트 모션 소스로 짧은 전환을 시작
+ *
+ * 안쪽 모서리는 목표까지 한 구간, 바깥 모서리는 벽 모서리를 깎지 않도록 옆으로 지나친 뒤 돌아 들어가는 두 구간으로 이동합니다.
+ */
+bool UCustomMovementComponent::TryStartCornerTransition()
+{
+	if (CornerPrefetch.Type == EClimbCornerType::None || IsClimbActionPlaying() || HasAnimRootMotion())
+	{
+		return false;
+	}
+
+	const float LateralSign = GetClimbLateralInputSign();
+	if (LateralSign == 0.f || !IsCornerPrefetchValid(LateralSign))
+	{
+		return false;
+	}
+
+	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+	const float DistanceToFacePlane = FVector::DotProduct(ComponentLocation - CornerPrefetch.FacePoint, CornerPrefetch.FaceNormal);
+
+	CornerTransitionWaypoints.Reset();
+
+	if (CornerPrefetch.Type == EClimbCornerType::Inside)
+	{
+		// 새 벽까지 남은 거리 (벽과 유지하는 간격 제외)
+		if (DistanceToFacePlane - CornerPrefetch.WallDistance > CornerTriggerDistance)
+		{
+			return false;
+		}
+	}
+	else
+	{
+		// 옆면 평면까지 남은 거리 (아직 현재 벽 앞에 있으면 음수)
+		const float RemainingToEdge = -DistanceToFacePlane;
+		if (RemainingToEdge > CornerTriggerDistance)
+		{
+			return false;
+		}
+
+		CornerTransitionWaypoints.Add(ComponentLocation + CornerPrefetch.LateralDirection * (RemainingToEdge + CornerPrefetch.WallDistance));
+	}
+
+	CornerTransitionWaypoints.Add(CornerPrefetch.TargetLocation);
+
+	// 구간 길이에 비례해 전환 시간을 나눔
+	float TotalLength = 0.f;
+	FVector LegStart = ComponentLocation;
+	for (const FVector& Waypoint : CornerTransitionWaypoints)
+	{
+		TotalLength += FVector::Dist(LegStart, Waypoint);
+		LegStart = Waypoint;
+	}
+
+	CornerTransitionLegEndTimes.Reset();
+	float LegEndTime = 0.f;
+	LegStart = ComponentLocation;
+	for (const FVector& Waypoint : CornerTransitionWaypoints)
+	{
+		LegEndTime += CornerTransitionDuration * (TotalLength > UE_KINDA_SMALL_NUMBER ? FVector::Dist(LegStart, Waypoint) / TotalLength : 1.f / CornerTransitionWaypoints.Num());
+		CornerTransitionLegEndTimes.Add(LegEndTime);
+		LegStart = Waypoint;
+	}
+
+	bCornerTransitionActive = true;
+	CornerTransitionLeg = 0;
+	CornerTransitionElapsed = 0.f;
+	CornerTransitionDurationTotal = CornerTransitionDuration;
+	CornerTransitionStartRotation = UpdatedComponent->GetComponentQuat();
+	CornerTransitionTargetRotation = FRotationMatrix::MakeFromX(-CornerPrefetch.FaceNormal).ToQuat();
+	CornerTransitionTargetNormal = CornerPrefetch.FaceNormal;
+
+	StartCornerTransitionLeg();
+	InvalidateCornerPrefetch();
+	InvalidateHopCandidates();
+
+	return true;
+}
+
+void UCustomMovementComponent::StartCornerTransitionLeg()
+{
+	if (CornerRootMotionSourceId != 0)
+	{
+		RemoveRootMotionSourceByID(CornerRootMotionSourceId);
+	}
+
+	const float LegStartTime = CornerTransitionLeg > 0 ? CornerTransitionLegEndTimes[CornerTransitionLeg - 1] : 0.f;
+
+	const TSharedPtr<FRootMotionSource_MoveToForce> MoveToForce = MakeShared<FRootMotionSource_MoveToForce>();
+	MoveToForce->InstanceName = ClimbCorner::RootMotionInstanceName;
+	MoveToForce->AccumulateMode = ERootMotionAccumulateMode::Override;
+	MoveToForce->Priority = 5;
+	MoveToForce->StartLocation = UpdatedComponent->GetComponentLocation();
+	MoveToForce->TargetLocation = CornerTransitionWaypoints[CornerTransitionLeg];
+	MoveToForce->Duration = FMath::Max(CornerTransitionLegEndTimes[CornerTransitionLeg] - LegStartTime, UE_KINDA_SMALL_NUMBER);
+	MoveToForce->FinishVelocityParams.Mode = ERootMotionFinishVelocityMode::SetVelocity;
+	MoveToForce->FinishVelocityParams.SetVelocity = FVector::ZeroVector;
+
+	CornerRootMotionSourceId = ApplyRootMotionSource(MoveToForce);
+}
+
+void UCustomMovementComponent::TickCornerTransition(float DeltaTime)
+{
+	CornerTransitionElapsed += DeltaTime;
+
+	if (CornerTransitionElapsed < CornerTransitionLegEndTimes[CornerTransitionLeg])
+	{
+		return;
+	}
+
+	if (CornerTransitionWaypoints.IsValidIndex(CornerTransitionLeg + 1))
+	{
+		++CornerTransitionLeg;
+		StartCornerTransitionLeg();
+		return;
+	}
+
+	// 새 면을 현재 표면으로 두고 다음 틱부터 평소처럼 스윕 (전환 도중의 표면 캐시는 무효)
+	StopCornerTransition();
+	CurrentClimbableSurfaceNormal = CornerTransitionTargetNormal;
+	UpdatedComponent->SetWorldRotation(CornerTransitionTargetRotation);
+	bHasClimbSurfaceCache = false;
+	Velocity = FVector::ZeroVector;
+}
+
+void UCustomMovementComponent::StopCornerTransition()
+{
+	if (CornerRootMotionSourceId != 0)
+	{
+		RemoveRootMotionSourceByID(CornerRootMotionSourceId);
+		CornerRootMotionSourceId = 0;
+	}
+
+	bCornerTransitionActive = false;
+	CornerTransitionLeg = INDEX_NONE;
+}
+
+#pragma endregion
+
+#pragma region Landscape
+
+ALandscapeProxy* UCustomMovementComponent::GetTrackedLandscape() const
+{
+	const ULandscapeHeightfieldCollisionComponent* LandscapeCollision = Cast<ULandscapeHeightfieldCollisionComponent>(ClimbSurfaceBase.Get());
+	return LandscapeCollision ? LandscapeCollision->GetLandscapeProxy() : nullptr;
+}
+
+/**
+ * @brief 랜드스케이프 하이트필드에서 캐릭터 앞 등반 표면을 직접 샘플링
+ *
+ * 캡슐 스윕 대신 캡슐 높이의 세 지점에서 전방 선분과 하이트필드의 교차점을 이분 탐색으로 구하고,
+ * 교차점의 노멀은 그리드 간격 중심 차분으로 계산합니다.
+ * 결과는 스윕과 같은 형태의 히트로 ClimbableSurfacesTracedResults 에 채워 이후 처리를 공유합니다.
+ *
+ * @return 하나 이상의 표면 지점을 찾았으면 true (false 면 호출 측에서 스윕으로 대체)
+ */
+bool UCustomMovementComponent::TraceLandscapeClimbableSurfaces(const ALandscapeProxy* Landscape)
+{
+	UPrimitiveComponent* LandscapeCollision = ClimbSurfaceBase.Get();
+	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+	const FVector ComponentForward = UpdatedComponent->GetForwardVector();
+	const FVector ComponentUp = UpdatedComponent->GetUpVector();
+	const float ProbeDistance = 30.f + ClimbCapsuleTraceRadius;
+
+	TArray<FHitResult> LandscapeHits;
+
+	for (const float HeightRatio : ClimbLandscape::SurfaceSampleHeights)
+	{
+		const FVector Start = ComponentLocation + ComponentUp * (ClimbCapsuleTraceHalfHeight * HeightRatio);
+		const FVector End = Start + ComponentForward * ProbeDistance;
+
+		FVector SurfacePoint;
+		FVector SurfaceNormal;
+		if (!ClimbLandscape::IntersectSegment(Landscape, Start, End, SurfacePoint) || !ClimbLandscape::SampleNormal(Landscape, SurfacePoint, SurfaceNormal))
+		{
+			continue;
+		}
+
+		FHitResult& Hit = LandscapeHits.Emplace_GetRef(LandscapeCollision->GetOwner(), LandscapeCollision, SurfacePoint, SurfaceNormal);
+		Hit.bBlockingHit = true;
+		Hit.TraceStart = Start;
+		Hit.TraceEnd = End;
+		Hit.Distance = FVector::Dist(Start, SurfacePoint);
+	}
+
+	if (LandscapeHits.IsEmpty())
+	{
+		return false;
+	}
+
+	// 스윕 결과와 마찬가지로 가까운 순서로 정렬
+	LandscapeHits.Sort([](const FHitResult& A, const FHitResult& B) { return A.Distance < B.Distance; });
+	ClimbableSurfacesTracedResults = MoveTemp(LandscapeHits);
+
+	return true;
+}
+
+bool UCustomMovementComponent::CheckHasReachedLandscapeFloor(const ALandscapeProxy* Landscape) const
+{
+	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+
+	float FloorHeight;
+	FVector FloorNormal;
+	if (!ClimbLandscape::SampleHeight(Landscape, ComponentLocation, FloorHeight) || !ClimbLandscape::SampleNormal(Landscape, ComponentLocation, FloorNormal))
+	{
+		return false;
+	}
+
+	// 바닥 스윕과 같은 범위 (50 오프셋 + 캡슐 반높이) 안에 걸을 수 있는 지면이 있으면 도착
+	// 하이트필드는 완전한 수평면이 드물어 평행 조건 대신 걸을 수 있는 경사 조건을 사용
+	const float DistanceToFloor = ComponentLocation.Z - FloorHeight;
+	return DistanceToFloor <= 50.f + ClimbCapsuleTraceHalfHeight && FloorNormal.Z >= GetWalkableFloorZ();
+}
+
+bool UCustomMovementComponent::CanTopOutOnLandscape(const ALandscapeProxy* Landscape) const
+{
+	// TraceFromEyeHeight(50.f) 과 같은 지점: 눈높이에서 50 앞
+	const FVector EyeLocation = UpdatedComponent->GetComponentLocation() + UpdatedComponent->GetUpVector() * CharacterOwner->BaseEyeHeight;
+	const FVector LedgeProbeLocation = EyeLocation + UpdatedComponent->GetForwardVector() * 50.f;
+
+	float LedgeHeight;
+	if (!ClimbLandscape::SampleHeight(Landscape, LedgeProbeLocation, LedgeHeight))
+	{
+		return false;
+	}
+
+	// 눈높이 앞은 비어 있고 (지형보다 위), 그 아래 100 이내에 올라설 지면이 있어야 함
+	return LedgeHeight < LedgeProbeLocation.Z && LedgeHeight >= LedgeProbeLocation.Z - 100.f;
+}
+
+#pragma endregion
+
+#pragma region Async Physics
+
+bool UCustomMovementComponent::ShouldUseAsyncClimbPhysics() const
+{
+	if (!bUseAsyncClimbPhysics || !ClimbAsyncPhysics::CVarEnable.GetValueOnGameThread() || !ClimbAsyncPhysicsSubsystem || !ClimbAsyncPhysicsSubsystem->IsAvailable())
+	{
+		return false;
+	}
+
+	// 루트 모션 / 모서리 전환은 게임 스레드 스윕으로만 움직임
+	if (bCornerTransitionActive || HasAnimRootMotion() || CurrentRootMotion.HasActiveRootMotionSources())
+	{
+		return false;
+	}
+
+	// 물리 스레드 상태는 월드 공간이므로 움직이는 표면에서는 베이스를 따라가는 게임 스레드 경로를 씀
+	if (IsClimbingOnDynamicBase())
+	{
+		return false;
+	}
+
+	// 클라이언트 예측 / 서버 보정은 게임 스레드 이동을 전제로 하므로 조종 중인 플레이어 캐릭터는 제외
+	const ENetMode NetMode = GetNetMode();
+	return NetMode == NM_Standalone || (CharacterOwner->HasAuthority() && !CharacterOwner->IsPlayerControlled());
+}
+
+/**
+ * @brief 물리 스레드 결과를 보간해 적용하고, 다음 스텝에 쓸 입력과 표면 모델을 보냄
+ *
+ * 물리 스레드 결과는 한두 틱 늦게 도착하므로, 첫 결과가 오기 전과 리셋 직후에는 제자리에 머문다.
+ */
+void UCustomMovementComponent::PhysClimbAsync(float deltaTime, int32 Iterations)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PhysClimb);
+
+	if (deltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	// 모서리 전환은 루트 모션 소스로 움직이므로 이번 틱부터 게임 스레드 경로로 넘김
+	if (TryStartCornerTransition())
+	{
+		bAsyncClimbNeedsReset = true;
+		PhysClimb(deltaTime, Iterations);
+		return;
+	}
+
+	RefreshAsyncClimbSurfaceModel();
+
+	// 재프로브로 움직이는 표면에 올라탔으면 이번 틱부터 게임 스레드 경로로 넘김
+	if (IsClimbingOnDynamicBase())
+	{
+		bAsyncClimbNeedsReset = true;
+		PhysClimb(deltaTime, Iterations);
+		return;
+	}
+
+	if (CheckShouldStopClimbing())
+	{
+		StopClimbing();
+		return;
+	}
+
+	if (AsyncClimberId == 0)
+	{
+		AsyncClimberId = ClimbAsyncPhysicsSubsystem->RegisterClimber();
+		bAsyncClimbNeedsReset = true;
+	}
+
+	if (bAsyncClimbNeedsReset)
+	{
+		++AsyncClimbInput.ResetSerial;
+		bAsyncClimbNeedsReset = false;
+	}
+
+	AsyncClimbInput.ClimberId = AsyncClimberId;
+	AsyncClimbInput.Location = UpdatedComponent->GetComponentLocation();
+	AsyncClimbInput.Rotation = UpdatedComponent->GetComponentQuat();
+	AsyncClimbInput.Velocity = Velocity;
+	AsyncClimbInput.InputAcceleration = Acceleration;
+	AsyncClimbInput.MaxSpeed = GetMaxSpeed();
+	AsyncClimbInput.BrakingDeceleration = MaxBreakClimbDeceleration;
+	AsyncClimbInput.SnapSpeed = MaxClimbSpeed;
+	AsyncClimbInput.CapsuleRadius = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	AsyncClimbInput.SurfaceLocation = CurrentClimbableSurfaceLocation;
+	AsyncClimbInput.SurfaceNormal = CurrentClimbableSurfaceNormal;
+	AsyncClimbInput.bLedgeCapable = CurrentClimbSurfaceProperties.bLedgeCapable;
+	AsyncClimbInput.EyeHeight = CharacterOwner->BaseEyeHeight;
+
+	ClimbAsyncPhysicsSubsystem->PushClimberInput(AsyncClimbInput);
+
+	FClimbAsyncClimberOutput Output;
+	if (!ClimbAsyncPhysicsSubsystem->GetClimberOutput(AsyncClimberId, AsyncClimbInput.ResetSerial, Output))
+	{
+		return;
+	}
+
+	if (Output.Transition != EClimbAsyncTransition::None)
+	{
+		ApplyAsyncClimbTransition(Output.Transition);
+		return;
+	}
+
+	// 물리 스레드는 충돌을 모르므로 결과 위치까지는 스윕으로 이동
+	const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+	const FVector Adjusted = Output.Location - OldLocation;
+
+	FHitResult Hit(1.f);
+	SafeMoveUpdatedComponent(Adjusted, Output.Rotation, true, Hit);
+
+	if (Hit.Time < 1.f)
+	{
+		HandleImpact(Hit, deltaTime, Adjusted);
+		SlideAlongSurface(Adjusted, (1.f - Hit.Time), Hit.Normal, Hit, true);
+	}
+
+	Velocity = Output.Velocity;
+
+	// 충돌로 막혔으면 다음 입력에서 물리 스레드를 실제 위치로 되돌림
+	if (FVector::DistSquared(UpdatedComponent->GetComponentLocation(), Output.Location) > FMath::Square(AsyncClimbResyncDistance))
+	{
+		bAsyncClimbNeedsReset = true;
+	}
+}
+
+void UCustomMovementComponent::RefreshAsyncClimbSurfaceModel()
+{
+	if (CanReuseClimbSurfaceCache())
+	{
+		RestoreClimbSurfaceFromBase();
+		return;
+	}
+
+	const ALandscapeProxy* Landscape = GetTrackedLandscape();
+	if (!Landscape || !TraceLandscapeClimbableSurfaces(Landscape))
+	{
+		TraceClimbableSurfaces();
+	}
+
+	ProcessClimbableSurfaceInfo();
+	UpdateClimbSurfaceBase();
+	PrefetchAsyncClimbFloorAndLedge();
+}
+
+/**
+ * @brief 물리 스레드가 다음 재프로브까지 쓸 바닥 / 렛지 높이를 구함
+ *
+ * 판정 범위(CheckHasReachedFloor / CanTopOut)보다 재프로브 거리만큼 넓게 찾아, 그 사이 이동에서도 놓치지 않도록 한다.
+ */
+void UCustomMovementComponent::PrefetchAsyncClimbFloorAndLedge()
+{
+	const FVector ComponentLocation = UpdatedComponent->GetComponentLocation();
+	const FVector UpVector = UpdatedComponent->GetUpVector();
+	const float FloorReachDistance = ClimbAsyncPhysics::FloorTraceOffset + ClimbCapsuleTraceHalfHeight;
+
+	AsyncClimbInput.FloorReachDistance = FloorReachDistance;
+	AsyncClimbInput.LedgeReachDistance = ClimbAsyncPhysics::LedgeReachDistance;
+	AsyncClimbInput.bHasFloor = false;
+	AsyncClimbInput.bHasLedge = false;
+
+	// 랜드스케이프 벽에서도 트레이스함 (지형 위에 놓인 바위 / 메시 바닥은 하이트필드 샘플에 없음)
+	const FVector FloorTraceEnd = ComponentLocation - UpVector * (FloorReachDistance + ClimbReprobeDistance);
+	const FHitResult FloorHit = DoLineTraceSingleByChannel(ComponentLocation, FloorTraceEnd, false, false);
+
+	if (FloorHit.bBlockingHit)
+	{
+		// 하이트필드는 완전한 수평면이 드물어 평행 조건 대신 걸을 수 있는 경사 조건을 사용 (CheckHasReachedLandscapeFloor 와 같음)
+		const bool bLandscapeFloor = Cast<ULandscapeHeightfieldCollisionComponent>(FloorHit.GetComponent()) != nullptr;
+
+		AsyncClimbInput.bHasFloor = bLandscapeFloor ? FloorHit.ImpactNormal.Z >= GetWalkableFloorZ() : FVector::Parallel(-FloorHit.ImpactNormal, FVector::UpVector);
+		AsyncClimbInput.FloorHeight = FloorHit.ImpactPoint.Z;
+	}
+
+	// 눈높이 앞을 위에서 내려다보며 렛지 윗면을 찾음 (벽 안에서 시작하면 아직 렛지가 범위 밖)
+	const FVector LedgeTraceStart = ComponentLocation + UpVector * (CharacterOwner->BaseEyeHeight + ClimbAsyncPhysics::LedgeProbeHeight)
+		+ UpdatedComponent->GetForwardVector() * ClimbAsyncPhysics::LedgeForwardOffset;
+	const FVector LedgeTraceEnd = LedgeTraceStart - UpVector * (ClimbAsyncPhysics::LedgeProbeHeight + ClimbAsyncPhysics::LedgeReachDistance);
+	const FHitResult LedgeHit = DoLineTraceSingleByChannel(LedgeTraceStart, LedgeTraceEnd, false, false);
+
+	if (LedgeHit.bBlockingHit && !LedgeHit.bStartPenetrating)
+	{
+		AsyncClimbInput.bHasLedge = true;
+		AsyncClimbInput.LedgeTopHeight = LedgeHit.ImpactPoint.Z;
+	}
+}
+
+bool UCustomMovementComponent::IsClimbingOnDynamicBase() const
+{
+	return GetMovementBase() != nullptr || MovementBaseUtility::IsDynamicBase(ClimbSurfaceBase.Get());
+}
+
+void UCustomMovementComponent::ApplyAsyncClimbTransition(EClimbAsyncTransition Transition)
+{
+	switch (Transition)
+	{
+	case EClimbAsyncTransition::ReachedFloor:
+		StopClimbing();
+		break;
+
+	case EClimbAsyncTransition::TopOut:
+		HandleReachedLedge();
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UCustomMovementComponent::ReleaseAsyncClimber()
+{
+	if (AsyncClimberId != 0 && ClimbAsyncPhysicsSubsystem)
+	{
+		ClimbAsyncPhysicsSubsystem->UnregisterClimber(AsyncClimberId);
+	}
+
+	AsyncClimberId = 0;
+	bAsyncClimbNeedsReset = true;
+}
+
+#pragma endregion
+
+#pragma region Tick Policy
+
+void UCustomMovementComponent::WakeClimbTick()
+{
+	ClimbStationaryTime = 0.f;
+	SetClimbTickState(EClimbTickState::Active);
+}
+
+void UCustomMovementComponent::AddInputVector(FVector WorldVector, bool bForce)
+{
+	if (!WorldVector.IsZero())
+	{
+		WakeClimbTick();
+	}
+
+	Super::AddInputVector(WorldVector, bForce);
+}
+
+void UCustomMovementComponent::AddImpulse(FVector Impulse, bool bVelocityChange)
+{
+	WakeClimbTick();
+
+	Super::AddImpulse(Impulse, bVelocityChange);
+}
+
+void UCustomMovementComponent::AddForce(FVector Force)
+{
+	WakeClimbTick();
+
+	Super::AddForce(Force);
+}
+
+void UCustomMovementComponent::Launch(FVector const& LaunchVel)
+{
+	WakeClimbTick();
+
+	Super::Launch(LaunchVel);
+}
+
+void UCustomMovementComponent::RequestDirectMove(const FVector& MoveVelocity, bool bForceMaxSpeed)
+{
+	// 경로 추종 (AI MoveTo) 은 입력 벡터를 거치지 않음
+	WakeClimbTick();
+
+	Super::RequestDirectMove(MoveVelocity, bForceMaxSpeed);
+}
+
+void UCustomMovementComponent::RequestPathMove(const FVector& MoveInput)
+{
+	WakeClimbTick();
+
+	Super::RequestPathMove(MoveInput);
+}
+
+void UCustomMovementComponent::SmoothCorrection(const FVector& OldLocation, const FQuat& OldRotation, const FVector& NewLocation, const FQuat& NewRotation)
+{
+	// 시뮬레이티드 프록시: 서버 위치 갱신이 오면 보간을 위해 깨어남
+	WakeClimbTick();
+
+	Super::SmoothCorrection(OldLocation, OldRotation, NewLocation, NewRotation);
+}
+
+/**
+ * @brief 정지 상태에 따라 이동 컴포넌트의 틱 빈도를 조절
+ *
+ * 정지 상태가 StationaryTimeBeforeSleep 이상 이어지면
+ * - 지상: 틱을 끄고 캡슐 / 무브먼트 베이스의 트랜스폼 변경을 구독해 잠듦
+ * - 등반 중: ClimbIdleTickInterval 간격으로 틱
+ * 입력, 충격, 이동 모드 변경, 등반 요청 등은 WakeClimbTick 으로 즉시 되돌립니다.
+ */
+void UCustomMovementComponent::UpdateClimbTickPolicy(float DeltaTime)
+{
+	if (!bEnableClimbTickPolicy || !CanClimbTickSleep() || !IsStationary())
+	{
+		if (ClimbTickState != EClimbTickState::Active)
+		{
+			WakeClimbTick();
+		}
+
+		ClimbStationaryTime = 0.f;
+		return;
+	}
+
+	ClimbStationaryTime += DeltaTime;
+
+	if (ClimbStationaryTime < StationaryTimeBeforeSleep)
+	{
+		return;
+	}
+
+	if (IsInAnyClimbMode())
+	{
+		SetClimbTickState(EClimbTickState::ClimbIdle);
+	}
+	else if (IsMovingOnGround())
+	{
+		SetClimbTickState(EClimbTickState::Sleeping);
+	}
+}
+
+void UCustomMovementComponent::SetClimbTickState(EClimbTickState NewState)
+{
+	if (ClimbTickState == NewState)
+	{
+		return;
+	}
+
+	const EClimbTickState PreviousState = ClimbTickState;
+	ClimbTickState = NewState;
+
+	USkeletalMeshComponent* Mesh = CharacterOwner ? CharacterOwner->GetMesh() : nullptr;
+
+	if (PreviousState == EClimbTickState::Sleeping)
+	{
+		UpdatedComponent->TransformUpdated.Remove(SleepingTransformUpdatedHandle);
+		UnbindSleepingMovementBase();
+		SetComponentTickEnabled(true);
+
+		if (Mesh)
+		{
+			Mesh->SetComponentTickEnabled(true);
+			Mesh->SetComponentTickInterval(AwakeMeshTickInterval);
+		}
+	}
+
+	bClampNextTickDeltaTime = PreviousState != EClimbTickState::Active;
+
+	switch (NewState)
+	{
+	case EClimbTickState::Active:
+		SetComponentTickInterval(0.f);
+		break;
+
+	case EClimbTickState::ClimbIdle:
+		SetComponentTickInterval(ClimbIdleTickInterval * GetClimbProbeQuality().IdleTickIntervalScale);
+		break;
+
+	case EClimbTickState::Sleeping:
+		SetComponentTickInterval(0.f);
+		SetComponentTickEnabled(false);
+
+		// 텔레포트나 움직이는 베이스처럼 틱 밖에서 일어나는 이동으로 깨어남
+		SleepingTransformUpdatedHandle = UpdatedComponent->TransformUpdated.AddUObject(this, &ThisClass::OnSleepingTransformUpdated);
+
+		// 바닥이 사라지거나 콜리전이 꺼지면 떨어지기 시작해야 하므로 정적 바닥도 구독
+		if (UPrimitiveComponent* Base = GetMovementBase())
+		{
+			SleepingMovementBase = Base;
+			SleepingBaseCollisionChangedHandle = Base->OnComponentCollisionSettingsChangedEvent.AddUObject(this, &ThisClass::OnSleepingBaseCollisionChanged);
+			Base->OnComponentPhysicsStateChanged.AddDynamic(this, &ThisClass::OnSleepingBasePhysicsStateChanged);
+
+			if (MovementBaseUtility::IsDynamicBase(Base))
+			{
+				SleepingBaseTransformUpdatedHandle = Base->TransformUpdated.AddUObject(this, &ThisClass::OnSleepingTransformUpdated);
+			}
+		}
+
+		if (Mesh)
+		{
+			AwakeMeshTickInterval = Mesh->GetComponentTickInterval();
+
+			if (IsNetMode(NM_DedicatedServer))
+			{
+				Mesh->SetComponentTickEnabled(false);
+			}
+			else if (SleepingMeshTickInterval > 0.f)
+			{
+				Mesh->SetComponentTickInterval(SleepingMeshTickInterval);
+			}
+		}
+		break;
+	}
+}
+
+bool UCustomMovementComponent::CanClimbTickSleep() const
+{
+	if (!CharacterOwner || !UpdatedComponent)
+	{
+		return false;
+	}
+
+	// 원격 클라이언트가 조종하는 서버 측 캐릭터는 서버 이동 검증 흐름을 건드리지 않음
+	return !(CharacterOwner->HasAuthority() && CharacterOwner->GetRemoteRole() == ROLE_AutonomousProxy);
+}
+
+bool UCustomMovementComponent::IsStationary() const
+{
+	return Velocity.IsNearlyZero(1.f)
+		&& Acceleration.IsNearlyZero()
+		&& !CharacterOwner->bPressedJump
+		&& !HasAnimRootMotion()
+		&& !CurrentRootMotion.HasActiveRootMotionSources()
+		&& !IsClimbActionPlaying()
+		&& !IsFollowingClimbRoute()
+		&& !bClimbProbeSnapshotRequested;
+}
+
+void UCustomMovementComponent::OnSleepingTransformUpdated(USceneComponent* InUpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	WakeClimbTick();
+}
+
+void UCustomMovementComponent::OnSleepingBaseCollisionChanged(UPrimitiveComponent* ChangedComponent)
+{
+	WakeClimbTick();
+}
+
+void UCustomMovementComponent::OnSleepingBasePhysicsStateChanged(UPrimitiveComponent* ChangedComponent, EComponentPhysicsStateChange StateChange)
+{
+	// 바닥 컴포넌트가 파괴 / 등록 해제되면 물리 상태가 먼저 사라짐
+	if (StateChange == EComponentPhysicsStateChange::Destroyed)
+	{
+		WakeClimbTick();
+	}
+}
+
+void UCustomMovementComponent::UnbindSleepingMovementBase()
+{
+	if (UPrimitiveComponent* Base = SleepingMovementBase.Get())
+	{
+		Base->TransformUpdated.Remove(SleepingBaseTransformUpdatedHandle);
+		Base->OnComponentCollisionSettingsChangedEvent.Remove(SleepingBaseCollisionChangedHandle);
+		Base->OnComponentPhysicsStateChanged.RemoveDynamic(this, &ThisClass::OnSleepingBasePhysicsStateChanged);
+	}
+
+	SleepingBaseTransformUpdatedHandle.Reset();
+	SleepingBaseCollisionChangedHandle.Reset();
+	SleepingMovementBase.Reset();
+}
+
+/**
+ * @brief 이동 결과에 영향을 주는 품질 설정
+ *
+ * 원격 클라이언트가 조종하는 캐릭터는 클라이언트 (자율 프록시) 와 서버가 같은 프로브를 해야 예측이 어긋나지 않으므로
+ * 기기 품질과 상관없이 항상 최고 품질을 씁니다. 유휴 틱 간격과 홉 미리 트레이스도 이동 갱신 시점 / 홉 판정 경로를 바꾸므로 여기를 거쳐 읽습니다.
+ */
+const FClimbQualitySettings& UCustomMovementComponent::GetClimbProbeQuality() const
+{
+	static const FClimbQualitySettings FullQuality;
+
+	if (!CharacterOwner)
+	{
+		return FClimbQualitySettings::Get();
+	}
+
+	const bool bServerValidated = CharacterOwner->GetLocalRole() == ROLE_AutonomousProxy
+		|| (CharacterOwner->HasAuthority() && CharacterOwner->GetRemoteRole() == ROLE_AutonomousProxy);
+
+	return bServerValidated ? FullQuality : FClimbQualitySettings::Get();
+}
+
+void UCustomMovementComponent::OnClimbQualityChanged()
+{
+	// 깨어나며 바뀐 틱 간격이 적용되고, 다음 등반 틱이 새 품질로 다시 프로브함
+	WakeClimbTick();
+
+	bHasClimbSurfaceCache = false;
+	InvalidateHopCandidates();
+	InvalidateCornerPrefetch();
+}
+
+#pragma endregion
+
+TArray<FHitResult> UCustomMovementComponent::DoCapsuleTraceMultiByChannel(const FVector & Start, const FVector & End, bool bShowDebugShape, bool bDrawPersistantShapes, bool bIgnoreNonClimbableSurfaces, float ShapeScale)
+{	
+	TArray<FHitResult> OutCapsuleTraceHitResults;
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbCapsuleTrace), false);
+	QueryParams.bReturnPhysicalMaterial = true;
+	AddClimbQueryIgnoredOwner(QueryParams);
+
+	// 응답을 모두 Overlap 으로 낮춰 첫 블로킹 히트에서 멈추지 않고 캡슐에 닿은 표면 전체를 수집
+	const FCollisionResponseParams ResponseParams(ECR_Overlap);
+
+	const float CapsuleRadius = ClimbCapsuleTraceRadius * ShapeScale;
+	const float CapsuleHalfHeight = ClimbCapsuleTraceHalfHeight * ShapeScale;
+	const FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(CapsuleRadius, CapsuleHalfHeight);
+
+	// 같은 프레임에 다른 캐릭터가 같은 쿼리를 했다면 캐시 결과를 공유
+	if (ClimbQueryCacheSubsystem)
+	{
+		ClimbQueryCacheSubsystem->SweepMulti(OutCapsuleTraceHitResults, Start, End, FQuat::Identity, ClimbTraceChannel, CapsuleShape, QueryParams, ResponseParams);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_ClimbSceneQueries);
+		++ClimbStats::NumSceneQueries;
+
+		GetWorld()->SweepMultiByChannel(OutCapsuleTraceHitResults, Start, End, FQuat::Identity, ClimbTraceChannel, CapsuleShape, QueryParams, ResponseParams);
+	}
+
+	// 등반 불가 컴포넌트는 Climb 채널을 무시해 쿼리에서 빠지고, 피지컬 머티리얼로 등반 불가인 히트만 여기서 거름
+	if (ClimbSurfaceSubsystem && bIgnoreNonClimbableSurfaces)
+	{
+		ClimbSurfaceSubsystem->FilterClimbableHits(OutCapsuleTraceHitResults);
+	}
+
+	if (bShowDebugShape)
+	{
+		const float LifeTime = bDrawPersistantShapes ? -1.f : 0.f;
+		const FColor TraceColor = OutCapsuleTraceHitResults.IsEmpty() ? FColor::Red : FColor::Green;
+
+		DrawDebugCapsule(GetWorld(), Start, CapsuleHalfHeight, CapsuleRadius, FQuat::Identity, TraceColor, bDrawPersistantShapes, LifeTime);
+		DrawDebugCapsule(GetWorld(), End, CapsuleHalfHeight, CapsuleRadius, FQuat::Identity, TraceColor, bDrawPersistantShapes, LifeTime);
+
+		for (const FHitResult& HitResult : OutCapsuleTraceHitResults)
+		{
+			DrawDebugPoint(GetWorld(), HitResult.ImpactPoint, 10.f, FColor::Blue, bDrawPersistantShapes, LifeTime);
+		}
+	}
+
+	return OutCapsuleTraceHitResults;
+}
+
+/**
+ * @brief 캡슐 스윕과 같은 범위를 캡슐 높이 세 곳의 라인 트레이스로 근사
+ *
+ * 각 라인은 스윕 방향으로 캡슐 반지름만큼 앞뒤로 늘려 캡슐 앞면이 닿는 표면을 찾습니다.
+ * 얇은 돌출부나 모서리는 놓칠 수 있지만 캡슐 스윕보다 쿼리 비용이 훨씬 쌉니다.
+ */
+TArray<FHitResult> UCustomMovementComponent::DoLineProbeTraceMultiByChannel(const FVector& Start, const FVector& End, bool bInShowDebugShape, bool bInDrawPersistantShapes)
+{
+	TArray<FHitResult> OutLineTraceHitResults;
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbLineProbeTrace), false);
+	QueryParams.bReturnPhysicalMaterial = true;
+	AddClimbQueryIgnoredOwner(QueryParams);
+
+	const FCollisionResponseParams ResponseParams(ECR_Overlap);
+
+	FVector SweepDirection = (End - Start).GetSafeNormal();
+	if (SweepDirection.IsZero())
+	{
+		SweepDirection = UpdatedComponent->GetForwardVector();
+	}
+
+	const FVector UpVector = UpdatedComponent->GetUpVector();
+
+	for (const float SampleHeight : ClimbLandscape::SurfaceSampleHeights)
+	{
+		const FVector HeightOffset = UpVector * (SampleHeight * ClimbCapsuleTraceHalfHeight);
+		const FVector LineStart = Start + HeightOffset - SweepDirection * ClimbCapsuleTraceRadius;
+		const FVector LineEnd = End + HeightOffset + SweepDirection * ClimbCapsuleTraceRadius;
+
+		TArray<FHitResult> LineHits;
+
+		if (ClimbQueryCacheSubsystem)
+		{
+			ClimbQueryCacheSubsystem->SweepMulti(LineHits, LineStart, LineEnd, FQuat::Identity, ClimbTraceChannel, FCollisionShape::LineShape, QueryParams, ResponseParams);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_ClimbSceneQueries);
+			++ClimbStats::NumSceneQueries;
+
+			GetWorld()->LineTraceMultiByChannel(LineHits, LineStart, LineEnd, ClimbTraceChannel, QueryParams, ResponseParams);
+		}
+
+		if (bInShowDebugShape)
+		{
+			const float LifeTime = bInDrawPersistantShapes ? -1.f : 0.f;
+			DrawDebugLine(GetWorld(), LineStart, LineEnd, LineHits.IsEmpty() ? FColor::Red : FColor::Green, bInDrawPersistantShapes, LifeTime);
+		}
+
+		OutLineTraceHitResults.Append(MoveTemp(LineHits));
+	}
+
+	if (ClimbSurfaceSubsystem)
+	{
+		ClimbSurfaceSubsystem->FilterClimbableHits(OutLineTraceHitResults);
+	}
+
+	if (bInShowDebugShape)
+	{
+		const float LifeTime = bInDrawPersistantShapes ? -1.f : 0.f;
+
+		for (const FHitResult& HitResult : OutLineTraceHitResults)
+		{
+			DrawDebugPoint(GetWorld(), HitResult.ImpactPoint, 10.f, FColor::Blue, bInDrawPersistantShapes, LifeTime);
+		}
+	}
+
+	return OutLineTraceHitResults;
+}
+
+FHitResult UCustomMovementComponent::DoLineTraceSingleByChannel(const FVector& Start, const FVector& End, bool bInShowDebugShape, bool bInDrawPersistantShapes)
+{
+	FHitResult OutResult;
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbLineTrace), false);
+	QueryParams.bReturnPhysicalMaterial = true;
+	AddClimbQueryIgnoredOwner(QueryParams);
+
+	if (ClimbQueryCacheSubsystem)
+	{
+		ClimbQueryCacheSubsystem->LineTraceSingle(OutResult, Start, End, ClimbTraceChannel, QueryParams);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_ClimbSceneQueries);
+		++ClimbStats::NumSceneQueries;
+
+		GetWorld()->LineTraceSingleByChannel(OutResult, Start, End, ClimbTraceChannel, QueryParams);
+	}
+
+	if (bInShowDebugShape)
+	{
+		const float LifeTime = bInDrawPersistantShapes ? -1.f : 0.f;
+		const FColor TraceColor = OutResult.bBlockingHit ? FColor::Green : FColor::Red;
+
+		DrawDebugLine(GetWorld(), Start, End, TraceColor, bInDrawPersistantShapes, LifeTime);
+
+		if (OutResult.bBlockingHit)
+		{
+			DrawDebugPoint(GetWorld(), OutResult.ImpactPoint, 10.f, FColor::Blue, bInDrawPersistantShapes, LifeTime);
+		}
+	}
+
+	return OutResult;
+}
+
+bool UCustomMovementComponent::TraceClimbableSurfaces()
+{
+	FClimbMovementRuleTracer Tracer(*this);
+	return ClimbRules::TraceClimbableSurfaces(GetClimbRuleSettings(), GetClimbProbePose(), Tracer, ClimbableSurfacesTracedResults);
+}
+
+FHitResult UCustomMovementComponent::TraceFromEyeHeight(float TraceDistance, float TraceStartOffset, bool bInShowDebugShape, bool bInDrawPersistantShapes)
+{
+	FClimbMovementRuleTracer Tracer(*this, bInShowDebugShape, bInDrawPersistantShapes);
+	return ClimbRules::TraceFromEyeHeight(GetClimbRuleSettings(), GetClimbProbePose(), Tracer, TraceDistance, TraceStartOffset);
+}
+
+FClimbRuleSettings UCustomMovementComponent::GetClimbRuleSettings() const
+{
+	FClimbRuleSettings Settings;
+	Settings.TraceChannel = ClimbTraceChannel;
+	Settings.CapsuleTraceRadius = ClimbCapsuleTraceRadius;
+	Settings.CapsuleTraceHalfHeight = ClimbCapsuleTraceHalfHeight;
+	Settings.ClimbDownWalkableSurfaceTraceOffset = ClimbDownWalkableSurfaceTraceOffset;
+	Settings.ClimbDownLedgeTraceOffset = ClimbDownLedgeTraceOffset;
+	Settings.MaxClimbableSurfaceAngle = MaxClimbableSurfaceAngle;
+	Settings.VaultTraceSteps = VaultTraceSteps;
+	Settings.VaultLandTraceIndex = VaultLandTraceIndex;
+
+	// BeginPlay 전(CDO 등)에도 프로필 수치가 반영되도록 ApplyClimbProfileTuning 과 같은 값을 덮어씀
+	if (ClimbProfile)
+	{
+		const FClimbTuning& Tuning = ClimbProfile->Tuning;
+		Settings.CapsuleTraceRadius = Tuning.ClimbCapsuleTraceRadius;
+		Settings.CapsuleTraceHalfHeight = Tuning.ClimbCapsuleTraceHalfHeight;
+		Settings.ClimbDownWalkableSurfaceTraceOffset = Tuning.ClimbDownWalkableSurfaceTraceOffset;
+		Settings.ClimbDownLedgeTraceOffset = Tuning.ClimbDownLedgeTraceOffset;
+		Settings.MaxClimbableSurfaceAngle = Tuning.MaxClimbableSurfaceAngle;
+	}
+
+	if (CharacterOwner)
+	{
+		Settings.EyeHeight = CharacterOwner->BaseEyeHeight;
+	}
+
+	return Settings;
+}
+
+/**
+ * @brief 캐릭터 콜리전이 Climb 채널에 응답하면 자기 자신을 쿼리에서 제외
+ *
+ * Climb 채널은 기본 응답이 Ignore 라 캐릭터 프로필은 보통 응답하지 않으므로 아무것도 추가하지 않으며,
+ * 그래서 같은 위치의 쿼리를 캐릭터끼리 캐시로 공유할 수 있다.
+ */
+void UCustomMovementComponent::AddClimbQueryIgnoredOwner(FCollisionQueryParams& QueryParams) const
+{
+	if (!CharacterOwner)
+	{
+		return;
+	}
+
+	const USkeletalMeshComponent* Mesh = CharacterOwner->GetMesh();
+	const bool bCapsuleResponds = UpdatedPrimitive && UpdatedPrimitive->GetCollisionResponseToChannel(ClimbTraceChannel) != ECR_Ignore;
+	const bool bMeshResponds = Mesh && Mesh->IsQueryCollisionEnabled() && Mesh->GetCollisionResponseToChannel(ClimbTraceChannel) != ECR_Ignore;
+
+	if (bCapsuleResponds || bMeshResponds)
+	{
+		QueryParams.AddIgnoredActor(CharacterOwner);
+	}
+}
+
+FClimbProbePose UCustomMovementComponent::GetClimbProbePose() const
+{
+	FClimbProbePose Pose;
+	Pose.Location = UpdatedComponent->GetComponentLocation();
+	Pose.Forward = UpdatedComponent->GetForwardVector();
+	Pose.Up = UpdatedComponent->GetUpVector();
+	return Pose;
 }
@@ -0,0 +1,204 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Net/ClimbReplicationGraph.h"
+
+#include "ClimbingSystem.h"
+#include "Components/CustomMovementComponent.h"
+#include "GameFramework/Character.h"
+
+namespace ClimbReplication
+{
+	static TAutoConsoleVariable<float> CVarNearDistance(
+		TEXT("climb.Net.NearDistance"),
+		1500.f,
+		TEXT("이 거리 안의 뷰어에게는 등반 캐릭터를 매 프레임 리플리케이트"));
+
+	static TAutoConsoleVariable<float> CVarFarDistance(
+		TEXT("climb.Net.FarDistance"),
+		10000.f,
+		TEXT("이 거리부터 등반 캐릭터의 리플리케이션 주기가 최대"));
+
+	static TAutoConsoleVariable<int32> CVarMaxClimbPeriodFrames(
+		TEXT("climb.Net.MaxClimbPeriodFrames"),
+		4,
+		TEXT("최대 속도로 등반 중인 먼 캐릭터의 리플리케이션 주기 (프레임)"));
+
+	static TAutoConsoleVariable<int32> CVarMaxIdlePeriodFrames(
+		TEXT("climb.Net.MaxIdlePeriodFrames"),
+		12,
+		TEXT("벽에 멈춰 있는 먼 캐릭터의 리플리케이션 주기 (프레임)"));
+}
+
+#pragma region Climbing Characters Node
+
+void UReplicationGraphNode_ClimbingCharacters::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	ACharacter* Character = Cast<ACharacter>(ActorInfo.Actor);
+	if (!Character)
+	{
+		return;
+	}
+
+	FClimbingCharacter& Entry = ClimbingCharacters.Add(Character);
+	Entry.Character = Character;
+	Entry.MovementComponent = Cast<UCustomMovementComponent>(Character->GetCharacterMovement());
+}
+
+bool UReplicationGraphNode_ClimbingCharacters::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	const bool bRemoved = ClimbingCharacters.Remove(ActorInfo.Actor) > 0;
+
+	if (!bRemoved && bWarnIfNotFound)
+	{
+		UE_LOG(LogClimbingSystem, Warning, TEXT("ClimbingCharacters 노드에 없는 액터 제거 요청: %s"), *GetNameSafe(ActorInfo.Actor));
+	}
+
+	return bRemoved;
+}
+
+void UReplicationGraphNode_ClimbingCharacters::NotifyResetAllNetworkActors()
+{
+	ClimbingCharacters.Reset();
+}
+
+/**
+ * @brief 앞선 노드(그리드 등) 가 이 커넥션에 모은 목록에서 등반 캐릭터를 찾아 주기를 적용
+ *
+ * 비용은 커넥션이 이미 받을 액터 수에 비례하며, 그리드가 걸러 낸 먼 캐릭터는 보지 않는다.
+ */
+void UReplicationGraphNode_ClimbingCharacters::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	if (ClimbingCharacters.IsEmpty())
+	{
+		return;
+	}
+
+	for (const EActorRepListTypeFlags ListFlags : { EActorRepListTypeFlags::Default, EActorRepListTypeFlags::FastShared })
+	{
+		for (const FActorRepListConstView& GatheredList : Params.OutGatheredReplicationLists.GetLists(ListFlags))
+		{
+			for (AActor* Actor : GatheredList)
+			{
+				const FClimbingCharacter* Entry = ClimbingCharacters.Find(Actor);
+				if (!Entry)
+				{
+					continue;
+				}
+
+				FGlobalActorReplicationInfo& GlobalInfo = GraphGlobals->GlobalActorReplicationInfoMap->Get(Actor);
+				FConnectionReplicationActorInfo& ConnectionInfo = Params.ConnectionManager.ActorInfoMap.FindOrAdd(Actor);
+
+				const uint32 PeriodFrame = GetReplicationPeriodFrame(*Entry, Params, GlobalInfo.Settings.ReplicationPeriodFrame);
+				ConnectionInfo.ReplicationPeriodFrame = static_cast<decltype(ConnectionInfo.ReplicationPeriodFrame)>(PeriodFrame);
+
+				// 주기가 줄었으면 (다시 움직이기 시작 / 가까워짐) 예전 긴 주기로 잡힌 다음 전송 프레임을 당김
+				ConnectionInfo.NextReplicationFrameNum = FMath::Min(ConnectionInfo.NextReplicationFrameNum, ConnectionInfo.LastRepFrameNum + PeriodFrame);
+			}
+		}
+	}
+}
+
+/**
+ * @brief 커넥션 기준 리플리케이션 주기
+ *
+ * 가까운 거리 ~ 먼 거리 사이에서 1 프레임부터 최대 주기까지 보간하고, 최대 주기는 등반 속도가 느릴수록 멈춤 주기에 가까워진다.
+ */
+uint32 UReplicationGraphNode_ClimbingCharacters::GetReplicationPeriodFrame(const FClimbingCharacter& Entry, const FConnectionGatherActorListParameters& Params, uint32 DefaultPeriodFrame) const
+{
+	const UCustomMovementComponent* MovementComponent = Entry.MovementComponent;
+	if (!MovementComponent || !MovementComponent->IsInAnyClimbMode())
+	{
+		return DefaultPeriodFrame;
+	}
+
+	if (MovementComponent->IsClimbActionPlaying())
+	{
+		return 1;
+	}
+
+	const FVector CharacterLocation = Entry.Character->GetActorLocation();
+	float NearestViewerDistanceSquared = TNumericLimits<float>::Max();
+
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		// 자기 캐릭터를 보는 커넥션은 줄이지 않음
+		if (Viewer.ViewTarget == Entry.Character || Viewer.InViewer == Entry.Character->GetController())
+		{
+			return 1;
+		}
+
+		NearestViewerDistanceSquared = FMath::Min(NearestViewerDistanceSquared, FVector::DistSquared(Viewer.ViewLocation, CharacterLocation));
+	}
+
+	const float DistanceAlpha = FMath::GetRangePct(
+		ClimbReplication::CVarNearDistance.GetValueOnGameThread(),
+		ClimbReplication::CVarFarDistance.GetValueOnGameThread(),
+		FMath::Sqrt(NearestViewerDistanceSquared));
+
+	const float MaxSpeed = MovementComponent->GetMaxSpeed();
+	const float SpeedAlpha = MaxSpeed > UE_KINDA_SMALL_NUMBER ? MovementComponent->Velocity.Size() / MaxSpeed : 1.f;
+
+	const float MaxPeriodFrame = FMath::Lerp(
+		static_cast<float>(ClimbReplication::CVarMaxIdlePeriodFrames.GetValueOnGameThread()),
+		static_cast<float>(ClimbReplication::CVarMaxClimbPeriodFrames.GetValueOnGameThread()),
+		FMath::Clamp(SpeedAlpha, 0.f, 1.f));
+
+	return static_cast<uint32>(FMath::Max(1, FMath::RoundToInt32(FMath::Lerp(1.f, MaxPeriodFrame, FMath::Clamp(DistanceAlpha, 0.f, 1.f)))));
+}
+
+void UReplicationGraphNode_ClimbingCharacters::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+
+	for (const TPair<const AActor*, FClimbingCharacter>& Pair : ClimbingCharacters)
+	{
+		const FClimbingCharacter& Entry = Pair.Value;
+		const bool bClimbing = Entry.MovementComponent && Entry.MovementComponent->IsInAnyClimbMode();
+		DebugInfo.Log(FString::Printf(TEXT("%s (climbing: %d)"), *GetNameSafe(Entry.Character), bClimbing));
+	}
+
+	DebugInfo.PopIndent();
+}
+
+#pragma endregion
+
+#pragma region Graph
+
+void UClimbReplicationGraph::InitGlobalGraphNodes()
+{
+	Super::InitGlobalGraphNodes();
+
+	// 전역 노드는 추가된 순서로 수집되므로 그리드 뒤에 두어 그리드가 모은 캐릭터에 주기를 적용
+	ClimbingCharacterNode = CreateNewNode<UReplicationGraphNode_ClimbingCharacters>();
+	AddGlobalGraphNode(ClimbingCharacterNode);
+}
+
+void UClimbReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	Super::RouteAddNetworkActorToNodes(ActorInfo, GlobalInfo);
+
+	if (IsClimbingCharacter(ActorInfo.Actor))
+	{
+		ClimbingCharacterNode->NotifyAddNetworkActor(ActorInfo);
+	}
+}
+
+void UClimbReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	Super::RouteRemoveNetworkActorToNodes(ActorInfo);
+
+	if (IsClimbingCharacter(ActorInfo.Actor))
+	{
+		ClimbingCharacterNode->NotifyRemoveNetworkActor(ActorInfo);
+	}
+}
+
+bool UClimbReplicationGraph::IsClimbingCharacter(const AActor* Actor)
+{
+	const ACharacter* Character = Cast<ACharacter>(Actor);
+	return Character && Character->GetCharacterMovement<UCustomMovementComponent>() != nullptr;
+}
+
+#pragma endregion
@@ -0,0 +1,126 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/ClimbAsyncPhysicsSubsystem.h"
+
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PBDRigidsSolver.h"
+
+void UClimbAsyncPhysicsSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	FPhysScene* PhysicsScene = InWorld.GetPhysicsScene();
+	Chaos::FPhysicsSolver* Solver = PhysicsScene ? PhysicsScene->GetSolver() : nullptr;
+
+	if (Solver)
+	{
+		SimCallback = Solver->CreateAndRegisterSimCallbackObject_External<FClimbAsyncSimCallback>();
+	}
+}
+
+void UClimbAsyncPhysicsSubsystem::Deinitialize()
+{
+	if (SimCallback)
+	{
+		if (FPhysScene* PhysicsScene = GetWorld() ? GetWorld()->GetPhysicsScene() : nullptr)
+		{
+			if (Chaos::FPhysicsSolver* Solver = PhysicsScene->GetSolver())
+			{
+				Solver->UnregisterAndFreeSimCallbackObject_External(SimCallback);
+			}
+		}
+
+		SimCallback = nullptr;
+	}
+
+	Results.Empty();
+
+	Super::Deinitialize();
+}
+
+uint32 UClimbAsyncPhysicsSubsystem::RegisterClimber()
+{
+	const uint32 ClimberId = NextClimberId++;
+	Results.Add(ClimberId);
+	return ClimberId;
+}
+
+void UClimbAsyncPhysicsSubsystem::UnregisterClimber(uint32 ClimberId)
+{
+	Results.Remove(ClimberId);
+
+	if (SimCallback)
+	{
+		SimCallback->GetProducerInputData_External()->RemovedClimbers.Add(ClimberId);
+	}
+}
+
+void UClimbAsyncPhysicsSubsystem::PushClimberInput(const FClimbAsyncClimberInput& ClimberInput)
+{
+	if (SimCallback)
+	{
+		SimCallback->GetProducerInputData_External()->Climbers.Add(ClimberInput);
+	}
+}
+
+bool UClimbAsyncPhysicsSubsystem::GetClimberOutput(uint32 ClimberId, uint32 ResetSerial, FClimbAsyncClimberOutput& OutOutput)
+{
+	ConsumeOutputs();
+
+	const FClimberResults* ClimberResults = Results.Find(ClimberId);
+	if (!ClimberResults || !ClimberResults->bHasLatest || ClimberResults->Latest.ResetSerial != ResetSerial)
+	{
+		return false;
+	}
+
+	OutOutput = ClimberResults->Latest;
+
+	// 전환은 보간 없이 즉시 전달, 리셋 직후에는 이전 세대 결과와 섞지 않음
+	if (OutOutput.Transition != EClimbAsyncTransition::None || !ClimberResults->bHasPrevious || ClimberResults->Previous.ResetSerial != ResetSerial)
+	{
+		return true;
+	}
+
+	const Chaos::FPhysicsSolver* Solver = GetWorld()->GetPhysicsScene()->GetSolver();
+	const double ResultsTime = Solver->GetPhysicsResultsTime_External();
+	const double Span = ClimberResults->LatestTime - ClimberResults->PreviousTime;
+	const float Alpha = Span > UE_SMALL_NUMBER ? FMath::Clamp(static_cast<float>((ResultsTime - ClimberResults->PreviousTime) / Span), 0.f, 1.f) : 1.f;
+
+	OutOutput.Location = FMath::Lerp(ClimberResults->Previous.Location, ClimberResults->Latest.Location, Alpha);
+	OutOutput.Rotation = FQuat::Slerp(ClimberResults->Previous.Rotation, ClimberResults->Latest.Rotation, Alpha);
+	OutOutput.Velocity = FMath::Lerp(ClimberResults->Previous.Velocity, ClimberResults->Latest.Velocity, Alpha);
+
+	return true;
+}
+
+void UClimbAsyncPhysicsSubsystem::ConsumeOutputs()
+{
+	if (!SimCallback || LastConsumedFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	LastConsumedFrame = GFrameCounter;
+
+	while (Chaos::TSimCallbackOutputHandle<FClimbAsyncOutput> Output = SimCallback->PopOutputData_External())
+	{
+		for (const FClimbAsyncClimberOutput& ClimberOutput : Output->Climbers)
+		{
+			// 해제된 등반자의 지연 결과는 버림
+			FClimberResults* ClimberResults = Results.Find(ClimberOutput.ClimberId);
+			if (!ClimberResults)
+			{
+				continue;
+			}
+
+			ClimberResults->Previous = ClimberResults->Latest;
+			ClimberResults->PreviousTime = ClimberResults->LatestTime;
+			ClimberResults->bHasPrevious = ClimberResults->bHasLatest;
+
+			ClimberResults->Latest = ClimberOutput;
+			ClimberResults->LatestTime = Output->InternalTime;
+			ClimberResults->bHasLatest = true;
+		}
+	}
+}
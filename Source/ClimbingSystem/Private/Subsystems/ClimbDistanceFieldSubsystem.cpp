@@ -0,0 +1,457 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/ClimbDistanceFieldSubsystem.h"
+
+#include "ClimbingSystem.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Subsystems/ClimbSurfaceSubsystem.h"
+
+namespace ClimbDistanceField
+{
+	static TAutoConsoleVariable<bool> CVarEnable(
+		TEXT("climb.DistanceField.Enable"),
+		true,
+		TEXT("등반 표면 추종에 거리장을 사용할지 여부 (끄면 레벨 로드 시 빌드도 생략)"));
+
+	static TAutoConsoleVariable<float> CVarVoxelSize(
+		TEXT("climb.DistanceField.VoxelSize"),
+		10.f,
+		TEXT("등반 거리장 샘플 간격 (cm)"));
+
+	static TAutoConsoleVariable<float> CVarMaxDistance(
+		TEXT("climb.DistanceField.MaxDistance"),
+		80.f,
+		TEXT("등반 거리장이 저장하는 표면으로부터의 최대 거리 (cm). 등반 중인 캡슐 반지름보다 커야 함"));
+
+	static TAutoConsoleVariable<int32> CVarMaxBricksPerLevel(
+		TEXT("climb.DistanceField.MaxBricksPerLevel"),
+		16384,
+		TEXT("레벨 하나의 등반 거리장 브릭 상한 (브릭당 729 바이트)"));
+
+	struct FSource
+	{
+		const UBodySetup* BodySetup = nullptr;
+		FTransform Transform;
+		FBox Bounds;
+	};
+
+	/**
+	 * @brief 소스 하나의 단순 콜리전까지의 부호 있는 거리 (안쪽은 음수)
+	 *
+	 * 요소별 거리의 최솟값이므로 겹친 요소 안쪽 깊이는 근사지만, 표면 근처와 바깥은 정확하다.
+	 */
+	static float GetSignedDistanceToSource(const FSource& Source, const FVector& WorldLocation)
+	{
+		const FKAggregateGeom& AggGeom = Source.BodySetup->AggGeom;
+		const FVector Scale3D = Source.Transform.GetScale3D();
+		const FVector LocalLocation = Source.Transform.InverseTransformPositionNoScale(WorldLocation);
+
+		float MinDistance = TNumericLimits<float>::Max();
+
+		for (const FKBoxElem& BoxElem : AggGeom.BoxElems)
+		{
+			const FKBoxElem ScaledBox = BoxElem.GetFinalScaled(Scale3D, FTransform::Identity);
+			const FVector BoxLocation = ScaledBox.GetTransform().InverseTransformPositionNoScale(LocalLocation);
+			const FVector Excess = BoxLocation.GetAbs() - FVector(ScaledBox.X, ScaledBox.Y, ScaledBox.Z) * 0.5f;
+
+			const float OutsideDistance = Excess.ComponentMax(FVector::ZeroVector).Size();
+			const float InsideDistance = FMath::Min(Excess.GetMax(), 0.f);
+			MinDistance = FMath::Min(MinDistance, static_cast<float>(OutsideDistance + InsideDistance));
+		}
+
+		for (const FKSphereElem& SphereElem : AggGeom.SphereElems)
+		{
+			const FKSphereElem ScaledSphere = SphereElem.GetFinalScaled(Scale3D, FTransform::Identity);
+			MinDistance = FMath::Min(MinDistance, static_cast<float>(FVector::Dist(LocalLocation, ScaledSphere.Center) - ScaledSphere.Radius));
+		}
+
+		for (const FKSphylElem& SphylElem : AggGeom.SphylElems)
+		{
+			const FKSphylElem ScaledSphyl = SphylElem.GetFinalScaled(Scale3D, FTransform::Identity);
+			const FVector SphylLocation = ScaledSphyl.GetTransform().InverseTransformPositionNoScale(LocalLocation);
+			const float HalfLength = ScaledSphyl.Length * 0.5f;
+			const FVector AxisPoint(0.f, 0.f, FMath::Clamp(SphylLocation.Z, -HalfLength, HalfLength));
+			MinDistance = FMath::Min(MinDistance, static_cast<float>(FVector::Dist(SphylLocation, AxisPoint) - ScaledSphyl.Radius));
+		}
+
+		return MinDistance;
+	}
+
+	/** 브릭을 덮는 소스들 중 가장 가까운 표면까지의 부호 있는 거리 */
+	static float GetDistanceToSources(const TArray<FSource>& Sources, const TArray<int32>& SourceIndices, const FVector& Location)
+	{
+		float MinDistance = TNumericLimits<float>::Max();
+
+		for (const int32 SourceIndex : SourceIndices)
+		{
+			MinDistance = FMath::Min(MinDistance, GetSignedDistanceToSource(Sources[SourceIndex], Location));
+		}
+
+		return MinDistance;
+	}
+
+	struct FKeptBrick
+	{
+		FIntVector BrickCoord;
+		float MinAbsDistance = 0.f;
+		int32 SampleOffset = 0;
+	};
+
+	/**
+	 * @brief 소스 프리미티브 바운드에 걸치는 브릭을 병렬로 샘플링해 필드를 빌드 (워커 스레드)
+	 *
+	 * 브릭 중심이 표면에서 (브릭 반대각선 + MaxDistance) 보다 멀면 (안팎 모두) 샘플링 없이 건너뛰고,
+	 * 표면 띠를 지나지 않는 브릭 (전부 -MaxDistance 안쪽이거나 전부 MaxDistance 밖) 은 버린다.
+	 * 샘플은 브릭마다 스택 버퍼에 계산하고 남길 브릭만 모으므로 후보 수만큼 미리 할당하지 않는다.
+	 * 상한을 넘으면 표면에 가까운 브릭부터 남긴다.
+	 */
+	static void BuildField(const TArray<FSource>& Sources, int32 MaxBricks, FClimbDistanceField& Field, int32& OutNumDroppedBricks)
+	{
+		const float MaxDistance = Field.GetMaxDistance();
+		const float BrickSize = Field.GetBrickSize();
+
+		// 브릭별로 영향을 주는 소스 목록
+		TMap<FIntVector, TArray<int32>> BrickSources;
+
+		for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+		{
+			const FIntVector MinBrick = Field.GetBrickCoord(Sources[SourceIndex].Bounds.Min);
+			const FIntVector MaxBrick = Field.GetBrickCoord(Sources[SourceIndex].Bounds.Max);
+
+			for (int32 Z = MinBrick.Z; Z <= MaxBrick.Z; ++Z)
+			{
+				for (int32 Y = MinBrick.Y; Y <= MaxBrick.Y; ++Y)
+				{
+					for (int32 X = MinBrick.X; X <= MaxBrick.X; ++X)
+					{
+						BrickSources.FindOrAdd(FIntVector(X, Y, Z)).Add(SourceIndex);
+					}
+				}
+			}
+		}
+
+		TArray<FIntVector> CandidateBricks;
+		BrickSources.GenerateKeyArray(CandidateBricks);
+
+		TArray<FKeptBrick> KeptBricks;
+		TArray<uint8> KeptSamples;
+		FCriticalSection KeptBricksLock;
+
+		const float BrickHalfDiagonal = BrickSize * 0.5f * UE_SQRT_3;
+
+		ParallelFor(CandidateBricks.Num(), [&](int32 CandidateIndex)
+		{
+			const FIntVector& BrickCoord = CandidateBricks[CandidateIndex];
+			const TArray<int32>& SourceIndices = BrickSources.FindChecked(BrickCoord);
+
+			const FVector BrickCenter = Field.GetSampleLocation(BrickCoord, 0, 0, 0) + FVector(BrickSize * 0.5f);
+			if (FMath::Abs(GetDistanceToSources(Sources, SourceIndices, BrickCenter)) > BrickHalfDiagonal + MaxDistance)
+			{
+				return;
+			}
+
+			uint8 BrickSamples[FClimbDistanceField::SamplesPerBrick];
+			float MinSampleDistance = TNumericLimits<float>::Max();
+			float MaxSampleDistance = -TNumericLimits<float>::Max();
+			float MinAbsSampleDistance = TNumericLimits<float>::Max();
+
+			for (int32 Z = 0; Z < FClimbDistanceField::BrickSamples; ++Z)
+			{
+				for (int32 Y = 0; Y < FClimbDistanceField::BrickSamples; ++Y)
+				{
+					for (int32 X = 0; X < FClimbDistanceField::BrickSamples; ++X)
+					{
+						const float Distance = GetDistanceToSources(Sources, SourceIndices, Field.GetSampleLocation(BrickCoord, X, Y, Z));
+						MinSampleDistance = FMath::Min(MinSampleDistance, Distance);
+						MaxSampleDistance = FMath::Max(MaxSampleDistance, Distance);
+						MinAbsSampleDistance = FMath::Min(MinAbsSampleDistance, FMath::Abs(Distance));
+						BrickSamples[FClimbDistanceField::GetSampleIndex(X, Y, Z)] = Field.QuantizeDistance(Distance);
+					}
+				}
+			}
+
+			if (MinSampleDistance >= MaxDistance || MaxSampleDistance <= -MaxDistance)
+			{
+				return;
+			}
+
+			FScopeLock Lock(&KeptBricksLock);
+			KeptBricks.Add({ BrickCoord, MinAbsSampleDistance, KeptSamples.Num() });
+			KeptSamples.Append(BrickSamples, FClimbDistanceField::SamplesPerBrick);
+		});
+
+		// 상한을 넘은 브릭은 필드에 없는 곳으로 남음 (사용하는 쪽이 스윕으로 대체)
+		if (KeptBricks.Num() > MaxBricks)
+		{
+			KeptBricks.Sort([](const FKeptBrick& A, const FKeptBrick& B) { return A.MinAbsDistance < B.MinAbsDistance; });
+			OutNumDroppedBricks = KeptBricks.Num() - MaxBricks;
+			KeptBricks.SetNum(MaxBricks);
+		}
+
+		for (const FKeptBrick& KeptBrick : KeptBricks)
+		{
+			Field.AddBrick(KeptBrick.BrickCoord, MakeArrayView(&KeptSamples[KeptBrick.SampleOffset], FClimbDistanceField::SamplesPerBrick));
+		}
+	}
+}
+
+void UClimbDistanceFieldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ClimbSurfaceSubsystem = Collection.InitializeDependency<UClimbSurfaceSubsystem>();
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ThisClass::OnLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ThisClass::OnLevelRemovedFromWorld);
+}
+
+void UClimbDistanceFieldSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	// 워커가 바디 셋업을 읽는 중이므로 끝날 때까지 기다림 (게시 콜백은 서브시스템이 없으면 무시됨)
+	UE::Tasks::Wait(InFlightBuilds);
+	InFlightBuilds.Reset();
+	InFlightBodySetups.Reset();
+	NumInFlightBuilds = 0;
+
+	LevelFields.Empty();
+	PendingBuildIds.Empty();
+
+	Super::Deinitialize();
+}
+
+void UClimbDistanceFieldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 시작 전에 이미 보이는 레벨들은 추가 델리게이트를 다시 받지 않음
+	for (ULevel* Level : InWorld.GetLevels())
+	{
+		if (Level && Level->bIsVisible)
+		{
+			BuildLevel(Level);
+		}
+	}
+}
+
+bool UClimbDistanceFieldSubsystem::SampleDistance(const FVector& WorldLocation, float& OutDistance, FVector& OutNormal) const
+{
+	if (!ClimbDistanceField::CVarEnable.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_ClimbDistanceFieldSamples);
+
+	bool bFound = false;
+	OutDistance = TNumericLimits<float>::Max();
+
+	// 스트리밍 레벨 경계에서는 여러 필드가 겹칠 수 있으므로 가장 가까운 쪽을 사용
+	for (const TPair<TObjectKey<ULevel>, FClimbDistanceField>& Pair : LevelFields)
+	{
+		float Distance;
+		FVector Gradient;
+
+		if (Pair.Value.Sample(WorldLocation, Distance, Gradient) && Distance < OutDistance && Distance < Pair.Value.GetMaxDistance())
+		{
+			const FVector Normal = Gradient.GetSafeNormal();
+			if (!Normal.IsZero())
+			{
+				OutDistance = Distance;
+				OutNormal = Normal;
+				bFound = true;
+			}
+		}
+	}
+
+	return bFound;
+}
+
+/**
+ * @brief 레벨의 소스 프리미티브를 모아 워커 스레드에서 필드를 빌드하고, 끝나면 게임 스레드에서 게시
+ *
+ * 스트리밍 중 게임 스레드가 멈추지 않도록 샘플링은 모두 백그라운드에서 하며, 그동안 사용하는 쪽은 스윕으로 대체한다.
+ */
+void UClimbDistanceFieldSubsystem::BuildLevel(ULevel* Level)
+{
+	if (!Level || !ClimbDistanceField::CVarEnable.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	// FClimbDistanceField::Reset 과 같은 보정
+	const float VoxelSize = FMath::Max(ClimbDistanceField::CVarVoxelSize.GetValueOnGameThread(), 1.f);
+	const float MaxDistance = FMath::Max(ClimbDistanceField::CVarMaxDistance.GetValueOnGameThread(), VoxelSize);
+	TArray<ClimbDistanceField::FSource> Sources;
+	int32 NumUnsupportedComponents = 0;
+
+	for (const AActor* Actor : Level->Actors)
+	{
+		if (!Actor)
+		{
+			continue;
+		}
+
+		Actor->ForEachComponent<UPrimitiveComponent>(false, [this, &Sources, &NumUnsupportedComponents, MaxDistance](UPrimitiveComponent* Component)
+		{
+			if (!IsDistanceFieldCandidate(Component))
+			{
+				return;
+			}
+
+			// 부호 있는 거리를 못 구하는 콜리전은 필드에서 빠지고 사용하는 쪽이 스윕으로 대체
+			if (!HasSupportedDistanceGeometry(Component))
+			{
+				UE_LOG(LogClimbingSystem, Verbose, TEXT("Climb distance field skipped %s: unsupported collision (convex / complex / landscape)"), *GetPathNameSafe(Component));
+				++NumUnsupportedComponents;
+				return;
+			}
+
+			ClimbDistanceField::FSource& Source = Sources.AddDefaulted_GetRef();
+			Source.BodySetup = Component->GetBodySetup();
+			Source.Transform = Component->GetComponentTransform();
+			Source.Bounds = Component->Bounds.GetBox().ExpandBy(MaxDistance);
+		});
+	}
+
+	if (NumUnsupportedComponents > 0)
+	{
+		UE_LOG(LogClimbingSystem, Warning, TEXT("Climb distance field for %s skipped %d climbable components with convex / complex / landscape collision"),
+			*GetNameSafe(Level->GetOuter()), NumUnsupportedComponents);
+	}
+
+	const uint32 BuildId = ++NextBuildId;
+	PendingBuildIds.Add(Level, BuildId);
+
+	// 워커가 읽는 동안 바디 셋업이 GC 되지 않도록 빌드가 끝날 때까지 붙잡아 둠
+	for (const ClimbDistanceField::FSource& Source : Sources)
+	{
+		InFlightBodySetups.AddUnique(const_cast<UBodySetup*>(Source.BodySetup));
+	}
+
+	++NumInFlightBuilds;
+
+	const int32 MaxBricks = ClimbDistanceField::CVarMaxBricksPerLevel.GetValueOnGameThread();
+	const TObjectKey<ULevel> LevelKey(Level);
+	const FString LevelName = GetNameSafe(Level->GetOuter());
+
+	InFlightBuilds.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[WeakThis = TWeakObjectPtr<ThisClass>(this), Sources = MoveTemp(Sources), LevelKey, LevelName, BuildId, VoxelSize, MaxDistance, MaxBricks]()
+		{
+			const double BuildStartTime = FPlatformTime::Seconds();
+
+			FClimbDistanceField Field;
+			Field.Reset(VoxelSize, MaxDistance);
+
+			int32 NumDroppedBricks = 0;
+			ClimbDistanceField::BuildField(Sources, MaxBricks, Field, NumDroppedBricks);
+
+			UE_LOG(LogClimbingSystem, Log, TEXT("Climb distance field built for %s: %d sources, %d bricks (%d dropped), %.1f KB (%.2f ms)"),
+				*LevelName, Sources.Num(), Field.GetNumBricks(), NumDroppedBricks,
+				Field.GetAllocatedSize() / 1024.f, (FPlatformTime::Seconds() - BuildStartTime) * 1000.0);
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, LevelKey, BuildId, Field = MoveTemp(Field)]() mutable
+			{
+				if (ThisClass* This = WeakThis.Get())
+				{
+					This->PublishLevelField(LevelKey, BuildId, MoveTemp(Field));
+				}
+			});
+		}));
+}
+
+void UClimbDistanceFieldSubsystem::PublishLevelField(TObjectKey<ULevel> LevelKey, uint32 BuildId, FClimbDistanceField&& Field)
+{
+	NumInFlightBuilds = FMath::Max(NumInFlightBuilds - 1, 0);
+	if (NumInFlightBuilds == 0)
+	{
+		InFlightBodySetups.Reset();
+		InFlightBuilds.Reset();
+	}
+
+	// 빌드 중에 레벨이 빠졌거나 다시 빌드가 시작됐으면 버림
+	const uint32* PendingBuildId = PendingBuildIds.Find(LevelKey);
+	if (!PendingBuildId || *PendingBuildId != BuildId)
+	{
+		return;
+	}
+
+	PendingBuildIds.Remove(LevelKey);
+
+	if (Field.GetNumBricks() > 0)
+	{
+		LevelFields.Add(LevelKey, MoveTemp(Field));
+	}
+	else
+	{
+		LevelFields.Remove(LevelKey);
+	}
+}
+
+void UClimbDistanceFieldSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	// 월드 시작 전에 추가된 레벨은 OnWorldBeginPlay 에서 빌드
+	if (World == GetWorld() && World->HasBegunPlay())
+	{
+		BuildLevel(Level);
+	}
+}
+
+void UClimbDistanceFieldSubsystem::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	// 레벨이 null 이면 월드의 모든 레벨이 빠짐
+	if (Level)
+	{
+		LevelFields.Remove(Level);
+		PendingBuildIds.Remove(Level);
+	}
+	else
+	{
+		LevelFields.Empty();
+		PendingBuildIds.Empty();
+	}
+}
+
+bool UClimbDistanceFieldSubsystem::IsDistanceFieldCandidate(const UPrimitiveComponent* Component) const
+{
+	if (!Component || !Component->IsRegistered() || Component->Mobility != EComponentMobility::Static
+		|| !Component->IsQueryCollisionEnabled() || Component->GetCollisionResponseToChannel(ECC_Climb) != ECR_Block)
+	{
+		return false;
+	}
+
+	return !ClimbSurfaceSubsystem || ClimbSurfaceSubsystem->GetComponentProperties(Component).bClimbable;
+}
+
+bool UClimbDistanceFieldSubsystem::HasSupportedDistanceGeometry(const UPrimitiveComponent* Component)
+{
+	if (Component->IsA<ULandscapeHeightfieldCollisionComponent>())
+	{
+		return false;
+	}
+
+	// 거리 계산은 박스 / 구 / 캡슐만 지원하므로 컨벡스 / 복합 콜리전이 섞인 프리미티브는 통째로 제외
+	const UBodySetup* BodySetup = const_cast<UPrimitiveComponent*>(Component)->GetBodySetup();
+	if (!BodySetup || BodySetup->GetCollisionTraceFlag() == CTF_UseComplexAsSimple
+		|| BodySetup->AggGeom.ConvexElems.Num() > 0 || BodySetup->AggGeom.TaperedCapsuleElems.Num() > 0
+		|| BodySetup->AggGeom.BoxElems.Num() + BodySetup->AggGeom.SphereElems.Num() + BodySetup->AggGeom.SphylElems.Num() == 0)
+	{
+		return false;
+	}
+
+	return true;
+}
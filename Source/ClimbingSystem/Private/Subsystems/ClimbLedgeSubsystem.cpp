@@ -0,0 +1,489 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/ClimbLedgeSubsystem.h"
+
+#include "ClimbingSystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
+#include "Misc/ScopeExit.h"
+#include "PhysicsEngine/BodySetup.h"
+
+namespace ClimbLedge
+{
+	static TAutoConsoleVariable<int32> CVarMaxTracesPerFrame(
+		TEXT("climb.Ledge.MaxTracesPerFrame"),
+		32,
+		TEXT("비동기 렛지 추출이 프레임당 보내는 샘플 트레이스 상한"));
+
+	/** 가장자리를 따라 막힘 / 윗면을 확인하는 간격 */
+	static constexpr float SampleSpacing = 25.f;
+
+	/** 가장자리에서 윗면 안쪽으로 들어간 샘플 위치 */
+	static constexpr float SampleInset = 5.f;
+
+	/** 샘플 위로 비어 있어야 하는 높이 (손을 올릴 공간) */
+	static constexpr float ClearanceHeight = 50.f;
+
+	/** 윗면 높이 허용 오차 */
+	static constexpr float TopTolerance = 5.f;
+
+	/** 이보다 짧은 렛지 조각은 버림 */
+	static constexpr float MinLedgeLength = 30.f;
+
+	/** 윗면 법선이 이 값 이상 위를 향해야 렛지 */
+	static constexpr float MinTopFaceUpDot = 0.7f;
+}
+
+void UClimbLedgeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (UWorld* World = GetWorld())
+	{
+		ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &ThisClass::OnActorDestroyed));
+	}
+
+	SampleTraceDelegate.BindUObject(this, &ThisClass::OnSampleTraceDone);
+}
+
+void UClimbLedgeSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+
+	SampleTraceDelegate.Unbind();
+
+	CachedLedges.Empty();
+	BuildQueue.Empty();
+	QueuedComponents.Empty();
+	ActiveBuild.Reset();
+
+	Super::Deinitialize();
+}
+
+void UClimbLedgeSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!ActiveBuild.IsSet())
+	{
+		StartNextQueuedBuild();
+	}
+
+	if (ActiveBuild.IsSet())
+	{
+		DispatchActiveBuildTraces();
+	}
+}
+
+TStatId UClimbLedgeSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UClimbLedgeSubsystem, STATGROUP_Tickables);
+}
+
+const FClimbLedgeSet* UClimbLedgeSubsystem::RequestLedges(const UPrimitiveComponent* Component, bool bUrgent)
+{
+	if (const FClimbLedgeSet* CachedLedgeSet = CachedLedges.Find(Component))
+	{
+		return CachedLedgeSet;
+	}
+
+	if (ActiveBuild.IsSet() && ActiveBuild->Component.Get() == Component)
+	{
+		return nullptr;
+	}
+
+	bool bAlreadyQueued = false;
+	QueuedComponents.Add(Component, &bAlreadyQueued);
+
+	if (bUrgent)
+	{
+		// EQS 가 쌓아 둔 요청보다 먼저 추출
+		if (bAlreadyQueued)
+		{
+			BuildQueue.Remove(Component);
+		}
+
+		BuildQueue.Insert(Component, 0);
+	}
+	else if (!bAlreadyQueued)
+	{
+		BuildQueue.Add(Component);
+	}
+
+	return nullptr;
+}
+
+const FClimbLedgeSet* UClimbLedgeSubsystem::FindCachedLedges(const UPrimitiveComponent* Component) const
+{
+	return CachedLedges.Find(Component);
+}
+
+bool UClimbLedgeSubsystem::FindClosestLedge(const UPrimitiveComponent* Component, const FVector& WorldLocation, float MaxDistance, FClimbLedgePolyline& OutLedge, float& OutDistance)
+{
+	if (!Component)
+	{
+		return false;
+	}
+
+	const FClimbLedgeSet* LedgeSet = RequestLedges(Component, true);
+	if (!LedgeSet)
+	{
+		return false;
+	}
+
+	const FVector LocalLocation = Component->GetComponentTransform().InverseTransformPositionNoScale(WorldLocation);
+
+	const FClimbLedgePolyline* BestLedge = nullptr;
+	float BestDistanceSquared = FMath::Square(MaxDistance);
+
+	for (const FClimbLedgePolyline& Ledge : LedgeSet->Ledges)
+	{
+		float DistanceSquared;
+		const float Distance = Ledge.FindClosestDistance(LocalLocation, DistanceSquared);
+
+		if (DistanceSquared < BestDistanceSquared)
+		{
+			BestDistanceSquared = DistanceSquared;
+			BestLedge = &Ledge;
+			OutDistance = Distance;
+		}
+	}
+
+	if (!BestLedge)
+	{
+		return false;
+	}
+
+	OutLedge = *BestLedge;
+	return true;
+}
+
+void UClimbLedgeSubsystem::GatherLedgeSamples(const UPrimitiveComponent* Component, FLedgeBuild& OutBuild) const
+{
+	OutBuild.Component = Component;
+
+	// 하이트필드는 가장자리가 없음
+	if (!Component || Component->IsA<ULandscapeHeightfieldCollisionComponent>())
+	{
+		return;
+	}
+
+	OutBuild.ComponentTransform = Component->GetComponentTransform();
+
+	// 단순 콜리전 박스가 있으면 그대로 사용 (UClimbProxyBoxComponent 포함), 없으면 로컬 바운드로 근사
+	const UBodySetup* BodySetup = const_cast<UPrimitiveComponent*>(Component)->GetBodySetup();
+	if (BodySetup && BodySetup->AggGeom.BoxElems.Num() > 0)
+	{
+		for (const FKBoxElem& BoxElem : BodySetup->AggGeom.BoxElems)
+		{
+			AddBoxSamples(BoxElem.GetTransform(), FVector(BoxElem.X, BoxElem.Y, BoxElem.Z) * 0.5f, OutBuild);
+		}
+	}
+	else
+	{
+		const FBox LocalBounds = Component->CalcBounds(FTransform::Identity).GetBox();
+		AddBoxSamples(FTransform(LocalBounds.GetCenter()), LocalBounds.GetExtent(), OutBuild);
+	}
+}
+
+/**
+ * @brief 박스의 가장 위를 향한 면 테두리를 루프로 돌며 샘플과 그 위를 확인할 트레이스를 만듦
+ *
+ * 위를 향한 면이 없으면 샘플 없이 빈 박스 구간만 추가한다.
+ */
+void UClimbLedgeSubsystem::AddBoxSamples(const FTransform& BoxToComponent, const FVector& BoxExtent, FLedgeBuild& OutBuild)
+{
+	const FTransform BoxToWorld = BoxToComponent * OutBuild.ComponentTransform;
+
+	ON_SCOPE_EXIT
+	{
+		OutBuild.BoxSampleEnds.Add(OutBuild.Samples.Num());
+	};
+
+	// 월드에서 가장 위를 향한 면 찾기
+	int32 TopAxis = INDEX_NONE;
+	float TopSign = 1.f;
+	float BestUpDot = ClimbLedge::MinTopFaceUpDot;
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		for (const float Sign : { 1.f, -1.f })
+		{
+			FVector LocalNormal = FVector::ZeroVector;
+			LocalNormal[Axis] = Sign;
+
+			const float UpDot = BoxToWorld.TransformVectorNoScale(LocalNormal).Z;
+			if (UpDot > BestUpDot)
+			{
+				BestUpDot = UpDot;
+				TopAxis = Axis;
+				TopSign = Sign;
+			}
+		}
+	}
+
+	if (TopAxis == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 AxisB = (TopAxis + 1) % 3;
+	const int32 AxisC = (TopAxis + 2) % 3;
+
+	auto MakeCorner = [&](float SignB, float SignC)
+	{
+		FVector LocalCorner;
+		LocalCorner[TopAxis] = TopSign * BoxExtent[TopAxis];
+		LocalCorner[AxisB] = SignB * BoxExtent[AxisB];
+		LocalCorner[AxisC] = SignC * BoxExtent[AxisC];
+		return BoxToWorld.TransformPosition(LocalCorner);
+	};
+
+	const FVector Corners[4] = { MakeCorner(1.f, 1.f), MakeCorner(-1.f, 1.f), MakeCorner(-1.f, -1.f), MakeCorner(1.f, -1.f) };
+	const FVector TopCenter = (Corners[0] + Corners[1] + Corners[2] + Corners[3]) * 0.25f;
+	FVector TopNormal = FVector::CrossProduct(Corners[1] - Corners[0], Corners[3] - Corners[0]).GetSafeNormal();
+	if (TopNormal.Z < 0.f)
+	{
+		TopNormal = -TopNormal;
+	}
+
+	// 테두리 샘플 (각 변의 시작 꼭짓점 포함)
+	for (int32 EdgeIndex = 0; EdgeIndex < 4; ++EdgeIndex)
+	{
+		const FVector& Start = Corners[EdgeIndex];
+		const FVector& End = Corners[(EdgeIndex + 1) % 4];
+		const FVector EdgeDirection = (End - Start).GetSafeNormal();
+		const FVector ToEdge = (Start + End) * 0.5f - TopCenter;
+		const FVector OutwardNormal = FVector::VectorPlaneProject(ToEdge - EdgeDirection * FVector::DotProduct(ToEdge, EdgeDirection), TopNormal).GetSafeNormal();
+
+		const int32 NumSamples = FMath::Max(1, FMath::CeilToInt(FVector::Dist(Start, End) / ClimbLedge::SampleSpacing));
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			FLedgeSample& Sample = OutBuild.Samples.AddDefaulted_GetRef();
+			Sample.Location = FMath::Lerp(Start, End, static_cast<float>(SampleIndex) / NumSamples);
+			Sample.Normal = OutwardNormal;
+			Sample.UpDirection = TopNormal;
+			Sample.bCorner = SampleIndex == 0;
+
+			const FVector InsetLocation = Sample.Location - OutwardNormal * ClimbLedge::SampleInset;
+			Sample.TraceStart = InsetLocation + TopNormal * ClimbLedge::ClearanceHeight;
+			Sample.TraceEnd = InsetLocation - TopNormal * ClimbLedge::TopTolerance;
+		}
+	}
+}
+
+FClimbLedgeSet UClimbLedgeSubsystem::AssembleLedges(const FLedgeBuild& Build)
+{
+	FClimbLedgeSet LedgeSet;
+	int32 BoxStart = 0;
+
+	for (const int32 BoxEnd : Build.BoxSampleEnds)
+	{
+		if (BoxEnd > BoxStart)
+		{
+			AddBoxLedges(MakeArrayView(Build.Samples).Slice(BoxStart, BoxEnd - BoxStart), Build.ComponentTransform, LedgeSet);
+		}
+
+		BoxStart = BoxEnd;
+	}
+
+	return LedgeSet;
+}
+
+/**
+ * @brief 박스 윗면 테두리 샘플을 루프로 돌며 막힌 샘플에서 끊어 렛지 폴리라인을 만듦
+ *
+ * 모든 샘플이 비어 있으면 네 꼭짓점의 닫힌 루프, 아니면 막힌 구간 사이의 열린 폴리라인들이 된다.
+ */
+void UClimbLedgeSubsystem::AddBoxLedges(TConstArrayView<FLedgeSample> Samples, const FTransform& ComponentTransform, FClimbLedgeSet& OutLedgeSet)
+{
+	auto AddPoint = [&ComponentTransform](FClimbLedgePolyline& Ledge, const FLedgeSample& Sample)
+	{
+		Ledge.Points.Add(ComponentTransform.InverseTransformPositionNoScale(Sample.Location));
+		Ledge.SegmentNormals.Add(ComponentTransform.InverseTransformVectorNoScale(Sample.Normal));
+	};
+
+	const int32 FirstBlocked = Samples.IndexOfByPredicate([](const FLedgeSample& Sample) { return !Sample.bClear; });
+
+	if (FirstBlocked == INDEX_NONE)
+	{
+		FClimbLedgePolyline& Loop = OutLedgeSet.Ledges.AddDefaulted_GetRef();
+		Loop.bClosedLoop = true;
+
+		for (const FLedgeSample& Sample : Samples)
+		{
+			if (Sample.bCorner)
+			{
+				AddPoint(Loop, Sample);
+			}
+		}
+
+		Loop.Finalize();
+		return;
+	}
+
+	// 막힌 샘플부터 한 바퀴 돌며 비어 있는 구간마다 열린 폴리라인 생성 (꼭짓점과 구간 양 끝만 남김)
+	FClimbLedgePolyline Current;
+
+	auto FlushCurrent = [&]()
+	{
+		if (Current.Points.Num() >= 2)
+		{
+			// 마지막 점의 법선은 세그먼트에 쓰이지 않음
+			Current.SegmentNormals.Pop();
+			Current.Finalize();
+
+			if (Current.GetLength() >= ClimbLedge::MinLedgeLength)
+			{
+				OutLedgeSet.Ledges.Add(MoveTemp(Current));
+			}
+		}
+
+		Current = FClimbLedgePolyline();
+	};
+
+	for (int32 Offset = 1; Offset <= Samples.Num(); ++Offset)
+	{
+		const int32 SampleIndex = (FirstBlocked + Offset) % Samples.Num();
+		const FLedgeSample& Sample = Samples[SampleIndex];
+
+		if (!Sample.bClear)
+		{
+			FlushCurrent();
+			continue;
+		}
+
+		const FLedgeSample& NextSample = Samples[(SampleIndex + 1) % Samples.Num()];
+		const bool bRunStart = Current.Points.IsEmpty();
+		const bool bRunEnd = !NextSample.bClear;
+
+		if (bRunStart || bRunEnd || Sample.bCorner)
+		{
+			AddPoint(Current, Sample);
+		}
+	}
+
+	FlushCurrent();
+}
+
+bool UClimbLedgeSubsystem::IsLedgeSampleClear(const UPrimitiveComponent* Component, TConstArrayView<FHitResult> Hits, const FVector& UpDirection)
+{
+	for (const FHitResult& Hit : Hits)
+	{
+		const UPrimitiveComponent* HitComponent = Hit.GetComponent();
+		if (!HitComponent || (HitComponent != Component && HitComponent->Mobility != EComponentMobility::Static))
+		{
+			continue;
+		}
+
+		// 먼저 맞은 정적 물체가 이 컴포넌트의 윗면이어야 함 (다른 물체가 올라가 있으면 틈)
+		return HitComponent == Component && !Hit.bStartPenetrating && FVector::DotProduct(Hit.Normal, UpDirection) >= ClimbLedge::MinTopFaceUpDot;
+	}
+
+	// 윗면이 박스 높이에 없음 (바운드로 근사한 메시의 윗면이 더 낮은 경우 등) → 틈
+	return false;
+}
+
+void UClimbLedgeSubsystem::StartNextQueuedBuild()
+{
+	while (!BuildQueue.IsEmpty())
+	{
+		const TWeakObjectPtr<const UPrimitiveComponent> Component = BuildQueue[0];
+		BuildQueue.RemoveAt(0, EAllowShrinking::No);
+
+		// 큐에 있는 동안 파괴됐거나 이미 추출된 프리미티브는 건너뜀
+		if (!Component.IsValid())
+		{
+			continue;
+		}
+
+		QueuedComponents.Remove(Component.Get());
+
+		if (CachedLedges.Contains(Component.Get()))
+		{
+			continue;
+		}
+
+		FLedgeBuild& Build = ActiveBuild.Emplace();
+		GatherLedgeSamples(Component.Get(), Build);
+
+		if (Build.Samples.IsEmpty())
+		{
+			CachedLedges.Add(Component.Get(), AssembleLedges(Build));
+			ActiveBuild.Reset();
+			continue;
+		}
+
+		return;
+	}
+}
+
+void UClimbLedgeSubsystem::DispatchActiveBuildTraces()
+{
+	FLedgeBuild& Build = ActiveBuild.GetValue();
+	const int32 NumToDispatch = FMath::Min(Build.Samples.Num() - Build.NumDispatched, ClimbLedge::CVarMaxTracesPerFrame.GetValueOnGameThread());
+
+	// 모든 히트를 거리순으로 받아 캐릭터 / 물리 소품처럼 잠깐 올라가 있는 물체는 건너뜀 (캐시에 그대로 남으므로)
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbLedgeExtract), false);
+
+	for (int32 Count = 0; Count < NumToDispatch; ++Count)
+	{
+		const int32 SampleIndex = Build.NumDispatched++;
+		const FLedgeSample& Sample = Build.Samples[SampleIndex];
+
+		INC_DWORD_STAT(STAT_ClimbSceneQueries);
+		++ClimbStats::NumSceneQueries;
+
+		GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Multi, Sample.TraceStart, Sample.TraceEnd, ECC_Climb,
+			QueryParams, FCollisionResponseParams(ECR_Overlap), &SampleTraceDelegate, SampleIndex);
+	}
+}
+
+void UClimbLedgeSubsystem::OnSampleTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	if (!ActiveBuild.IsSet())
+	{
+		return;
+	}
+
+	FLedgeBuild& Build = ActiveBuild.GetValue();
+	const int32 SampleIndex = static_cast<int32>(TraceDatum.UserData);
+
+	if (!Build.Samples.IsValidIndex(SampleIndex))
+	{
+		return;
+	}
+
+	Build.Samples[SampleIndex].bClear = IsLedgeSampleClear(Build.Component.Get(), TraceDatum.OutHits, Build.Samples[SampleIndex].UpDirection);
+
+	if (++Build.NumCompleted < Build.Samples.Num())
+	{
+		return;
+	}
+
+	// 추출 중 파괴된 프리미티브는 결과를 버림
+	if (const UPrimitiveComponent* Component = Build.Component.Get())
+	{
+		CachedLedges.Add(Component, AssembleLedges(Build));
+	}
+
+	ActiveBuild.Reset();
+}
+
+void UClimbLedgeSubsystem::OnActorDestroyed(AActor* DestroyedActor)
+{
+	if (!DestroyedActor)
+	{
+		return;
+	}
+
+	DestroyedActor->ForEachComponent<UPrimitiveComponent>(false, [this](UPrimitiveComponent* Component)
+	{
+		CachedLedges.Remove(Component);
+		QueuedComponents.Remove(Component);
+	});
+}
@@ -0,0 +1,327 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/ClimbQueryCacheSubsystem.h"
+
+#include "ClimbingSystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "Misc/Crc.h"
+
+namespace ClimbQueryCache
+{
+	static TAutoConsoleVariable<bool> CVarEnable(
+		TEXT("climb.QueryCache.Enable"),
+		true,
+		TEXT("캐릭터 간 등반 씬 쿼리 캐시 사용 여부"));
+
+	static TAutoConsoleVariable<float> CVarQuantizationSize(
+		TEXT("climb.QueryCache.QuantizationSize"),
+		1.f,
+		TEXT("쿼리 원점 / 끝점 / 형태를 같은 키로 묶는 격자 크기 (cm)"));
+
+	static TAutoConsoleVariable<float> CVarStaticLifetime(
+		TEXT("climb.QueryCache.StaticLifetime"),
+		0.25f,
+		TEXT("Static 지오메트리만 맞은 결과를 다음 프레임에서 재사용할 최대 시간 (초, 0 이면 프레임 내부만). 재사용할 때는 움직이는 물체만 다시 쿼리"));
+
+	/** 재사용한 Static 결과에 더할 움직이는 물체 (Stationary / Movable) 만의 쿼리 */
+	static FCollisionQueryParams MakeDynamicOnlyParams(const FCollisionQueryParams& QueryParams)
+	{
+		FCollisionQueryParams DynamicParams = QueryParams;
+		DynamicParams.MobilityType = EQueryMobilityType::Dynamic;
+		return DynamicParams;
+	}
+
+	static FIntVector Quantize(const FVector& Value, float CellSize)
+	{
+		return FIntVector(
+			FMath::RoundToInt32(Value.X / CellSize),
+			FMath::RoundToInt32(Value.Y / CellSize),
+			FMath::RoundToInt32(Value.Z / CellSize));
+	}
+}
+
+void UClimbQueryCacheSubsystem::Deinitialize()
+{
+	FlushCache();
+
+	Super::Deinitialize();
+}
+
+bool UClimbQueryCacheSubsystem::LineTraceSingle(FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel TraceChannel, const FCollisionQueryParams& QueryParams)
+{
+	const bool bUseCache = ClimbQueryCache::CVarEnable.GetValueOnGameThread();
+	FClimbQueryKey Key;
+
+	if (bUseCache)
+	{
+		PurgeStaleEntries();
+
+		Key = MakeKey(EClimbQueryKind::LineSingle, Start, End, FQuat::Identity, TraceChannel, FCollisionShape(), QueryParams, nullptr);
+
+		bool bNeedsDynamicQuery;
+		if (const FClimbQueryEntry* Entry = FindReusableEntry(Key, bNeedsDynamicQuery))
+		{
+			INC_DWORD_STAT(STAT_ClimbQueryCacheHits);
+			++ClimbStats::NumQueryCacheHits;
+
+			OutHit = Entry->Hits.IsEmpty() ? FHitResult(Start, End) : Entry->Hits[0];
+			OutHit.TraceStart = Start;
+			OutHit.TraceEnd = End;
+
+			// 이전 프레임 결과면 그 사이 끼어든 움직이는 물체가 Static 히트보다 가까운지 확인
+			if (bNeedsDynamicQuery)
+			{
+				INC_DWORD_STAT(STAT_ClimbSceneQueries);
+				++ClimbStats::NumSceneQueries;
+
+				FHitResult DynamicHit;
+				if (GetWorld()->LineTraceSingleByChannel(DynamicHit, Start, End, TraceChannel, ClimbQueryCache::MakeDynamicOnlyParams(QueryParams))
+					&& (!OutHit.bBlockingHit || DynamicHit.Time < OutHit.Time))
+				{
+					OutHit = DynamicHit;
+				}
+			}
+
+			return OutHit.bBlockingHit;
+		}
+	}
+
+	INC_DWORD_STAT(STAT_ClimbSceneQueries);
+	++ClimbStats::NumSceneQueries;
+
+	const bool bHit = GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, TraceChannel, QueryParams);
+
+	if (bUseCache)
+	{
+		TArray<FHitResult> Hits;
+		if (bHit)
+		{
+			Hits.Add(OutHit);
+		}
+
+		StoreEntry(Key, Hits);
+	}
+
+	return bHit;
+}
+
+bool UClimbQueryCacheSubsystem::SweepMulti(TArray<FHitResult>& OutHits, const FVector& Start, const FVector& End, const FQuat& Rotation, ECollisionChannel TraceChannel,
+	const FCollisionShape& CollisionShape, const FCollisionQueryParams& QueryParams, const FCollisionResponseParams& ResponseParams)
+{
+	const bool bUseCache = ClimbQueryCache::CVarEnable.GetValueOnGameThread();
+	FClimbQueryKey Key;
+
+	if (bUseCache)
+	{
+		PurgeStaleEntries();
+
+		Key = MakeKey(EClimbQueryKind::SweepMulti, Start, End, Rotation, TraceChannel, CollisionShape, QueryParams, &ResponseParams);
+
+		bool bNeedsDynamicQuery;
+		if (const FClimbQueryEntry* Entry = FindReusableEntry(Key, bNeedsDynamicQuery))
+		{
+			INC_DWORD_STAT(STAT_ClimbQueryCacheHits);
+			++ClimbStats::NumQueryCacheHits;
+
+			OutHits = Entry->Hits;
+			RetargetHits(OutHits, Start, End);
+
+			if (bNeedsDynamicQuery)
+			{
+				INC_DWORD_STAT(STAT_ClimbSceneQueries);
+				++ClimbStats::NumSceneQueries;
+
+				TArray<FHitResult> DynamicHits;
+				GetWorld()->SweepMultiByChannel(DynamicHits, Start, End, Rotation, TraceChannel, CollisionShape, ClimbQueryCache::MakeDynamicOnlyParams(QueryParams), ResponseParams);
+				MergeDynamicHits(OutHits, DynamicHits);
+			}
+
+			return OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+		}
+	}
+
+	INC_DWORD_STAT(STAT_ClimbSceneQueries);
+	++ClimbStats::NumSceneQueries;
+
+	const bool bBlockingHit = GetWorld()->SweepMultiByChannel(OutHits, Start, End, Rotation, TraceChannel, CollisionShape, QueryParams, ResponseParams);
+
+	if (bUseCache)
+	{
+		StoreEntry(Key, OutHits);
+	}
+
+	return bBlockingHit;
+}
+
+void UClimbQueryCacheSubsystem::FlushCache()
+{
+	Entries.Empty();
+}
+
+/**
+ * @brief 쿼리를 양자화된 캐시 키로 변환
+ *
+ * 무시 목록 / 응답 / 물리 머티리얼 반환 여부까지 키에 넣어, 같은 좌표라도 결과가 달라질 수 있는 쿼리는 섞이지 않게 한다.
+ */
+UClimbQueryCacheSubsystem::FClimbQueryKey UClimbQueryCacheSubsystem::MakeKey(EClimbQueryKind Kind, const FVector& Start, const FVector& End, const FQuat& Rotation, ECollisionChannel TraceChannel,
+	const FCollisionShape& CollisionShape, const FCollisionQueryParams& QueryParams, const FCollisionResponseParams* ResponseParams) const
+{
+	const float CellSize = FMath::Max(ClimbQueryCache::CVarQuantizationSize.GetValueOnGameThread(), UE_KINDA_SMALL_NUMBER);
+
+	FClimbQueryKey Key;
+	Key.Kind = Kind;
+	Key.TraceChannel = static_cast<uint8>(TraceChannel);
+	Key.Start = ClimbQueryCache::Quantize(Start, CellSize);
+	Key.End = ClimbQueryCache::Quantize(End, CellSize);
+	Key.ShapeExtent = ClimbQueryCache::Quantize(CollisionShape.GetExtent(), CellSize);
+	Key.RotationHash = Rotation.Equals(FQuat::Identity) ? 0 : GetTypeHash(ClimbQueryCache::Quantize(Rotation.Euler(), 1.f));
+
+	uint32 ParamsHash = (static_cast<uint32>(CollisionShape.ShapeType) << 4)
+		| (QueryParams.bTraceComplex ? 1u : 0u)
+		| (QueryParams.bReturnPhysicalMaterial ? 2u : 0u)
+		| (QueryParams.bReturnFaceIndex ? 4u : 0u);
+
+	for (const uint32 IgnoredComponentId : QueryParams.GetIgnoredComponents())
+	{
+		ParamsHash = HashCombine(ParamsHash, IgnoredComponentId);
+	}
+
+	for (const uint32 IgnoredActorId : QueryParams.GetIgnoredActors())
+	{
+		ParamsHash = HashCombine(ParamsHash, IgnoredActorId);
+	}
+
+	for (const uint32 IgnoredSourceId : QueryParams.GetIgnoredSourceObjects())
+	{
+		ParamsHash = HashCombine(ParamsHash, IgnoredSourceId);
+	}
+
+	if (ResponseParams)
+	{
+		ParamsHash = FCrc::MemCrc32(ResponseParams->CollisionResponse.EnumArray, sizeof(ResponseParams->CollisionResponse.EnumArray), ParamsHash);
+	}
+
+	Key.ParamsHash = ParamsHash;
+	return Key;
+}
+
+const UClimbQueryCacheSubsystem::FClimbQueryEntry* UClimbQueryCacheSubsystem::FindReusableEntry(const FClimbQueryKey& Key, bool& bOutNeedsDynamicQuery) const
+{
+	bOutNeedsDynamicQuery = false;
+
+	const FClimbQueryEntry* Entry = Entries.Find(Key);
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	if (Entry->FrameNumber == GFrameCounter)
+	{
+		return Entry;
+	}
+
+	if (!Entry->bStaticGeometry || GetWorld()->GetTimeSeconds() - Entry->Time > ClimbQueryCache::CVarStaticLifetime.GetValueOnGameThread())
+	{
+		return nullptr;
+	}
+
+	// 수명 내에 컴포넌트가 파괴 / 모빌리티 변경됐으면 재사용하지 않음
+	for (const FHitResult& Hit : Entry->Hits)
+	{
+		const UPrimitiveComponent* HitComponent = Hit.GetComponent();
+		if (!HitComponent || HitComponent->Mobility != EComponentMobility::Static)
+		{
+			return nullptr;
+		}
+	}
+
+	// Static 만 맞은 결과는 그 사이 움직이는 물체가 끼어들었을 수 있음
+	bOutNeedsDynamicQuery = true;
+	return Entry;
+}
+
+void UClimbQueryCacheSubsystem::StoreEntry(const FClimbQueryKey& Key, const TArray<FHitResult>& Hits)
+{
+	FClimbQueryEntry& Entry = Entries.FindOrAdd(Key);
+	Entry.Hits = Hits;
+	Entry.FrameNumber = GFrameCounter;
+	Entry.Time = GetWorld()->GetTimeSeconds();
+
+	// 빈 결과는 움직이는 물체가 비켜났을 가능성이 있으므로 프레임 내부에서만 재사용
+	Entry.bStaticGeometry = !Hits.IsEmpty() && !Hits.ContainsByPredicate([](const FHitResult& Hit)
+	{
+		const UPrimitiveComponent* HitComponent = Hit.GetComponent();
+		return !HitComponent || HitComponent->Mobility != EComponentMobility::Static;
+	});
+}
+
+void UClimbQueryCacheSubsystem::PurgeStaleEntries()
+{
+	if (LastPurgeFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	LastPurgeFrame = GFrameCounter;
+
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+	const float StaticLifetime = ClimbQueryCache::CVarStaticLifetime.GetValueOnGameThread();
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		const FClimbQueryEntry& Entry = It.Value();
+		if (!Entry.bStaticGeometry || CurrentTime - Entry.Time > StaticLifetime)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+/**
+ * @brief 재사용한 Static 히트에 움직이는 물체만의 쿼리 결과를 합침
+ *
+ * 멀티 쿼리 결과 형식 (시간순 겹침 히트, 가장 가까운 차단 히트가 마지막) 을 유지하도록
+ * 가장 가까운 차단 히트 뒤의 히트와 나머지 차단 히트는 버린다.
+ */
+void UClimbQueryCacheSubsystem::MergeDynamicHits(TArray<FHitResult>& InOutHits, const TArray<FHitResult>& DynamicHits)
+{
+	if (DynamicHits.IsEmpty())
+	{
+		return;
+	}
+
+	InOutHits.Append(DynamicHits);
+
+	const FHitResult* NearestBlockingHit = nullptr;
+	for (const FHitResult& Hit : InOutHits)
+	{
+		if (Hit.bBlockingHit && (!NearestBlockingHit || Hit.Time < NearestBlockingHit->Time))
+		{
+			NearestBlockingHit = &Hit;
+		}
+	}
+
+	if (NearestBlockingHit)
+	{
+		const FHitResult BlockingHit = *NearestBlockingHit;
+		InOutHits.RemoveAll([&BlockingHit](const FHitResult& Hit) { return Hit.bBlockingHit || Hit.Time > BlockingHit.Time; });
+		InOutHits.StableSort([](const FHitResult& A, const FHitResult& B) { return A.Time < B.Time; });
+		InOutHits.Add(BlockingHit);
+	}
+	else
+	{
+		InOutHits.StableSort([](const FHitResult& A, const FHitResult& B) { return A.Time < B.Time; });
+	}
+}
+
+/** 양자화 오차만큼 다른 호출자의 결과이므로 트레이스 구간만 호출자 기준으로 맞춤 */
+void UClimbQueryCacheSubsystem::RetargetHits(TArray<FHitResult>& InOutHits, const FVector& Start, const FVector& End)
+{
+	for (FHitResult& Hit : InOutHits)
+	{
+		Hit.TraceStart = Start;
+		Hit.TraceEnd = End;
+	}
+}
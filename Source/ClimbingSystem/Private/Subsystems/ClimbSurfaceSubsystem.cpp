@@ -0,0 +1,206 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/ClimbSurfaceSubsystem.h"
+
+#include "ClimbingSystem.h"
+#include "EngineUtils.h"
+#include "Climbing/ClimbableSurfaceInterface.h"
+#include "Climbing/ClimbableSurfaceUserData.h"
+#include "Climbing/ClimbPhysicalMaterial.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+
+const FClimbSurfaceProperties UClimbSurfaceSubsystem::DefaultSurfaceProperties;
+
+void UClimbSurfaceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (UWorld* World = GetWorld())
+	{
+		ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &ThisClass::OnActorSpawned));
+		ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &ThisClass::OnActorDestroyed));
+	}
+
+	ComponentDestroyPhysicsHandle = UActorComponent::GlobalDestroyPhysicsDelegate.AddUObject(this, &ThisClass::OnComponentDestroyPhysics);
+}
+
+void UClimbSurfaceSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+
+	UActorComponent::GlobalDestroyPhysicsDelegate.Remove(ComponentDestroyPhysicsHandle);
+
+	CachedComponentProperties.Empty();
+
+	Super::Deinitialize();
+}
+
+void UClimbSurfaceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 레벨에 배치된 액터들은 스폰 델리게이트를 거치지 않으므로 여기서 한 번에 등록
+	for (TActorIterator<AActor> It(&InWorld); It; ++It)
+	{
+		RegisterActor(*It);
+	}
+}
+
+void UClimbSurfaceSubsystem::RegisterActor(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	Actor->ForEachComponent<UPrimitiveComponent>(false, [this](const UPrimitiveComponent* Component)
+	{
+		if (Component->IsQueryCollisionEnabled())
+		{
+			RegisterComponent(Component);
+		}
+	});
+}
+
+void UClimbSurfaceSubsystem::UnregisterActor(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	Actor->ForEachComponent<UPrimitiveComponent>(false, [this](UPrimitiveComponent* Component)
+	{
+		CachedComponentProperties.Remove(Component);
+	});
+}
+
+const FClimbSurfaceProperties& UClimbSurfaceSubsystem::GetSurfaceProperties(const FHitResult& Hit)
+{
+	// 피지컬 머티리얼 설정이 컴포넌트 설정보다 우선
+	if (const UClimbPhysicalMaterial* ClimbPhysicalMaterial = Cast<UClimbPhysicalMaterial>(Hit.PhysMaterial.Get()))
+	{
+		return ClimbPhysicalMaterial->ClimbProperties;
+	}
+
+	return GetComponentProperties(Hit.GetComponent());
+}
+
+const FClimbSurfaceProperties& UClimbSurfaceSubsystem::GetComponentProperties(const UPrimitiveComponent* Component)
+{
+	if (!Component)
+	{
+		return DefaultSurfaceProperties;
+	}
+
+	if (const FClimbSurfaceProperties* CachedProperties = CachedComponentProperties.Find(Component))
+	{
+		return *CachedProperties;
+	}
+
+	// 등록 이후 런타임에 추가된 컴포넌트는 첫 히트 시점에 캐싱
+	return RegisterComponent(Component);
+}
+
+void UClimbSurfaceSubsystem::ForEachRegisteredComponent(TFunctionRef<void(const UPrimitiveComponent*, const FClimbSurfaceProperties&)> Func) const
+{
+	for (const TPair<TObjectKey<UPrimitiveComponent>, FClimbSurfaceProperties>& Pair : CachedComponentProperties)
+	{
+		if (const UPrimitiveComponent* Component = Pair.Key.ResolveObjectPtr())
+		{
+			Func(Component, Pair.Value);
+		}
+	}
+}
+
+void UClimbSurfaceSubsystem::FilterClimbableHits(TArray<FHitResult>& InOutHits)
+{
+	InOutHits.RemoveAll([this](const FHitResult& Hit)
+	{
+		return !GetSurfaceProperties(Hit).bClimbable;
+	});
+}
+
+/**
+ * @brief 컴포넌트의 등반 속성을 해석해 캐싱
+ *
+ * 등반 불가 컴포넌트는 Climb 채널을 무시하도록 바꿔 등반 쿼리 단계에서 빠지게 합니다.
+ */
+const FClimbSurfaceProperties& UClimbSurfaceSubsystem::RegisterComponent(const UPrimitiveComponent* Component)
+{
+	const FClimbSurfaceProperties& Properties = CachedComponentProperties.Add(Component, ResolveComponentProperties(Component));
+
+	if (!Properties.bClimbable && Component->GetCollisionResponseToChannel(ECC_Climb) != ECR_Ignore)
+	{
+		const_cast<UPrimitiveComponent*>(Component)->SetCollisionResponseToChannel(ECC_Climb, ECR_Ignore);
+	}
+
+	return Properties;
+}
+
+/**
+ * @brief 컴포넌트의 등반 속성을 해석
+ *
+ * 우선순위: 컴포넌트 AssetUserData → 스태틱 메시 AssetUserData → 오너 액터의 IClimbableSurfaceInterface → 기본값
+ */
+FClimbSurfaceProperties UClimbSurfaceSubsystem::ResolveComponentProperties(const UPrimitiveComponent* Component)
+{
+	UPrimitiveComponent* MutableComponent = const_cast<UPrimitiveComponent*>(Component);
+
+	if (const UClimbableSurfaceUserData* ComponentUserData = MutableComponent->GetAssetUserData<UClimbableSurfaceUserData>())
+	{
+		return ComponentUserData->Properties;
+	}
+
+	if (const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component))
+	{
+		if (UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh())
+		{
+			if (const UClimbableSurfaceUserData* MeshUserData = StaticMesh->GetAssetUserData<UClimbableSurfaceUserData>())
+			{
+				return MeshUserData->Properties;
+			}
+		}
+	}
+
+	AActor* Owner = Component->GetOwner();
+	if (Owner && Owner->Implements<UClimbableSurfaceInterface>())
+	{
+		FClimbSurfaceProperties InterfaceProperties;
+		if (IClimbableSurfaceInterface::Execute_GetClimbSurfaceProperties(Owner, Component, InterfaceProperties))
+		{
+			return InterfaceProperties;
+		}
+	}
+
+	return DefaultSurfaceProperties;
+}
+
+void UClimbSurfaceSubsystem::OnActorSpawned(AActor* SpawnedActor)
+{
+	RegisterActor(SpawnedActor);
+}
+
+void UClimbSurfaceSubsystem::OnActorDestroyed(AActor* DestroyedActor)
+{
+	UnregisterActor(DestroyedActor);
+}
+
+void UClimbSurfaceSubsystem::OnComponentDestroyPhysics(UActorComponent* Component)
+{
+	// 액터는 남고 컴포넌트만 DestroyComponent 된 경우 (액터 파괴는 OnActorDestroyed 가 처리)
+	if (Component && Component->IsBeingDestroyed() && Component->GetWorld() == GetWorld())
+	{
+		if (const UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
+		{
+			CachedComponentProperties.Remove(PrimitiveComponent);
+		}
+	}
+}
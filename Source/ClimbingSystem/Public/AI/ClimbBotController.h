@@ -0,0 +1,64 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "ClimbBotController.generated.h"
+
+class UCustomMovementComponent;
+struct FClimbProbeSnapshot;
+
+/**
+ * 벤치마크용 봇 컨트롤러
+ * 프로브 스냅샷을 보고 배회 / 등반 / 홉 / 볼팅 / 탑아웃을 무작위로 반복한다.
+ * 같은 시드면 같은 선택을 하므로 서버 용량 측정을 반복할 수 있다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API AClimbBotController : public AAIController
+{
+	GENERATED_BODY()
+
+public:
+	AClimbBotController();
+
+	void InitializeBot(int32 Seed);
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	bool IsBotClimbing() const;
+
+protected:
+	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
+
+	/** 이번 틱에 행동을 고를 수 있는지 (기본: 동작 재생 / 낙하 중에는 대기) */
+	virtual bool CanChooseAction() const;
+
+	virtual void ChooseGroundAction(const FClimbProbeSnapshot& Snapshot);
+	virtual void ChooseClimbAction(const FClimbProbeSnapshot& Snapshot);
+	void ApplyMoveInput() const;
+
+	UPROPERTY()
+	TObjectPtr<UCustomMovementComponent> CustomMovementComponent;
+
+	FRandomStream RandomStream;
+
+	/** 지상: 월드 XY 방향, 등반 중: (오른쪽, 위) 표면 기준 방향 */
+	FVector2D MoveInput = FVector2D::ZeroVector;
+
+	/** 다음 행동을 고르기까지의 시간 범위 (초) */
+	UPROPERTY(EditDefaultsOnly, Category = "Climbing Bot")
+	FVector2D DecisionInterval = FVector2D(0.5f, 2.f);
+
+private:
+	float DecisionTimeRemaining = 0.f;
+
+	/** 등반 중 홉 / 탑아웃 / 손 놓기를 시도할 확률 */
+	UPROPERTY(EditDefaultsOnly, Category = "Climbing Bot", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float ClimbActionChance = 0.4f;
+
+	/** 지상에서 등반 가능한 벽을 만났을 때 붙을 확률 */
+	UPROPERTY(EditDefaultsOnly, Category = "Climbing Bot", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float EnterClimbChance = 0.7f;
+};
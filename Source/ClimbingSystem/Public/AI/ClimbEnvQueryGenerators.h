@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataProviders/AIDataProvider.h"
+#include "EnvironmentQuery/EnvQueryGenerator.h"
+#include "ClimbEnvQueryGenerators.generated.h"
+
+/**
+ * 등반 경로 플래너 그래프의 노드 위치를 아이템으로 생성
+ * 월드 시작 시 구워 둔 그래프만 읽으며 트레이스하지 않는다.
+ */
+UCLASS(meta = (DisplayName = "Climb Route Nodes"))
+class CLIMBINGSYSTEM_API UEnvQueryGenerator_ClimbRouteNodes : public UEnvQueryGenerator
+{
+	GENERATED_BODY()
+
+public:
+	UEnvQueryGenerator_ClimbRouteNodes();
+
+	virtual void GenerateItems(FEnvQueryInstance& QueryInstance) const override;
+	virtual FText GetDescriptionTitle() const override;
+	virtual FText GetDescriptionDetails() const override;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, Category = "Generator")
+	TSubclassOf<UEnvQueryContext> GenerateAround;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Generator")
+	FAIDataProviderFloatValue SearchRadius;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Generator | Node Types")
+	bool bSurfacePatches = true;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Generator | Node Types")
+	bool bLedges = true;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Generator | Node Types")
+	bool bVaultPoints = true;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Generator | Node Types")
+	bool bGroundPoints = false;
+};
+
+/**
+ * 컨텍스트 주변 등반 가능 프리미티브의 렛지 폴리라인을 따라 가장자리 점을 생성
+ *
+ * 반경 안의 프리미티브는 오버랩 쿼리 한 번으로 찾고, 이미 추출된 렛지만 읽는다.
+ * 아직 추출되지 않은 프리미티브는 UClimbLedgeSubsystem 의 비동기 추출 큐에 넣고 다음 쿼리 실행부터 포함된다.
+ */
+UCLASS(meta = (DisplayName = "Climb Ledges"))
+class CLIMBINGSYSTEM_API UEnvQueryGenerator_ClimbLedges : public UEnvQueryGenerator
+{
+	GENERATED_BODY()
+
+public:
+	UEnvQueryGenerator_ClimbLedges();
+
+	virtual void GenerateItems(FEnvQueryInstance& QueryInstance) const override;
+	virtual FText GetDescriptionTitle() const override;
+	virtual FText GetDescriptionDetails() const override;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, Category = "Generator")
+	TSubclassOf<UEnvQueryContext> GenerateAround;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Generator")
+	FAIDataProviderFloatValue SearchRadius;
+
+	/** 폴리라인을 따라 아이템을 놓는 간격 */
+	UPROPERTY(EditDefaultsOnly, Category = "Generator")
+	FAIDataProviderFloatValue SampleSpacing;
+
+	/** 가장자리 점을 바깥(벽 법선) 방향으로 미는 거리 */
+	UPROPERTY(EditDefaultsOnly, Category = "Generator")
+	float OutwardOffset = 0.f;
+};
@@ -0,0 +1,167 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Climbing/ClimbRules.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "ClimbEnvQuerySubsystem.generated.h"
+
+class UClimbRoutePlannerSubsystem;
+class UClimbSurfaceSubsystem;
+
+/** EQS 테스트가 판정하는 등반 규칙 */
+UENUM(BlueprintType)
+enum class EClimbEnvQueryRule : uint8
+{
+	StartClimbing,
+	TopOut,
+	ClimbDownLedge,
+	Vault
+};
+
+enum class EClimbEnvQueryVerdict : uint8
+{
+	Pass,
+	Fail,
+	/** 필요한 트레이스가 비동기로 진행 중 (다음 쿼리 실행에서 결과가 나옴) */
+	Pending
+};
+
+/** 트레이스 캐시 키: 양자화한 시작 / 끝 위치와 트레이스 모양 */
+struct FClimbEnvQueryTraceKey
+{
+	FIntVector Start = FIntVector::ZeroValue;
+	FIntVector End = FIntVector::ZeroValue;
+	uint8 TraceChannel = 0;
+	int32 CapsuleRadius = 0;
+	int32 CapsuleHalfHeight = 0;
+	bool bCapsule = false;
+
+	bool operator==(const FClimbEnvQueryTraceKey& Other) const = default;
+
+	friend uint32 GetTypeHash(const FClimbEnvQueryTraceKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Key.Start), GetTypeHash(Key.End));
+		Hash = HashCombine(Hash, GetTypeHash(Key.TraceChannel));
+		Hash = HashCombine(Hash, GetTypeHash(Key.CapsuleRadius));
+		Hash = HashCombine(Hash, GetTypeHash(Key.CapsuleHalfHeight));
+		return HashCombine(Hash, GetTypeHash(Key.bCapsule));
+	}
+};
+
+/** 판정 캐시 키: 규칙, 양자화한 캡슐 위치 / 요, 반올림한 규칙 설정 */
+struct FClimbEnvQueryVerdictKey
+{
+	EClimbEnvQueryRule Rule = EClimbEnvQueryRule::StartClimbing;
+	FIntVector Location = FIntVector::ZeroValue;
+	int32 YawBucket = 0;
+	uint8 TraceChannel = 0;
+	int32 CapsuleRadius = 0;
+	int32 CapsuleHalfHeight = 0;
+	int32 EyeHeight = 0;
+	int32 ClimbDownWalkableSurfaceTraceOffset = 0;
+	int32 ClimbDownLedgeTraceOffset = 0;
+	int32 MaxClimbableSurfaceAngle = 0;
+	int32 VaultTraceSteps = 0;
+	int32 VaultLandTraceIndex = 0;
+
+	bool operator==(const FClimbEnvQueryVerdictKey& Other) const = default;
+
+	friend uint32 GetTypeHash(const FClimbEnvQueryVerdictKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(static_cast<uint8>(Key.Rule)), GetTypeHash(Key.Location));
+		Hash = HashCombine(Hash, GetTypeHash(Key.YawBucket));
+		Hash = HashCombine(Hash, GetTypeHash(Key.TraceChannel));
+		Hash = HashCombine(Hash, GetTypeHash(Key.CapsuleRadius));
+		Hash = HashCombine(Hash, GetTypeHash(Key.CapsuleHalfHeight));
+		Hash = HashCombine(Hash, GetTypeHash(Key.EyeHeight));
+		Hash = HashCombine(Hash, GetTypeHash(Key.ClimbDownWalkableSurfaceTraceOffset));
+		Hash = HashCombine(Hash, GetTypeHash(Key.ClimbDownLedgeTraceOffset));
+		Hash = HashCombine(Hash, GetTypeHash(Key.MaxClimbableSurfaceAngle));
+		Hash = HashCombine(Hash, GetTypeHash(Key.VaultTraceSteps));
+		return HashCombine(Hash, GetTypeHash(Key.VaultLandTraceIndex));
+	}
+};
+
+/**
+ * EQS 용 등반 규칙 평가
+ *
+ * 구워 둔 경로 그래프 노드가 있으면 그 엣지로 바로 답하고, 없으면 ClimbRules 를 캐시된 트레이스 결과로 재생한다.
+ * 캐시에 없는 트레이스는 큐에 넣어 프레임당 상한만큼 비동기로 보내고 그동안은 Pending 을 반환하므로,
+ * 쿼리 아이템 수와 무관하게 프레임당 씬 쿼리 수가 제한된다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbEnvQuerySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @param ItemLocation 경로 그래프 노드와 맞춰 볼 아이템 위치
+	 * @param Pose 그래프 노드가 없을 때 규칙을 평가할 캡슐 위치 / 방향
+	 */
+	EClimbEnvQueryVerdict EvaluateRule(EClimbEnvQueryRule Rule, const FClimbRuleSettings& Settings, const FVector& ItemLocation, const FClimbProbePose& Pose, float RouteNodeMatchDistance);
+
+	/** 규칙 재생용: 캐시된 트레이스 결과 (등반 불가 필터 전) */
+	const TArray<FHitResult>* FindTraceResult(const FClimbEnvQueryTraceKey& TraceKey) const;
+
+	/** 규칙 재생용: 캐시에 없는 트레이스를 비동기 큐에 추가 (이미 대기 중이면 무시) */
+	void RequestTrace(const FClimbEnvQueryTraceKey& TraceKey, const FVector& Start, const FVector& End, const FClimbRuleSettings& Settings);
+
+	void FilterClimbableHits(TArray<FHitResult>& InOutHits);
+
+private:
+	bool EvaluateRuleFromRouteGraph(EClimbEnvQueryRule Rule, const FVector& ItemLocation, float RouteNodeMatchDistance, bool& bOutPass) const;
+
+	void DispatchQueuedTraces();
+	void OnTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void PurgeExpiredEntries();
+
+	struct FQueuedTrace
+	{
+		FClimbEnvQueryTraceKey TraceKey;
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		ECollisionChannel TraceChannel = ECC_Climb;
+		FCollisionShape Shape;
+	};
+
+	struct FCachedTrace
+	{
+		TArray<FHitResult> Hits;
+		double Time = 0.0;
+	};
+
+	struct FCachedVerdict
+	{
+		bool bPass = false;
+		double Time = 0.0;
+	};
+
+	UPROPERTY()
+	TObjectPtr<UClimbSurfaceSubsystem> ClimbSurfaceSubsystem;
+
+	UPROPERTY()
+	TObjectPtr<UClimbRoutePlannerSubsystem> ClimbRoutePlannerSubsystem;
+
+	TMap<FClimbEnvQueryTraceKey, FCachedTrace> TraceResults;
+	TMap<FClimbEnvQueryVerdictKey, FCachedVerdict> Verdicts;
+
+	/** 큐에 있거나 보낸 뒤 결과를 기다리는 트레이스 */
+	TSet<FClimbEnvQueryTraceKey> PendingTraceKeys;
+	TArray<FQueuedTrace> QueuedTraces;
+
+	/** 보낸 트레이스의 키 (비동기 트레이스 UserData 로 넘기는 일련번호 → 키) */
+	TMap<uint32, FClimbEnvQueryTraceKey> InFlightTraces;
+	uint32 NextTraceId = 0;
+
+	FTraceDelegate TraceDelegate;
+	double LastPurgeTime = 0.0;
+};
@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AI/ClimbEnvQuerySubsystem.h"
+#include "EnvironmentQuery/EnvQueryTest.h"
+#include "ClimbEnvQueryTests.generated.h"
+
+/**
+ * 아이템 위치에서 등반 규칙(등반 시작 / 탑아웃 / 렛지 내려가기 / 볼팅)이 성립하는지 거르는 테스트
+ *
+ * 구워 둔 경로 그래프 노드가 있으면 그 엣지로 답하고, 없으면 UClimbEnvQuerySubsystem 이 캐시된 비동기 트레이스로 판정한다.
+ * 트레이스 결과가 아직 없는 아이템은 이번 실행에서 Pending 으로 처리되고 이후 실행에서 확정된다.
+ */
+UCLASS(meta = (DisplayName = "Climb Rule"))
+class CLIMBINGSYSTEM_API UEnvQueryTest_ClimbRule : public UEnvQueryTest
+{
+	GENERATED_BODY()
+
+public:
+	UEnvQueryTest_ClimbRule();
+
+	virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+	virtual FText GetDescriptionTitle() const override;
+	virtual FText GetDescriptionDetails() const override;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, Category = "Climb")
+	EClimbEnvQueryRule Rule = EClimbEnvQueryRule::StartClimbing;
+
+	/** 그래프 노드가 없을 때 이 컨텍스트에서 아이템을 바라보는 방향으로 규칙을 평가 */
+	UPROPERTY(EditDefaultsOnly, Category = "Climb")
+	TSubclassOf<UEnvQueryContext> FacingContext;
+
+	/** 아이템(바닥 / 가장자리 점) 에서 캡슐 중심까지의 높이 */
+	UPROPERTY(EditDefaultsOnly, Category = "Climb")
+	float ProbeHeightOffset = 96.f;
+
+	/** 이 거리 안에 경로 그래프 노드가 있으면 트레이스 없이 그래프로 판정 (0 이면 사용 안 함) */
+	UPROPERTY(EditDefaultsOnly, Category = "Climb")
+	float RouteNodeMatchDistance = 30.f;
+
+	/** 트레이스 결과를 기다리는 아이템을 통과시킬지 */
+	UPROPERTY(EditDefaultsOnly, Category = "Climb")
+	bool bPendingItemsPass = false;
+};
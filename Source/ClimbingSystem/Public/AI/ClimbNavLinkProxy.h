@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Navigation/NavLinkProxy.h"
+#include "ClimbNavLinkProxy.generated.h"
+
+/**
+ * 등반 경로 그래프가 생성하는 스마트 내비 링크
+ * 경로 추종 중인 AI 가 링크에 도달하면 UCustomMovementComponent 에 등반 경로를 넘기고,
+ * 등반이 끝나면 일반 경로 추종을 재개한다.
+ */
+UCLASS(NotPlaceable)
+class CLIMBINGSYSTEM_API AClimbNavLinkProxy : public ANavLinkProxy
+{
+	GENERATED_BODY()
+
+public:
+	AClimbNavLinkProxy(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	/** SpawnActorDeferred 이후, FinishSpawning 이전에 호출 */
+	void InitializeClimbLink(const FVector& RelativeEnd);
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	UFUNCTION()
+	void HandleSmartLinkReached(AActor* MovingActor, const FVector& DestinationPoint);
+
+	void OnClimbRouteFinished(bool bSuccess, TWeakObjectPtr<AActor> MovingActor);
+};
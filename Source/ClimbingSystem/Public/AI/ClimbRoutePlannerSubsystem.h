@@ -0,0 +1,150 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/ClimbRouteTypes.h"
+#include "Climbing/ClimbSurfaceTypes.h"
+#include "ClimbRoutePlannerSubsystem.generated.h"
+
+class AClimbNavLinkProxy;
+class UClimbSurfaceSubsystem;
+class UPrimitiveComponent;
+
+/**
+ * AI 용 등반 경로 플래너
+ *
+ * 월드 시작 시 정적 등반 표면을 샘플링해 벽면 패치 / 렛지 / 볼팅 / 홉 그래프를 한 번 빌드하고,
+ * 계층 A* (클러스터 = 프리미티브의 한 면) 로 경로를 찾는다. 클러스터 내부 탐색 결과는 캐싱된다.
+ * 빌드는 Tick 에서 프레임당 트레이스 상한만큼 나눠 진행한다. 면은 컴포넌트 로컬 박스 기준으로 샘플링하고,
+ * 손이 닿는 거리의 다른 면 / 프리미티브 패치끼리 이어 모듈식 벽 조각과 모서리를 건널 수 있게 한다.
+ * 벽 아래와 위를 잇는 내비 링크를 생성해 UNavigationSystem 경로가 벽을 넘어갈 수 있게 한다.
+ * 엣지 비용은 DefaultGame.ini 의 CostSettings 로 정한다.
+ */
+UCLASS(Config = Game)
+class CLIMBINGSYSTEM_API UClimbRoutePlannerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 그래프 빌드를 시작 (Tick 에서 나눠 진행하고, 끝나면 IsGraphBuilt 가 true) */
+	void BuildGraph();
+
+	bool FindPath(const FVector& StartLocation, const FVector& GoalLocation, TArray<FClimbRouteWaypoint>& OutPath);
+	int32 FindNearestNode(const FVector& Location, float MaxDistance) const;
+
+	/** 반경 안의 모든 노드 (EQS 생성기용) */
+	void GatherNodesInRadius(const FVector& Location, float Radius, TArray<int32>& OutNodeIndices) const;
+
+	FORCEINLINE bool IsGraphBuilt() const { return bGraphBuilt; }
+	FORCEINLINE const TArray<FClimbRouteNode>& GetNodes() const { return Nodes; }
+
+private:
+#pragma region Graph Build
+
+	/** 샘플링 중인 프리미티브 한 면의 격자 (월드 공간) */
+	struct FSurfaceFaceBuild
+	{
+		TWeakObjectPtr<const UPrimitiveComponent> Component;
+		FClimbSurfaceProperties SurfaceProperties;
+		FVector FaceDirection = FVector::ZeroVector;
+
+		/** 첫 칸 (0, 0) 의 면 중앙 평면 위치와 열 / 행 사이 간격 */
+		FVector Origin = FVector::ZeroVector;
+		FVector ColumnStep = FVector::ZeroVector;
+		FVector RowStep = FVector::ZeroVector;
+
+		/** 면 중앙 평면에서 면까지의 두께 */
+		float Depth = 0.f;
+
+		int32 NumColumns = 0;
+		int32 NumRows = 0;
+		int32 NextRow = 0;
+		int32 ClusterId = INDEX_NONE;
+		TArray<int32> Grid;
+	};
+
+	void ResetGraph();
+	void StartNextComponentBuild();
+	void AddSurfaceFace(const UPrimitiveComponent* Component, const FClimbSurfaceProperties& SurfaceProperties, const FTransform& ComponentTransform, const FBox& LocalBox, const FVector& LocalFaceDirection);
+	void SampleSurfaceFaceRow(FSurfaceFaceBuild& Face);
+	void FinishSurfaceFace(const FSurfaceFaceBuild& Face);
+	void LinkNeighbourPatches(int32 NodeIndex, float LinkReach);
+	void BuildVaultNodes(const UPrimitiveComponent* Component, const FTransform& ComponentTransform, const FBox& LocalBox);
+	bool FindVaultLanding(const UPrimitiveComponent* Obstacle, const FVector& Point, const FBox& Bounds, FVector& OutLocation);
+	int32 TryAddLedgeNode(int32 PatchNodeIndex, float RowHeight);
+	int32 TryAddGroundNode(int32 PatchNodeIndex);
+	void FinishGraphBuild();
+
+	/** 빌드용 Climb 채널 라인 트레이스 (이번 프레임 트레이스 예산을 씀) */
+	bool TraceGraphBuild(FHitResult& OutHit, const FVector& Start, const FVector& End);
+	int32 AddNode(const FVector& Location, const FVector& Normal, EClimbRouteNodeType Type, int32 ClusterId);
+	void AddEdge(int32 FromNode, int32 ToNode, EClimbRouteEdgeType Type);
+	void RecalculateEdgeCosts();
+	void BuildClusterEntrances();
+	float GetEdgeCost(EClimbRouteEdgeType Type, const FVector& From, const FVector& To) const;
+
+	void EmitNavLinks();
+
+#pragma endregion
+
+#pragma region Search
+
+	struct FClimbLocalSearch
+	{
+		TMap<int32, float> Costs;
+		TMap<int32, int32> Parents;
+	};
+
+	const FClimbLocalSearch& GetLocalSearch(int32 SourceNode);
+	bool FindAbstractPath(int32 StartNode, int32 GoalNode, TArray<int32>& OutAbstractPath);
+	bool RefinePath(const TArray<int32>& AbstractPath, TArray<int32>& OutNodePath);
+	const FClimbRouteEdge* FindEdge(int32 FromNode, int32 ToNode) const;
+	float GetHeuristic(int32 FromNode, int32 ToNode) const;
+
+	static FIntVector GetSpatialHashCell(const FVector& Location);
+
+#pragma endregion
+
+	void OnDeferredGraphBuild();
+
+	UPROPERTY()
+	TObjectPtr<UClimbSurfaceSubsystem> ClimbSurfaceSubsystem;
+
+	TArray<FClimbRouteNode> Nodes;
+	TMap<FIntVector, TArray<int32>> SpatialHash;
+
+	/** 클러스터별 다른 클러스터와 연결된 노드 목록 */
+	TArray<TArray<int32>> ClusterEntrances;
+	int32 NumClusters = 0;
+
+	/** 빌드를 기다리는 프리미티브와 샘플링 중인 면 */
+	TArray<TPair<TWeakObjectPtr<const UPrimitiveComponent>, FClimbSurfaceProperties>> PendingComponents;
+	TArray<FSurfaceFaceBuild> PendingFaces;
+	int32 RemainingBuildTraces = 0;
+	double BuildStartTime = 0.0;
+	bool bGraphBuildInProgress = false;
+
+	/** 클러스터 내부 Dijkstra 결과 캐시 (경로 세그먼트 재구성에 사용, climb.RouteGraph.MaxCachedSearches 개까지) */
+	TMap<int32, FClimbLocalSearch> LocalSearchCache;
+
+	/** 내비 링크로 만들 (시작 노드, 끝 노드) 후보 */
+	TArray<TPair<int32, int32>> NavLinkCandidates;
+	TArray<TWeakObjectPtr<AClimbNavLinkProxy>> SpawnedNavLinks;
+
+	/** 엣지 비용 (먼저 로드된 캐릭터의 몽타주가 월드 전체 비용을 정하지 않도록 설정으로만 정함) */
+	UPROPERTY(Config)
+	FClimbRouteCostSettings CostSettings;
+
+	/** A* 휴리스틱이 과대평가하지 않도록 그래프에서 가장 빠른 이동 속도를 기록 */
+	float MaxTraversalSpeed = 100.f;
+
+	bool bGraphBuilt = false;
+};
@@ -0,0 +1,109 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimbRouteTypes.generated.h"
+
+UENUM(BlueprintType)
+enum class EClimbRouteNodeType : uint8
+{
+	/** 바닥에서 벽에 붙는 지점 */
+	Ground,
+	/** 등반 가능한 벽면 패치 */
+	SurfacePatch,
+	/** 벽 위쪽의 걸을 수 있는 렛지 */
+	Ledge,
+	/** 볼팅 가능한 낮은 장애물의 시작 / 착지 지점 */
+	VaultPoint
+};
+
+UENUM(BlueprintType)
+enum class EClimbRouteEdgeType : uint8
+{
+	/** 바닥 → 벽 (IdleToClimb) */
+	Enter,
+	/** 같은 벽면 위에서의 등반 이동 */
+	Climb,
+	/** 벽면 → 바닥 (등반 해제) */
+	Drop,
+	HopUp,
+	HopDown,
+	/** 벽면 → 렛지 (ClimbToTop) */
+	TopOut,
+	/** 렛지 → 벽면 (ClimbDownLedge) */
+	ClimbDown,
+	Vault
+};
+
+struct FClimbRouteEdge
+{
+	int32 ToNode = INDEX_NONE;
+	EClimbRouteEdgeType Type = EClimbRouteEdgeType::Climb;
+	float Cost = 0.f;
+};
+
+struct FClimbRouteNode
+{
+	FVector Location = FVector::ZeroVector;
+	FVector Normal = FVector::UpVector;
+	EClimbRouteNodeType Type = EClimbRouteNodeType::SurfacePatch;
+
+	/** 계층 A* 에서 사용하는 클러스터 (프리미티브의 한 면 단위) */
+	int32 ClusterId = INDEX_NONE;
+
+	TArray<FClimbRouteEdge> Edges;
+};
+
+/**
+ * AI 가 따라갈 등반 경로의 한 지점
+ */
+USTRUCT(BlueprintType)
+struct CLIMBINGSYSTEM_API FClimbRouteWaypoint
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Climbing")
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Climbing")
+	FVector SurfaceNormal = FVector::UpVector;
+
+	/** 이전 지점에서 이 지점으로 오기 위한 동작 */
+	UPROPERTY(BlueprintReadOnly, Category = "Climbing")
+	EClimbRouteEdgeType ArrivalEdge = EClimbRouteEdgeType::Climb;
+};
+
+/**
+ * 그래프 엣지 비용 계산에 사용하는 값들 (동작 시간 / 등반 속도)
+ * 월드에 그래프가 하나뿐이므로 특정 캐릭터가 아닌 프로젝트 설정 (DefaultGame.ini) 에서 정한다.
+ */
+USTRUCT()
+struct FClimbRouteCostSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Climbing", meta = (ClampMin = "1.0"))
+	float MaxClimbSpeed = 100.f;
+
+	UPROPERTY(EditAnywhere, Category = "Climbing", meta = (ClampMin = "0.0"))
+	float EnterDuration = 1.f;
+
+	UPROPERTY(EditAnywhere, Category = "Climbing", meta = (ClampMin = "0.0"))
+	float TopOutDuration = 1.5f;
+
+	UPROPERTY(EditAnywhere, Category = "Climbing", meta = (ClampMin = "0.0"))
+	float ClimbDownDuration = 1.5f;
+
+	UPROPERTY(EditAnywhere, Category = "Climbing", meta = (ClampMin = "0.0"))
+	float VaultDuration = 1.2f;
+
+	UPROPERTY(EditAnywhere, Category = "Climbing", meta = (ClampMin = "0.0"))
+	float HopUpDuration = 0.8f;
+
+	UPROPERTY(EditAnywhere, Category = "Climbing", meta = (ClampMin = "0.0"))
+	float HopDownDuration = 0.8f;
+
+	UPROPERTY(EditAnywhere, Category = "Climbing", meta = (ClampMin = "0.0"))
+	float DropDuration = 0.5f;
+};
@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StateTreeConditionBase.h"
+#include "Climbing/ClimbActionTypes.h"
+#include "ClimbStateTreeConditions.generated.h"
+
+class ACharacter;
+
+USTRUCT()
+struct CLIMBINGSYSTEM_API FStateTreeClimbConditionInstanceData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Context")
+	TObjectPtr<ACharacter> Character;
+};
+
+/**
+ * 현재 위치에서 등반을 시작할 수 있는지 (또는 이미 등반 중인지)
+ * UCustomMovementComponent 의 프로브 스냅샷을 요청해 읽는다 (낡은 스냅샷만 이동 컴포넌트가 그 자리에서 한 번 갱신).
+ */
+USTRUCT(meta = (DisplayName = "Can Climb Here", Category = "Climbing"))
+struct CLIMBINGSYSTEM_API FStateTreeCanClimbHereCondition : public FStateTreeConditionCommonBase
+{
+	GENERATED_BODY()
+
+	using FInstanceDataType = FStateTreeClimbConditionInstanceData;
+
+	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+	virtual bool TestCondition(FStateTreeExecutionContext& Context) const override;
+
+	UPROPERTY(EditAnywhere, Category = "Condition")
+	bool bInvert = false;
+};
+
+/**
+ * 지정한 등반 동작(홉 / 볼팅 / 탑아웃 등)을 지금 수행할 수 있는지
+ * UCustomMovementComponent 의 프로브 스냅샷을 요청해 읽는다 (낡은 스냅샷만 이동 컴포넌트가 그 자리에서 한 번 갱신).
+ */
+USTRUCT(meta = (DisplayName = "Climb Action Available", Category = "Climbing"))
+struct CLIMBINGSYSTEM_API FStateTreeClimbActionAvailableCondition : public FStateTreeConditionCommonBase
+{
+	GENERATED_BODY()
+
+	using FInstanceDataType = FStateTreeClimbConditionInstanceData;
+
+	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+	virtual bool TestCondition(FStateTreeExecutionContext& Context) const override;
+
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	EClimbAction Action = EClimbAction::EnterClimb;
+
+	UPROPERTY(EditAnywhere, Category = "Condition")
+	bool bInvert = false;
+};
@@ -0,0 +1,109 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StateTreeTaskBase.h"
+#include "Climbing/ClimbActionTypes.h"
+#include "ClimbStateTreeTasks.generated.h"
+
+class ACharacter;
+class UCustomMovementComponent;
+
+USTRUCT()
+struct CLIMBINGSYSTEM_API FStateTreeClimbToPointTaskInstanceData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Context")
+	TObjectPtr<ACharacter> Character;
+
+	UPROPERTY(EditAnywhere, Category = "Input")
+	FVector TargetLocation = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	float AcceptanceRadius = 100.f;
+};
+
+/**
+ * 등반 경로 플래너로 목표 지점까지의 경로를 찾아 UCustomMovementComponent 가 따라가게 한다.
+ */
+USTRUCT(meta = (DisplayName = "Climb To Point", Category = "Climbing"))
+struct CLIMBINGSYSTEM_API FStateTreeClimbToPointTask : public FStateTreeTaskCommonBase
+{
+	GENERATED_BODY()
+
+	using FInstanceDataType = FStateTreeClimbToPointTaskInstanceData;
+
+	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+	virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+	virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+	virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+};
+
+USTRUCT()
+struct CLIMBINGSYSTEM_API FStateTreeClimbActionTaskInstanceData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Context")
+	TObjectPtr<ACharacter> Character;
+};
+
+/**
+ * 몽타주 기반 등반 동작 태스크의 공통 부분
+ * 동작 몽타주가 재생되는 동안 Running, 끝난 뒤 기대한 이동 상태면 Succeeded 를 반환한다.
+ */
+USTRUCT(meta = (Hidden))
+struct CLIMBINGSYSTEM_API FStateTreeClimbActionTaskBase : public FStateTreeTaskCommonBase
+{
+	GENERATED_BODY()
+
+	using FInstanceDataType = FStateTreeClimbActionTaskInstanceData;
+
+	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+	virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+	virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+
+protected:
+	virtual EClimbAction GetAction() const { return EClimbAction::EnterClimb; }
+	virtual bool HasActionSucceeded(const UCustomMovementComponent& CustomMovementComponent) const;
+};
+
+USTRUCT(meta = (DisplayName = "Climb Hop", Category = "Climbing"))
+struct CLIMBINGSYSTEM_API FStateTreeClimbHopTask : public FStateTreeClimbActionTaskBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	bool bHopUp = true;
+
+protected:
+	virtual EClimbAction GetAction() const override { return bHopUp ? EClimbAction::HopUp : EClimbAction::HopDown; }
+};
+
+USTRUCT(meta = (DisplayName = "Vault", Category = "Climbing"))
+struct CLIMBINGSYSTEM_API FStateTreeClimbVaultTask : public FStateTreeClimbActionTaskBase
+{
+	GENERATED_BODY()
+
+protected:
+	virtual EClimbAction GetAction() const override { return EClimbAction::Vault; }
+	virtual bool HasActionSucceeded(const UCustomMovementComponent& CustomMovementComponent) const override;
+};
+
+/**
+ * 렛지에 닿을 때까지 위로 등반한 뒤 올라선다.
+ */
+USTRUCT(meta = (DisplayName = "Top Out", Category = "Climbing"))
+struct CLIMBINGSYSTEM_API FStateTreeClimbTopOutTask : public FStateTreeClimbActionTaskBase
+{
+	GENERATED_BODY()
+
+	virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+	virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+
+protected:
+	virtual EClimbAction GetAction() const override { return EClimbAction::TopOut; }
+	virtual bool HasActionSucceeded(const UCustomMovementComponent& CustomMovementComponent) const override;
+};
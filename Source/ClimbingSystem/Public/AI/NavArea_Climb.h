@@ -0,0 +1,20 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NavAreas/NavArea.h"
+#include "NavArea_Climb.generated.h"
+
+/**
+ * 등반 내비 링크용 내비 영역
+ * 걷기보다 느린 등반 구간을 경로 비용에 반영한다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UNavArea_Climb : public UNavArea
+{
+	GENERATED_BODY()
+
+public:
+	UNavArea_Climb(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+};
@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Climbing/ClimbRules.h"
+#include "Climbing/ClimbSurfaceTypes.h"
+#include "ClimbAnalysisCommandlet.generated.h"
+
+class FClimbAnalysisTracer;
+class UPrimitiveComponent;
+
+/**
+ * 맵 등반 가능성 분석 커맨드렛
+ *
+ * 맵을 헤드리스로 로드해 UCustomMovementComponent 와 같은 판정 규칙(ClimbRules)을 촘촘한 샘플 격자에서
+ * 모든 코어로 병렬 실행하고, 등반 진입 지점 / 막다른 렛지 / 착지할 수 없는 볼팅과 규칙별 쿼리 비용을 리포트한다.
+ *
+ * 사용 예:
+ *   UnrealEditor-Cmd ClimbingSystem.uproject -run=ClimbAnalysis -Map=/Game/ThirdPerson/Lvl_ThirdPerson -CellSize=50 -FailOnIssues
+ *
+ * 명령줄 옵션:
+ *   -Map=패키지 경로          분석할 맵 (필수)
+ *   -CellSize=N               샘플 격자 간격 (기본 50cm)
+ *   -Character=클래스 경로     튜닝 값을 읽을 캐릭터 클래스 (기본 AClimbingSystemCharacter)
+ *   -Output=경로              리포트 CSV 경로 (기본 Saved/ClimbAnalysis/<맵>.csv, 비용은 <맵>-Costs.csv)
+ *   -FailOnIssues             막다른 렛지 / 착지할 수 없는 볼팅이 있으면 종료 코드 1
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbAnalysisCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UClimbAnalysisCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	enum class EClimbAnalysisRule : uint8
+	{
+		StartClimbing,
+		ClimbDownLedge,
+		Vault,
+		TopOut,
+		Num
+	};
+
+	/** 바닥에 선 자세 하나 또는 벽면 한 열의 꼭대기 */
+	struct FClimbAnalysisProbe
+	{
+		FClimbProbePose Pose;
+		TWeakObjectPtr<const UPrimitiveComponent> Surface;
+		bool bLedgeCapable = true;
+		bool bLedgeColumn = false;
+	};
+
+	struct FClimbAnalysisResult
+	{
+		bool bCanStartClimbing = false;
+		bool bCanClimbDownLedge = false;
+		bool bUnreachableVault = false;
+		bool bDeadEndLedge = false;
+		FVector IssueLocation = FVector::ZeroVector;
+		TWeakObjectPtr<const UPrimitiveComponent> HitSurface;
+
+		int32 NumQueries[static_cast<int32>(EClimbAnalysisRule::Num)] = {};
+		int32 NumEvaluations[static_cast<int32>(EClimbAnalysisRule::Num)] = {};
+		uint64 Cycles[static_cast<int32>(EClimbAnalysisRule::Num)] = {};
+	};
+
+	UWorld* LoadAnalysisWorld(const FString& MapName) const;
+	void ReleaseAnalysisWorld(UWorld* World) const;
+	bool ResolveRuleSettings(const FString& CharacterClassPath);
+	void BuildSurfaceSnapshot(UWorld* World);
+
+	const FClimbSurfaceProperties& GetSurfaceProperties(const FHitResult& Hit) const;
+
+	void GatherGroundProbes(const UWorld* World, TArray<FClimbAnalysisProbe>& OutProbes) const;
+	void GatherLedgeProbes(const UWorld* World, TArray<FClimbAnalysisProbe>& OutProbes) const;
+	void GatherFaceLedgeProbes(const UWorld* World, const UPrimitiveComponent* Component, const FClimbSurfaceProperties& Properties, const FVector& FaceDirection, TArray<FClimbAnalysisProbe>& OutProbes) const;
+
+	void EvaluateProbe(const UWorld* World, const FClimbAnalysisProbe& Probe, FClimbAnalysisResult& OutResult) const;
+	void EvaluateLedgeColumn(const FClimbAnalysisProbe& Probe, FClimbAnalysisTracer& Tracer, FClimbAnalysisResult& OutResult) const;
+
+	bool WriteReport(const FString& ReportPath, const TArray<FClimbAnalysisProbe>& Probes, const TArray<FClimbAnalysisResult>& Results, double ElapsedSeconds) const;
+
+	FClimbRuleSettings RuleSettings;
+	float CapsuleRadius = 42.f;
+	float CapsuleHalfHeight = 96.f;
+	float CellSize = 50.f;
+
+	/** 워커 스레드에서 읽기만 하도록 미리 해석해 둔 컴포넌트별 등반 속성 */
+	TMap<TObjectKey<UPrimitiveComponent>, FClimbSurfaceProperties> SurfacePropertiesSnapshot;
+	FBox ClimbableBounds;
+};
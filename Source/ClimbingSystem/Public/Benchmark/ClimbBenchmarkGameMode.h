@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimbingSystemGameMode.h"
+#include "ClimbBenchmarkGameMode.generated.h"
+
+class AClimbBotController;
+class AClimbingSystemCharacter;
+
+/**
+ * 데디케이티드 서버 등반 용량 벤치마크
+ *
+ * 봇 수를 단계적으로 늘리면서 단계마다 서버 프레임 시간, 등반 이동 틱 비용, 등반 씬 쿼리 수를 기록한다.
+ * 결과는 로그와 Saved/ClimbBenchmark 폴더의 CSV 로 남는다.
+ *
+ * 사용 예 (로컬 전용):
+ *   ClimbingSystemServer Lvl_ThirdPerson?game=/Script/ClimbingSystem.ClimbBenchmarkGameMode -log
+ *       -ClimbBots=200 -ClimbBotRamp=25 -ClimbBotStageSeconds=15 -ClimbBenchCourse -ClimbBenchExit
+ *   관찰용 클라이언트: ClimbingSystem 127.0.0.1 -windowed
+ *
+ * 명령줄 옵션:
+ *   -ClimbBots=N              최종 봇 수 (0 이면 벤치마크 비활성)
+ *   -ClimbBotRamp=N           단계마다 추가할 봇 수 (기본: 한 번에 전부)
+ *   -ClimbBotStageSeconds=S   단계 길이 (기본 10초, 앞 WarmupSeconds 는 측정 제외)
+ *   -ClimbBotSeed=N           봇 행동 시드
+ *   -ClimbBenchCourse         맵에 벽 / 볼팅 장애물 코스를 절차적으로 생성 (서버 전용, 클라이언트에는 보이지 않음)
+ *   -ClimbBenchExit           마지막 단계 리포트 후 종료
+ *
+ * 서버 틱 상한(NetServerMaxTickRate)에 걸리면 프레임 시간이 상한으로 고정되므로, 용량 측정 시에는
+ * 월드 틱 시간(WorldTick) 열을 기준으로 본다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API AClimbBenchmarkGameMode : public AClimbingSystemGameMode
+{
+	GENERATED_BODY()
+
+public:
+	AClimbBenchmarkGameMode();
+
+	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
+	virtual void StartPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+protected:
+	FORCEINLINE const TArray<TObjectPtr<AClimbBotController>>& GetBots() const { return Bots; }
+	FORCEINLINE int32 GetBotSeed() const { return BotSeed; }
+
+	/** 봇에 빙의시킬 컨트롤러 (소크 하네스는 더 공격적인 컨트롤러로 교체) */
+	TSubclassOf<AClimbBotController> BotControllerClass;
+
+private:
+	struct FBenchmarkSample
+	{
+		int32 NumFrames = 0;
+		/** 게임 스레드가 실제로 일한 시간 (프레임 제한 / VSync 대기 제외) */
+		double GameThreadSeconds = 0.0;
+		double MaxGameThreadSeconds = 0.0;
+		double WorldTickSeconds = 0.0;
+		double ClimbTickSeconds = 0.0;
+		int64 SceneQueries = 0;
+		int64 QueryCacheHits = 0;
+	};
+
+	void SpawnTestCourse();
+	void SpawnBots(int32 Count);
+	void OnStageFinished();
+	void ReportStage();
+	void WriteReport();
+
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	FVector GetBenchmarkOrigin() const;
+
+	/** 봇으로 스폰할 캐릭터 (DefaultGame.ini 에서 지정) */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Benchmark")
+	TSoftClassPtr<AClimbingSystemCharacter> BotCharacterClass;
+
+	/** 접속한 관찰용 클라이언트가 사용할 플레이어 컨트롤러 */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Benchmark")
+	TSoftClassPtr<APlayerController> ClientPlayerControllerClass;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Benchmark")
+	float BotSpacing = 150.f;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Benchmark")
+	float WarmupSeconds = 2.f;
+
+	UPROPERTY()
+	TArray<TObjectPtr<AClimbBotController>> Bots;
+
+	TSubclassOf<AClimbingSystemCharacter> LoadedBotCharacterClass;
+
+	int32 TargetBotCount = 0;
+	int32 BotRampStep = 0;
+	int32 BotSeed = 0;
+	float StageSeconds = 10.f;
+	bool bSpawnTestCourse = false;
+	bool bExitWhenFinished = false;
+
+	FBenchmarkSample CurrentSample;
+	double WorldTickStartTime = 0.0;
+	double SampleStartWorldTime = 0.0;
+
+	TArray<FString> ReportLines;
+	FTimerHandle StageTimerHandle;
+	FDelegateHandle WorldTickStartHandle;
+	FDelegateHandle WorldPostActorTickHandle;
+};
@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AI/ClimbBotController.h"
+#include "ClimbSoakBotController.generated.h"
+
+/**
+ * 소크 하네스용 봇 컨트롤러
+ * 프로브 결과와 동작 재생 여부를 무시하고 등반 / 홉 / 볼팅 / 점프 / 손 놓기를 짧은 간격으로 무작위 입력해
+ * 몽타주 도중 끼어들기 같은 상태 머신의 경계 조건을 만든다. 최근 행동을 남겨 실패를 재현할 수 있게 한다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API AClimbSoakBotController : public AClimbBotController
+{
+	GENERATED_BODY()
+
+public:
+	AClimbSoakBotController();
+
+	/** 최근 행동 (오래된 순, "a > b > c") */
+	FString GetRecentActionsString() const;
+
+	FORCEINLINE int32 GetNumActions() const { return NumActions; }
+	FORCEINLINE int32 GetSeed() const { return RandomStream.GetInitialSeed(); }
+
+protected:
+	virtual bool CanChooseAction() const override;
+	virtual void ChooseGroundAction(const FClimbProbeSnapshot& Snapshot) override;
+	virtual void ChooseClimbAction(const FClimbProbeSnapshot& Snapshot) override;
+
+private:
+	enum class ESoakAction : uint8
+	{
+		EnterClimb,
+		TopOut,
+		ClimbDownLedge,
+		Vault,
+		HopUp,
+		HopDown,
+		HopLeft,
+		HopRight,
+		ToggleClimbOn,
+		ToggleClimbOff,
+		RequestHop,
+		Jump,
+		Idle,
+		Num
+	};
+
+	void ChooseRandomAction();
+	void RecordAction(ESoakAction Action);
+
+	static const TCHAR* GetActionName(ESoakAction Action);
+
+	static constexpr int32 MaxRecentActions = 16;
+
+	/** 최근 행동 링 버퍼 */
+	TArray<ESoakAction, TInlineAllocator<MaxRecentActions>> RecentActions;
+	int32 NextRecentActionIndex = 0;
+	int32 NumActions = 0;
+};
@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Benchmark/ClimbBenchmarkGameMode.h"
+#include "ClimbSoakGameMode.generated.h"
+
+class AClimbSoakBotController;
+class UCustomMovementComponent;
+
+/**
+ * 등반 상태 머신 소크 하네스
+ *
+ * 벤치마크와 같은 방식으로 봇을 스폰하되 AClimbSoakBotController 로 무작위 등반 / 홉 / 볼팅 / 점프 입력을 반복하고,
+ * 매 프레임 고정 델타 타임을 무작위로 바꿔(가끔 히치 포함) 다양한 프레임 시간에서 상태 머신을 돌린다.
+ * 매 프레임 봇마다 UCustomMovementComponent::ValidateClimbState 불변식과 멈춤(동작 / 낙하가 끝나지 않음)을 검사하고,
+ * 상태별 이동 틱 시간 백분위와 이상치를 Saved/ClimbSoak 폴더의 CSV 로 남긴다.
+ *
+ * 사용 예 (로컬 전용):
+ *   ClimbingSystemServer Lvl_ThirdPerson?game=/Script/ClimbingSystem.ClimbSoakGameMode -log
+ *       -ClimbBots=64 -ClimbBenchCourse -ClimbSoakSeconds=600 -ClimbSoakExit
+ *
+ * 명령줄 옵션 (벤치마크 옵션에 추가):
+ *   -ClimbSoakSeconds=S       소크 길이 (기본 300초)
+ *   -ClimbSoakOutlierMs=N     이상치로 기록할 이동 틱 시간 (기본 0.5ms)
+ *   -ClimbSoakExit            리포트 후 종료
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API AClimbSoakGameMode : public AClimbBenchmarkGameMode
+{
+	GENERATED_BODY()
+
+public:
+	AClimbSoakGameMode();
+
+	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
+	virtual void StartPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/** 1us 간격 틱 시간 히스토그램 (마지막 칸은 상한 초과) */
+	struct FSoakTickHistogram
+	{
+		TArray<uint32> Buckets;
+		uint64 NumSamples = 0;
+		double MaxMicroseconds = 0.0;
+
+		void Add(double Microseconds);
+		double GetPercentile(double Percentile) const;
+	};
+
+	struct FSoakBotState
+	{
+		float ActionPlayingSeconds = 0.f;
+		float FallingSeconds = 0.f;
+		int32 NumFailures = 0;
+		bool bStuckReported = false;
+	};
+
+	void OnSoakPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	void SampleBot(int32 BotIndex, AClimbSoakBotController* Bot, float DeltaSeconds);
+	void ReportFailure(int32 BotIndex, const AClimbSoakBotController* Bot, const FString& Reason);
+	void RandomizeNextFrameTime();
+	void FinishSoak();
+	void WriteSoakReport();
+
+	static FName GetTickStateName(const UCustomMovementComponent* Movement);
+
+	/** 무작위 고정 델타 타임 범위 (초) */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Soak")
+	FVector2D FrameSecondsRange = FVector2D(1.f / 240.f, 1.f / 15.f);
+
+	/** 프레임마다 히치(긴 프레임)를 넣을 확률과 길이 */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Soak")
+	float HitchChance = 0.01f;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Soak")
+	float HitchSeconds = 0.25f;
+
+	/** 이 시간 이상 끝나지 않는 동작 / 낙하는 멈춘 것으로 판단 */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Soak")
+	float MaxActionSeconds = 6.f;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Soak")
+	float MaxFallingSeconds = 10.f;
+
+	/** 봇 하나가 기록할 최대 실패 수 / 전체 기록 줄 수 */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Soak")
+	int32 MaxFailuresPerBot = 5;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Soak")
+	int32 MaxIssueLines = 1000;
+
+	float SoakSeconds = 300.f;
+	float OutlierTickMs = 0.5f;
+	bool bExitWhenSoakFinished = false;
+
+	TArray<FSoakBotState> BotStates;
+	TMap<FName, FSoakTickHistogram> TickHistograms;
+	TArray<FString> IssueLines;
+	int32 NumFailures = 0;
+	int32 NumOutliers = 0;
+	int64 NumSampledFrames = 0;
+
+	FRandomStream FrameRandom;
+	bool bPreviousUseFixedTimeStep = false;
+	double PreviousFixedDeltaTime = 0.0;
+	bool bSoakRunning = false;
+
+	FTimerHandle SoakTimerHandle;
+	FDelegateHandle SoakPostActorTickHandle;
+};
@@ -0,0 +1,139 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Climbing/ClimbSurfaceTypes.h"
+#include "Engine/NetSerialization.h"
+#include "ClimbActionTypes.generated.h"
+
+/**
+ * 몽타주로 재생되는 등반 동작 종류
+ */
+UENUM(BlueprintType)
+enum class EClimbAction : uint8
+{
+	EnterClimb		UMETA(DisplayName = "Idle To Climb"),
+	TopOut			UMETA(DisplayName = "Climb To Top"),
+	ClimbDownLedge	UMETA(DisplayName = "Climb Down Ledge"),
+	Vault			UMETA(DisplayName = "Vault"),
+	HopUp			UMETA(DisplayName = "Hop Up"),
+	HopDown			UMETA(DisplayName = "Hop Down"),
+	HopLeft			UMETA(DisplayName = "Hop Left"),
+	HopRight		UMETA(DisplayName = "Hop Right"),
+	LedgeCatch		UMETA(DisplayName = "Ledge Catch"),
+	ShimmyDrop		UMETA(DisplayName = "Ledge Hang To Climb"),
+	HopUpLeft		UMETA(DisplayName = "Hop Up Left"),
+	HopUpRight		UMETA(DisplayName = "Hop Up Right"),
+	HopDownLeft		UMETA(DisplayName = "Hop Down Left"),
+	HopDownRight	UMETA(DisplayName = "Hop Down Right")
+};
+
+ENUM_RANGE_BY_FIRST_AND_LAST(EClimbAction, EClimbAction::EnterClimb, EClimbAction::HopDownRight);
+
+/**
+ * 등반 중 홉 방향 (벽면 기준 8방향)
+ * 대각선은 전용 몽타주 슬롯이 비어 있으면 위 / 아래 몽타주를 모션 워핑으로 옆으로 늘려 재생한다.
+ */
+UENUM(BlueprintType)
+enum class EClimbHopDirection : uint8
+{
+	Up,
+	UpRight,
+	Right,
+	DownRight,
+	Down,
+	DownLeft,
+	Left,
+	UpLeft
+};
+
+ENUM_RANGE_BY_FIRST_AND_LAST(EClimbHopDirection, EClimbHopDirection::Up, EClimbHopDirection::UpLeft);
+
+/** 등반 동작에 지정한 모션 워핑 타겟 (예측 요청 / 서버 보정에 실림) */
+USTRUCT()
+struct FClimbPredictedWarpTarget
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName Name;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Location = FVector::ZeroVector;
+};
+
+/**
+ * 자율 프록시가 먼저 시작한 등반 동작을 서버에 검증 요청
+ * 서버는 자신의 프로브로 같은 동작을 다시 판정하고 워프 타겟을 비교한다.
+ */
+USTRUCT()
+struct FClimbActionPrediction
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint8 PredictionId = 0;
+
+	UPROPERTY()
+	EClimbAction Action = EClimbAction::EnterClimb;
+
+	/** 홉일 때 실제 방향 (대각선 슬롯이 비어 있으면 위 / 아래 몽타주를 쓰므로 동작만으로는 알 수 없음) */
+	UPROPERTY()
+	EClimbHopDirection HopDirection = EClimbHopDirection::Up;
+
+	UPROPERTY()
+	TArray<FClimbPredictedWarpTarget> WarpTargets;
+};
+
+/**
+ * 이동 컴포넌트가 프레임당 최대 한 번 갱신하는 등반 프로브 결과
+ * StateTree 조건처럼 매 틱 평가되는 코드가 직접 트레이스하지 않고 이 값을 읽는다.
+ */
+struct FClimbProbeSnapshot
+{
+	/** 마지막으로 갱신된 프레임 (GFrameCounter) */
+	uint64 FrameNumber = 0;
+
+	bool bIsClimbing = false;
+	bool bIsShimmying = false;
+	bool bCanStartClimbing = false;
+	bool bCanClimbDownLedge = false;
+	bool bCanVault = false;
+	bool bCanHopUp = false;
+	bool bCanHopDown = false;
+	bool bCanHopLeft = false;
+	bool bCanHopRight = false;
+	bool bCanHopUpLeft = false;
+	bool bCanHopUpRight = false;
+	bool bCanHopDownLeft = false;
+	bool bCanHopDownRight = false;
+	bool bCanTopOut = false;
+	bool bCanCatchLedge = false;
+
+	FVector SurfaceNormal = FVector::ZeroVector;
+	FClimbSurfaceProperties SurfaceProperties;
+
+	bool IsActionAvailable(EClimbAction Action) const
+	{
+		switch (Action)
+		{
+		case EClimbAction::EnterClimb:		return bCanStartClimbing;
+		case EClimbAction::TopOut:			return bCanTopOut;
+		case EClimbAction::ClimbDownLedge:	return bCanClimbDownLedge;
+		case EClimbAction::Vault:			return bCanVault;
+		case EClimbAction::HopUp:			return bCanHopUp;
+		case EClimbAction::HopDown:			return bCanHopDown;
+		case EClimbAction::HopLeft:			return bCanHopLeft;
+		case EClimbAction::HopRight:		return bCanHopRight;
+		case EClimbAction::LedgeCatch:		return bCanCatchLedge;
+		case EClimbAction::ShimmyDrop:		return bIsShimmying;
+		case EClimbAction::HopUpLeft:		return bCanHopUpLeft;
+		case EClimbAction::HopUpRight:		return bCanHopUpRight;
+		case EClimbAction::HopDownLeft:		return bCanHopDownLeft;
+		case EClimbAction::HopDownRight:	return bCanHopDownRight;
+		}
+
+		return false;
+	}
+};
@@ -0,0 +1,110 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+
+/** 물리 스레드가 결정한 등반 상태 전환 (게임 스레드가 이동 모드 변경 / 몽타주로 처리) */
+enum class EClimbAsyncTransition : uint8
+{
+	None,
+	ReachedFloor,
+	TopOut
+};
+
+/**
+ * 게임 스레드가 보내는 등반자 하나의 이동 의도와 표면 모델
+ * 표면 / 바닥 / 렛지는 게임 스레드가 재프로브할 때만 갱신되고, 물리 스레드는 그 사이를 고정 간격으로 시뮬레이션한다.
+ */
+struct FClimbAsyncClimberInput
+{
+	uint32 ClimberId = 0;
+
+	/** 바뀌면 물리 스레드 상태를 아래 위치 / 회전 / 속도로 재설정 (진입, 충돌 보정, 루트 모션 이후) */
+	uint32 ResetSerial = 0;
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector Velocity = FVector::ZeroVector;
+
+	FVector InputAcceleration = FVector::ZeroVector;
+	float MaxSpeed = 0.f;
+	float BrakingDeceleration = 0.f;
+
+	/** SnapMovementToClimbableSurfaces 의 밀착 속도 배율 (MaxClimbSpeed) 과 벽과의 최소 거리 (캡슐 반지름) */
+	float SnapSpeed = 0.f;
+	float CapsuleRadius = 0.f;
+
+	FVector SurfaceLocation = FVector::ZeroVector;
+	FVector SurfaceNormal = FVector::ZeroVector;
+
+	/** 아래로 이동 중 캡슐 중심이 바닥 높이에서 FloorReachDistance 안으로 들어오면 바닥 도달 */
+	bool bHasFloor = false;
+	float FloorHeight = 0.f;
+	float FloorReachDistance = 0.f;
+
+	/** 위로 이동 중 눈높이가 렛지 윗면을 넘고 LedgeReachDistance 안이면 탑아웃 (CanTopOut 과 같은 조건) */
+	bool bHasLedge = false;
+	bool bLedgeCapable = true;
+	float LedgeTopHeight = 0.f;
+	float LedgeReachDistance = 0.f;
+	float EyeHeight = 0.f;
+};
+
+struct FClimbAsyncInput : public Chaos::FSimCallbackInput
+{
+	TArray<FClimbAsyncClimberInput> Climbers;
+	TArray<uint32> RemovedClimbers;
+
+	void Reset()
+	{
+		Climbers.Reset();
+		RemovedClimbers.Reset();
+	}
+};
+
+struct FClimbAsyncClimberOutput
+{
+	uint32 ClimberId = 0;
+	uint32 ResetSerial = 0;
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector Velocity = FVector::ZeroVector;
+	EClimbAsyncTransition Transition = EClimbAsyncTransition::None;
+};
+
+struct FClimbAsyncOutput : public Chaos::FSimCallbackOutput
+{
+	TArray<FClimbAsyncClimberOutput> Climbers;
+
+	void Reset()
+	{
+		Climbers.Reset();
+	}
+};
+
+/**
+ * Chaos 물리 스레드에서 고정 간격으로 등반 표면 추종 / 바닥 / 렛지 판정을 수행하는 시뮬레이션 콜백
+ * 씬 쿼리는 하지 않고, 게임 스레드가 보낸 표면 모델만 사용한다.
+ */
+class FClimbAsyncSimCallback : public Chaos::TSimCallbackObject<FClimbAsyncInput, FClimbAsyncOutput>
+{
+private:
+	struct FClimberState
+	{
+		FClimbAsyncClimberInput Input;
+		FVector Location = FVector::ZeroVector;
+		FQuat Rotation = FQuat::Identity;
+		FVector Velocity = FVector::ZeroVector;
+		EClimbAsyncTransition Transition = EClimbAsyncTransition::None;
+		float LastInputTime = 0.f;
+	};
+
+	virtual void OnPreSimulate_Internal() override;
+
+	static void SimulateClimber(FClimberState& State, float DeltaTime);
+
+	/** 물리 스레드 전용 */
+	TMap<uint32, FClimberState> Climbers;
+};
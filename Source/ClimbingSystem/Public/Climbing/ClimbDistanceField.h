@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 등반 가능한 정적 지오메트리 주변의 희소 브릭 거리장
+ *
+ * 공간을 BrickResolution^3 셀짜리 브릭으로 나누고 표면에서 MaxDistance 안에 걸친 브릭만 저장한다.
+ * 브릭은 경계 샘플을 이웃과 중복 저장 (BrickSamples^3) 하므로 삼선형 보간이 브릭 하나 안에서 끝나고,
+ * 거리는 부호 있는 값 [-MaxDistance, MaxDistance] 를 uint8 로 양자화한다. 콜리전 안쪽은 음수라서 파고든 깊이도 알 수 있다.
+ */
+struct CLIMBINGSYSTEM_API FClimbDistanceField
+{
+	static constexpr int32 BrickResolution = 8;
+	static constexpr int32 BrickSamples = BrickResolution + 1;
+	static constexpr int32 SamplesPerBrick = BrickSamples * BrickSamples * BrickSamples;
+
+	void Reset(float InVoxelSize, float InMaxDistance);
+
+	FIntVector GetBrickCoord(const FVector& WorldLocation) const;
+	FVector GetSampleLocation(const FIntVector& BrickCoord, int32 X, int32 Y, int32 Z) const;
+	FORCEINLINE float GetBrickSize() const { return VoxelSize * BrickResolution; }
+
+	static FORCEINLINE int32 GetSampleIndex(int32 X, int32 Y, int32 Z) { return X + BrickSamples * (Y + BrickSamples * Z); }
+
+	uint8 QuantizeDistance(float Distance) const;
+
+	/** 양자화된 샘플 SamplesPerBrick 개로 브릭 추가 (같은 좌표가 있으면 덮어씀) */
+	void AddBrick(const FIntVector& BrickCoord, TArrayView<const uint8> QuantizedSamples);
+
+	/**
+	 * @brief 삼선형 보간한 부호 있는 거리와 그 기울기 (표면에서 멀어지는 방향, 정규화하지 않음)
+	 * @return 위치를 덮는 브릭이 없으면 false (표면에서 MaxDistance 이상 떨어졌거나 필드에 없는 지오메트리)
+	 */
+	bool Sample(const FVector& WorldLocation, float& OutDistance, FVector& OutGradient) const;
+
+	FORCEINLINE float GetMaxDistance() const { return MaxDistance; }
+	FORCEINLINE int32 GetNumBricks() const { return BrickIndices.Num(); }
+	SIZE_T GetAllocatedSize() const { return BrickIndices.GetAllocatedSize() + BrickData.GetAllocatedSize(); }
+
+private:
+	float VoxelSize = 10.f;
+	float MaxDistance = 80.f;
+
+	/** 브릭 좌표 → BrickData 안의 브릭 번호 */
+	TMap<FIntVector, int32> BrickIndices;
+	TArray<uint8> BrickData;
+};
@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 프리미티브 윗면 가장자리를 따라가는 렛지 폴리라인 (프리미티브 로컬 공간)
+ *
+ * 닫힌 루프는 바깥 모서리를 따라 끝없이 돌 수 있고, 열린 폴리라인의 끝은 틈(막힌 구간 / 윗면 없음)이다.
+ */
+struct CLIMBINGSYSTEM_API FClimbLedgePolyline
+{
+	/** 가장자리 꼭짓점. 닫힌 루프면 마지막 → 첫 꼭짓점 세그먼트가 더 있음 */
+	TArray<FVector> Points;
+
+	/** 세그먼트별 바깥 방향 (렛지 아래 벽면의 법선) */
+	TArray<FVector> SegmentNormals;
+
+	/** 꼭짓점별 폴리라인 시작부터의 거리 (닫힌 루프면 마지막 원소가 한 바퀴 길이) */
+	TArray<float> CumulativeLengths;
+
+	bool bClosedLoop = false;
+
+	int32 GetNumSegments() const { return bClosedLoop ? Points.Num() : Points.Num() - 1; }
+	float GetLength() const { return CumulativeLengths.Num() > 0 ? CumulativeLengths.Last() : 0.f; }
+
+	/** 꼭짓점 / 법선이 채워진 뒤 누적 거리 계산 */
+	void Finalize();
+
+	/** 닫힌 루프는 한 바퀴로 감고, 열린 폴리라인은 양 끝으로 제한 */
+	float NormalizeDistance(float Distance) const;
+
+	/**
+	 * @brief 거리 위치의 가장자리 점 / 바깥 법선 / 진행 방향
+	 * @param CornerBlendDistance 꼭짓점에서 이 거리 안이면 이웃 세그먼트 법선과 섞어 모서리를 부드럽게 돎
+	 */
+	void Evaluate(float Distance, float CornerBlendDistance, FVector& OutLocation, FVector& OutNormal, FVector& OutTangent) const;
+
+	/** 로컬 위치에서 가장 가까운 가장자리 점까지의 거리 (제곱) 와 그 점의 폴리라인 거리 */
+	float FindClosestDistance(const FVector& LocalLocation, float& OutDistanceSquared) const;
+};
+
+/** 프리미티브 하나에서 추출한 렛지들 */
+struct FClimbLedgeSet
+{
+	TArray<FClimbLedgePolyline> Ledges;
+};
@@ -0,0 +1,22 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Climbing/ClimbSurfaceTypes.h"
+#include "ClimbPhysicalMaterial.generated.h"
+
+/**
+ * 등반 속성을 가진 피지컬 머티리얼
+ * 컴포넌트 단위 설정보다 우선한다 (예: 얼음, 젖은 바위)
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbPhysicalMaterial : public UPhysicalMaterial
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	FClimbSurfaceProperties ClimbProperties;
+};
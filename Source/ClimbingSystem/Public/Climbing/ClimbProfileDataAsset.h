@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Climbing/ClimbActionTypes.h"
+#include "ClimbProfileDataAsset.generated.h"
+
+class UAnimMontage;
+
+/**
+ * 등반 동작별 몽타주 (소프트 참조)
+ * 프로필 에셋을 로드해도 몽타주는 로드되지 않으며, 무브먼트 컴포넌트가 에셋 매니저로 비동기 로드한다.
+ */
+USTRUCT(BlueprintType)
+struct CLIMBINGSYSTEM_API FClimbMontageSet
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	TSoftObjectPtr<UAnimMontage> IdleToClimbMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	TSoftObjectPtr<UAnimMontage> ClimbToTopMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	TSoftObjectPtr<UAnimMontage> ClimbDownLedgeMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting")
+	TSoftObjectPtr<UAnimMontage> VaultMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting")
+	TSoftObjectPtr<UAnimMontage> HopUpMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting")
+	TSoftObjectPtr<UAnimMontage> HopDownMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting")
+	TSoftObjectPtr<UAnimMontage> HopLeftMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting")
+	TSoftObjectPtr<UAnimMontage> HopRightMontage;
+
+	/** 대각선 홉 (비어 있으면 HopUp / HopDown 몽타주를 옆으로 워핑) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting")
+	TSoftObjectPtr<UAnimMontage> HopUpLeftMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting")
+	TSoftObjectPtr<UAnimMontage> HopUpRightMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting")
+	TSoftObjectPtr<UAnimMontage> HopDownLeftMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting")
+	TSoftObjectPtr<UAnimMontage> HopDownRightMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	TSoftObjectPtr<UAnimMontage> LedgeCatchMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	TSoftObjectPtr<UAnimMontage> ShimmyDropMontage;
+
+	const TSoftObjectPtr<UAnimMontage>& GetMontage(EClimbAction Action) const;
+	TSoftObjectPtr<UAnimMontage>& GetMontage(EClimbAction Action);
+
+	/** 비어 있지 않은 슬롯만 Other 값으로 덮어씀 (변형 프로필 적용용) */
+	void Override(const FClimbMontageSet& Other);
+};
+
+/**
+ * 등반 이동 수치 (무브먼트 컴포넌트의 같은 이름 프로퍼티를 대체)
+ */
+USTRUCT(BlueprintType)
+struct CLIMBINGSYSTEM_API FClimbTuning
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	float ClimbCapsuleTraceRadius = 50.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	float ClimbCapsuleTraceHalfHeight = 72.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	float MaxBreakClimbDeceleration = 400.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	float MaxClimbSpeed = 100.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	float MaxClimbAcceleration = 300.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	float ClimbDownWalkableSurfaceTraceOffset = 100.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	float ClimbDownLedgeTraceOffset = 50.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (ClampMin = "0.0", ClampMax = "90.0"))
+	float MaxClimbableSurfaceAngle = 60.f;
+};
+
+/**
+ * 캐릭터 종류끼리 공유하는 등반 설정 프로필
+ *
+ * 수치와 몽타주를 인스턴스마다 복제하지 않고 하나의 프라이머리 에셋으로 공유한다.
+ * MontageVariants 에 이름별 몽타주 세트를 두면 같은 수치로 애니메이션만 바꾼 변형을 쓸 수 있다.
+ */
+UCLASS(BlueprintType)
+class CLIMBINGSYSTEM_API UClimbProfileDataAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	static const FPrimaryAssetType ClimbProfileAssetType;
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	/** 변형 이름에 해당하는 몽타주 세트 (변형에서 비워 둔 슬롯은 기본 세트 사용) */
+	FClimbMontageSet ResolveMontages(FName Variant) const;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Climbing")
+	FClimbTuning Tuning;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Climbing")
+	FClimbMontageSet Montages;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Climbing")
+	TMap<FName, FClimbMontageSet> MontageVariants;
+};
@@ -0,0 +1,40 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 등반 품질 스케일러빌리티 설정 (climb.Quality.* CVar 스냅샷)
+ *
+ * sg.ClimbingQuality 그룹 단계가 바뀌면 DefaultScalability.ini 의 [ClimbingQuality@N] 섹션이 CVar 들을 덮어쓰고,
+ * 디바이스 프로필은 +CVars=sg.ClimbingQuality=N 으로 기기별 기본 단계를 고른다.
+ * CVar 가 바뀐 프레임 끝에 스냅샷을 갱신하고 살아있는 모든 UCustomMovementComponent 에 바로 적용한다.
+ *
+ * 표면 위치 / 법선 / 등반 판정을 바꾸는 항목 (재프로브, 캡슐 / 라인 프로브, 표면 추종) 은 서버가 이동을 검증하는
+ * 캐릭터에는 적용하지 않는다 (UCustomMovementComponent::GetClimbProbeQuality). 클라이언트와 서버의 판정이 갈라지기 때문.
+ */
+struct CLIMBINGSYSTEM_API FClimbQualitySettings
+{
+	/** 표면 재프로브 거리 / 각도 배율 (클수록 트레이스를 덜 함) */
+	float ReprobeScale = 1.f;
+
+	/** 매달려 정지한 동안의 틱 간격 배율 */
+	float IdleTickIntervalScale = 1.f;
+
+	/** 홉 후보를 비동기 트레이스로 미리 찾아둠 (false 면 홉 요청 시 필요한 방향만 동기 트레이스) */
+	bool bHopPrefetch = true;
+
+	/** 벽면 프로브를 캡슐 스윕으로 (false 면 캡슐 높이 세 곳의 라인 트레이스) */
+	bool bCapsuleSurfaceProbes = true;
+
+	/** 벽면 프로브 캡슐 크기 배율 */
+	float CapsuleTraceScale = 1.f;
+
+	/** 거리장 표면 추종 중 다시 스윕하기까지의 거리 배율 */
+	float SurfaceFitResweepScale = 1.f;
+
+	bool operator==(const FClimbQualitySettings& Other) const = default;
+
+	static const FClimbQualitySettings& Get();
+};
@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/RootMotionSource.h"
+#include "ClimbRootMotionSource.generated.h"
+
+class UAnimMontage;
+
+/**
+ * 몽타주의 루트 모션을 로드 시점에 고정 간격으로 샘플링한 결과
+ * 스켈레탈 포즈를 틱하지 않고도 같은 궤적을 재현할 수 있다.
+ */
+struct CLIMBINGSYSTEM_API FClimbBakedRootMotion
+{
+	struct FWarpWindow
+	{
+		FName WarpTargetName;
+		float StartTime = 0.f;
+		float EndTime = 0.f;
+	};
+
+	float Duration = 0.f;
+	float SampleInterval = 1.f / 30.f;
+
+	/** 몽타주 시작 기준 누적 루트 이동 (메시 공간) */
+	TArray<FVector> Translations;
+
+	/** 몽타주의 모션 워핑 노티파이 구간 (시작 시간 순) */
+	TArray<FWarpWindow> WarpWindows;
+
+	FVector GetTranslationAtTime(float Time) const;
+};
+
+namespace ClimbRootMotion
+{
+	/** 몽타주별로 한 번만 굽고 이후에는 캐시를 반환 (게임 스레드 전용) */
+	CLIMBINGSYSTEM_API const FClimbBakedRootMotion* FindOrBake(const UAnimMontage* Montage);
+}
+
+/**
+ * 구운 몽타주 루트 모션을 재생하는 루트 모션 소스
+ *
+ * 시작 시점의 워프 타겟으로 구간별 보정량을 미리 계산해 두고, 몽타주의 모션 워핑과 같은 방식으로
+ * 각 워핑 구간이 끝날 때 타겟에 도달하도록 궤적을 선형으로 보정한다. (회전은 구동하지 않음)
+ * 몽타주에 워핑 구간이 없는 도착 지점은 ResolveEndLocation 으로 전체 구간에 걸쳐 보정한다.
+ */
+USTRUCT()
+struct CLIMBINGSYSTEM_API FRootMotionSource_ClimbTransition : public FRootMotionSource
+{
+	GENERATED_BODY()
+
+	FRootMotionSource_ClimbTransition();
+	virtual ~FRootMotionSource_ClimbTransition() override {}
+
+	UPROPERTY()
+	TObjectPtr<UAnimMontage> Montage;
+
+	UPROPERTY()
+	FVector StartLocation = FVector::ZeroVector;
+
+	/** 메시 공간 루트 모션을 월드로 옮기는 회전 (시작 시 액터 회전 * 메시 기본 회전) */
+	UPROPERTY()
+	FQuat RootMotionRotation = FQuat::Identity;
+
+	/** 워핑 구간별 월드 공간 보정량 (FClimbBakedRootMotion::WarpWindows 와 같은 순서) */
+	UPROPERTY()
+	TArray<FVector> WarpCorrections;
+
+	/** 궤적 끝을 도착 지점에 맞추는 월드 공간 보정량 (몽타주 전체 길이에 걸쳐 선형으로 적용) */
+	UPROPERTY()
+	FVector EndCorrection = FVector::ZeroVector;
+
+	/**
+	 * 워프 타겟 위치로 보정량을 계산
+	 * @param FindWarpTarget 구간의 타겟 이름으로 액터 위치 기준 타겟을 찾음 (없으면 그 구간은 보정하지 않음)
+	 */
+	void ResolveWarpTargets(const FClimbBakedRootMotion& Baked, TFunctionRef<TOptional<FVector>(FName)> FindWarpTarget);
+
+	/** 워핑 구간 보정이 반영된 궤적의 끝이 EndLocation (액터 위치 기준) 이 되도록 보정량을 계산 */
+	void ResolveEndLocation(const FClimbBakedRootMotion& Baked, const FVector& EndLocation);
+
+	FVector GetLocationAtTime(const FClimbBakedRootMotion& Baked, float Time) const;
+
+	virtual FRootMotionSource* Clone() const override;
+	virtual bool Matches(const FRootMotionSource* Other) const override;
+	virtual bool MatchesAndHasSameState(const FRootMotionSource* Other) const override;
+	virtual bool UpdateStateFrom(const FRootMotionSource* SourceToTakeStateFrom, bool bMarkForSimulatedCatchup = false) override;
+	virtual void PrepareRootMotion(float SimulationTime, float MovementTickTime, const ACharacter& Character, const UCharacterMovementComponent& MoveComponent) override;
+	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+	virtual UScriptStruct* GetScriptStruct() const override;
+	virtual FString ToSimpleString() const override;
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FRootMotionSource_ClimbTransition> : public TStructOpsTypeTraitsBase2<FRootMotionSource_ClimbTransition>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithCopy = true
+	};
+};
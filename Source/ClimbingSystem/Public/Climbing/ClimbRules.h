@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimbingSystem.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/HitResult.h"
+
+/**
+ * 등반 판정 규칙이 사용하는 튜닝 값
+ * UCustomMovementComponent 와 오프라인 분석(UClimbAnalysisCommandlet)이 같은 값으로 판정하도록 묶어 둔다.
+ */
+struct CLIMBINGSYSTEM_API FClimbRuleSettings
+{
+	ECollisionChannel TraceChannel = ECC_Climb;
+	float CapsuleTraceRadius = 50.f;
+	float CapsuleTraceHalfHeight = 72.f;
+	float EyeHeight = 64.f;
+	float ClimbDownWalkableSurfaceTraceOffset = 100.f;
+	float ClimbDownLedgeTraceOffset = 50.f;
+	float MaxClimbableSurfaceAngle = 60.f;
+	int32 VaultTraceSteps = 5;
+	int32 VaultLandTraceIndex = 3;
+};
+
+/** 판정 기준 위치와 방향 (캐릭터 캡슐 중심) */
+struct FClimbProbePose
+{
+	FVector Location = FVector::ZeroVector;
+	FVector Forward = FVector::ForwardVector;
+	FVector Up = FVector::UpVector;
+};
+
+/**
+ * 등반 규칙이 실행하는 씬 쿼리
+ * 무브먼트 컴포넌트는 쿼리 캐시 / 디버그 드로우를 거치고, 분석 커맨드렛은 워커 스레드에서 월드를 직접 쿼리한다.
+ */
+class IClimbRuleTracer
+{
+public:
+	virtual ~IClimbRuleTracer() = default;
+
+	virtual FHitResult LineTrace(const FVector& Start, const FVector& End) = 0;
+
+	/** 등반 불가 표면은 제외된 캡슐 스윕 결과 */
+	virtual TArray<FHitResult> CapsuleTrace(const FVector& Start, const FVector& End) = 0;
+};
+
+/**
+ * 캐릭터 상태와 무관한 등반 판정 규칙
+ * 낙하 중 / 표면 속성(bLedgeCapable) / 랜드스케이프 빠른 경로 같은 상태 의존 조건은 호출자가 확인한다.
+ */
+namespace ClimbRules
+{
+	CLIMBINGSYSTEM_API bool TraceClimbableSurfaces(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer, TArray<FHitResult>& OutSurfaceHits);
+	CLIMBINGSYSTEM_API FHitResult TraceFromEyeHeight(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer, float TraceDistance, float TraceStartOffset = 0.f);
+
+	CLIMBINGSYSTEM_API bool CanStartClimbing(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer, TArray<FHitResult>& OutSurfaceHits);
+	CLIMBINGSYSTEM_API bool CanTopOut(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer);
+
+	/** @param OutWalkableSurfaceHit 내려갈 렛지 위의 바닥 (표면 속성 확인용) */
+	CLIMBINGSYSTEM_API bool CanClimbDownLedge(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer, FHitResult& OutWalkableSurfaceHit);
+
+	CLIMBINGSYSTEM_API bool CanStartVaulting(const FClimbRuleSettings& Settings, const FClimbProbePose& Pose, IClimbRuleTracer& Tracer, FVector& OutVaultStartPosition, FVector& OutVaultLandPosition);
+}
@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ClimbSplineActor.generated.h"
+
+class USplineComponent;
+
+/** 스플라인 등반 오브젝트 종류 */
+UENUM(BlueprintType)
+enum class EClimbSplineType : uint8
+{
+	/** 항상 스플라인 포인트의 Up 방향 쪽에서 매달림 */
+	Ladder,
+	/** 잡은 쪽 (스플라인 둘레의 각도) 을 유지하며 오르내림 */
+	Pipe,
+	Rope
+};
+
+/**
+ * 사다리 / 파이프 / 로프
+ *
+ * 등반자는 스플라인에 해석적으로 구속된다: 위치 / 방향 / 내리는 지점이 모두 스플라인에서 나오므로
+ * MOVE_SplineClimb 중에는 표면 트레이스를 하지 않는다. 스플라인은 아래 끝에서 위 끝 방향으로 그린다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API AClimbSplineActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AClimbSplineActor();
+
+	FORCEINLINE USplineComponent* GetSpline() const { return Spline; }
+	FORCEINLINE EClimbSplineType GetSplineType() const { return SplineType; }
+	FORCEINLINE float GetClimbSpeedScale() const { return ClimbSpeedScale; }
+	FORCEINLINE bool CanExitAtTop() const { return bExitAtTop; }
+
+	float GetClimbLength() const;
+	float FindDistanceClosestTo(const FVector& WorldLocation) const;
+
+	/** 스플라인 둘레에서 해당 위치가 있는 각도 (라디안, 스플라인 Up 기준 접선 축 회전) */
+	float FindAngleAround(float Distance, const FVector& WorldLocation) const;
+
+	/**
+	 * @brief 스플라인 위 거리 / 둘레 각도에서 등반자 캡슐 중심의 트랜스폼
+	 *
+	 * 캡슐은 StandOffDistance 만큼 떨어져 스플라인을 바라보고, 캡슐 Up 은 접선 방향이다.
+	 */
+	FTransform GetClimbTransform(float Distance, float Angle) const;
+
+	FVector GetTangent(float Distance) const;
+
+	/** 위 끝에서 올라섰을 때 설 위치 */
+	FVector GetTopExitLocation() const;
+
+private:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<USplineComponent> Spline;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (AllowPrivateAccess = "true"))
+	EClimbSplineType SplineType = EClimbSplineType::Ladder;
+
+	/** 스플라인에서 캡슐 중심까지의 거리 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (AllowPrivateAccess = "true"))
+	float StandOffDistance = 40.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (AllowPrivateAccess = "true"))
+	float ClimbSpeedScale = 1.f;
+
+	/** false 면 위 끝에서 멈춤 (천장에 매달린 로프 등) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (AllowPrivateAccess = "true"))
+	bool bExitAtTop = true;
+
+	/** 위 끝 포인트의 로컬 공간 기준 올라설 위치 (X = 스플라인 포인트의 -Up 방향, 사다리 너머) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (AllowPrivateAccess = "true"))
+	FVector TopExitOffset = FVector(60.f, 0.f, 100.f);
+};
@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimbSurfaceTypes.generated.h"
+
+/**
+ * 프리미티브 / 피지컬 머티리얼 단위로 지정하는 등반 속성
+ */
+USTRUCT(BlueprintType)
+struct CLIMBINGSYSTEM_API FClimbSurfaceProperties
+{
+	GENERATED_BODY()
+
+	/** false 이면 등반 트레이스에서 제외된다 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	bool bClimbable = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (InlineEditConditionToggle))
+	bool bOverrideMaxClimbableSurfaceAngle = false;
+
+	/** 이 표면에서 사용할 MaxClimbableSurfaceAngle (무브먼트 컴포넌트 기본값 대신 사용) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (EditCondition = "bOverrideMaxClimbableSurfaceAngle", ClampMin = "0.0", ClampMax = "90.0"))
+	float MaxClimbableSurfaceAngle = 60.f;
+
+	/** MaxClimbSpeed 에 곱해지는 배율 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (ClampMin = "0.0"))
+	float ClimbSpeedScale = 1.f;
+
+	/** false 이면 이 표면에서는 ClimbToTop / ClimbDownLedge 가 발생하지 않는다 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	bool bLedgeCapable = true;
+
+	float GetMaxClimbableSurfaceAngle(float DefaultAngle) const
+	{
+		return bOverrideMaxClimbableSurfaceAngle ? MaxClimbableSurfaceAngle : DefaultAngle;
+	}
+};
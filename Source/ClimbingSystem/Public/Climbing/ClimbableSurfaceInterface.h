@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Climbing/ClimbSurfaceTypes.h"
+#include "ClimbableSurfaceInterface.generated.h"
+
+class UPrimitiveComponent;
+
+UINTERFACE(MinimalAPI, BlueprintType)
+class UClimbableSurfaceInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * 액터 단위로 등반 속성을 제공하는 인터페이스
+ * 결과는 UClimbSurfaceSubsystem 이 컴포넌트 등록 시점에 캐싱하므로 매 프레임 호출되지 않는다.
+ */
+class CLIMBINGSYSTEM_API IClimbableSurfaceInterface
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Climbing")
+	bool GetClimbSurfaceProperties(const UPrimitiveComponent* Component, FClimbSurfaceProperties& OutProperties) const;
+};
@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetUserData.h"
+#include "Climbing/ClimbSurfaceTypes.h"
+#include "ClimbableSurfaceUserData.generated.h"
+
+/**
+ * 프리미티브 컴포넌트 또는 스태틱 메시에 붙여 등반 속성을 지정하는 AssetUserData
+ */
+UCLASS(BlueprintType, meta = (DisplayName = "Climbable Surface"))
+class CLIMBINGSYSTEM_API UClimbableSurfaceUserData : public UAssetUserData
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing")
+	FClimbSurfaceProperties Properties;
+};
@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/BoxComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "ClimbProxyComponent.generated.h"
+
+/**
+ * Climb 트레이스 채널만 막는 단순화된 등반용 박스 프록시
+ * 벽 / 렛지마다 하나씩 배치하면 디테일한 아트 콜리전 대신 이 박스만 스윕된다.
+ * Climb 채널은 기본 응답이 Ignore 이므로 프록시나 Climbable 프로필을 쓴 프리미티브만 등반 스윕에 걸린다.
+ */
+UCLASS(ClassGroup = (Climbing), meta = (BlueprintSpawnableComponent))
+class CLIMBINGSYSTEM_API UClimbProxyBoxComponent : public UBoxComponent
+{
+	GENERATED_BODY()
+
+public:
+	UClimbProxyBoxComponent(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	/** true 이면 같은 액터의 다른 프리미티브들은 Climb 채널을 무시하도록 변경 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (AllowPrivateAccess = "true"))
+	bool bHideOwnerCollisionFromClimbChannel = true;
+};
+
+/**
+ * Climb 트레이스 채널만 막는 컨벡스 프록시
+ * 단순 콜리전(컨벡스)을 가진 저폴리 메시를 지정해서 사용한다. 게임에서는 렌더링되지 않는다.
+ */
+UCLASS(ClassGroup = (Climbing), meta = (BlueprintSpawnableComponent))
+class CLIMBINGSYSTEM_API UClimbProxyMeshComponent : public UStaticMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	UClimbProxyMeshComponent(const FObjectInitializer& ObjectInitializer);
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	/** true 이면 같은 액터의 다른 프리미티브들은 Climb 채널을 무시하도록 변경 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Climbing", meta = (AllowPrivateAccess = "true"))
+	bool bHideOwnerCollisionFromClimbChannel = true;
+};
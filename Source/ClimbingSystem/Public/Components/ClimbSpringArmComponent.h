@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SpringArmComponent.h"
+#include "ClimbSpringArmComponent.generated.h"
+
+class UCustomMovementComponent;
+
+/**
+ * 등반 중 이동 컴포넌트가 이미 찾아 둔 벽면 (위치 / 법선) 으로 카메라가 벽 안으로 들어가지 않게 하는 스프링 암
+ *
+ * 벽면 패치 안에서는 팔 길이를 벽 평면과의 교차로 해석적으로 줄이고, 다른 지오메트리용 스윕은
+ * ClimbProbeInterval 마다만 수행해 그 사이에는 마지막 스윕의 팔 길이를 상한으로 쓴다.
+ */
+UCLASS(ClassGroup = (Camera), meta = (BlueprintSpawnableComponent))
+class CLIMBINGSYSTEM_API UClimbSpringArmComponent : public USpringArmComponent
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void UpdateDesiredArmLocation(bool bDoTrace, bool bDoLocationLag, bool bDoRotationLag, float DeltaTime) override;
+	virtual FVector BlendLocations(const FVector& DesiredArmLocation, const FVector& TraceHitLocation, bool bHitSomething, float DeltaTime) override;
+
+private:
+	/** 벽 등반 / 렛지 매달리기 중이고 표면 정보가 유효하면 그 표면 */
+	bool GetClimbSurface(FVector& OutSurfaceLocation, FVector& OutSurfaceNormal) const;
+
+	/** 현재 소켓 위치를 벽 평면 / 마지막 스윕 길이 안쪽으로 당김 */
+	void ClampArmToClimbSurface(const FVector& SurfaceLocation, const FVector& SurfaceNormal, bool bProbedThisFrame);
+
+	/** 벽 평면과의 교차점이 표면 위치에서 이 거리 안일 때만 평면으로 막음 (벽 가장자리 너머는 스윕에 맡김) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera Collision | Climbing", meta = (AllowPrivateAccess = "true"))
+	float ClimbSurfacePatchRadius = 200.f;
+
+	/** 등반 중 카메라 충돌 스윕 간격 (초, 0 이면 매 프레임) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera Collision | Climbing", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float ClimbProbeInterval = 0.2f;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UCustomMovementComponent> ClimbMovementComponent;
+
+	/** 마지막 스윕이 허용한 팔 길이 (막힘이 없었으면 최댓값) */
+	float ClimbProbedArmLength = TNumericLimits<float>::Max();
+	float ClimbProbeTimeRemaining = 0.f;
+};
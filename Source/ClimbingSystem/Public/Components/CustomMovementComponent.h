@@ -3,22 +3,67 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ClimbingSystem.h"
+#include "Components/SkinnedMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "WorldCollision.h"
+#include "AI/ClimbRouteTypes.h"
+#include "Climbing/ClimbActionTypes.h"
+#include "Climbing/ClimbAsyncPhysics.h"
+#include "Climbing/ClimbLedgeTypes.h"
+#include "Climbing/ClimbProfileDataAsset.h"
+#include "Climbing/ClimbRules.h"
+#include "Climbing/ClimbSurfaceTypes.h"
 #include "CustomMovementComponent.generated.h"
 
 DECLARE_DELEGATE(FOnEnterClimbState)
 DECLARE_DELEGATE(FOnExitClimbState)
+DECLARE_DELEGATE_OneParam(FOnClimbRouteFinished, bool /*bSuccess*/)
 
 class AClimbingSystemCharacter;
+class AClimbSplineActor;
+class ALandscapeProxy;
+class UClimbAsyncPhysicsSubsystem;
+class UClimbDistanceFieldSubsystem;
+class UClimbLedgeSubsystem;
+class UClimbQueryCacheSubsystem;
+class UClimbSurfaceSubsystem;
+struct FClimbActionPredictionScope;
+struct FClimbQualitySettings;
+struct FStreamableHandle;
 
 UENUM(BlueprintType)
 namespace ECustomMovementMode
 {
 	enum Type
 	{
-		MOVE_Climb UMETA(DisplayName = "Climb Mode")
+		MOVE_Climb UMETA(DisplayName = "Climb Mode"),
+		/** 사다리 / 파이프 / 로프 스플라인에 구속된 등반 (표면 트레이스 없음) */
+		MOVE_SplineClimb UMETA(DisplayName = "Spline Climb Mode"),
+		/** 렛지에 매달려 가장자리 폴리라인을 따라 옆으로 이동 */
+		MOVE_Shimmy UMETA(DisplayName = "Shimmy Mode")
 	};
 }
+
+/** 이동 컴포넌트 틱 상태 */
+enum class EClimbTickState : uint8
+{
+	Active,
+	/** 등반 중 멈춰 매달려 있음: 낮은 빈도로 틱 */
+	ClimbIdle,
+	/** 지상에서 정지: 틱 비활성, 입력 / 충격 / 베이스 이동 등의 이벤트로 깨어남 */
+	Sleeping
+};
+/** 등반 중 진행 방향 앞에서 감지한 모서리 종류 */
+enum class EClimbCornerType : uint8
+{
+	None,
+	/** 안쪽 모서리: 진행 방향에 새 벽면이 막고 있음 */
+	Inside,
+	/** 바깥 모서리: 현재 벽면이 끝나고 옆면으로 돌아감 */
+	Outside
+};
+
 /**
  * 
  */
@@ -32,6 +77,13 @@ public:
 	void RequestHopping();
 	
 	bool IsClimbing() const;
+	bool IsSplineClimbing() const;
+	bool IsShimmying() const;
+
+	/** 벽 / 스플라인 등반, 렛지 매달리기 중 하나 (캡슐 / 회전 / 진입 · 해제 델리게이트를 공유) */
+	bool IsInAnyClimbMode() const;
+
+	FORCEINLINE AClimbSplineActor* GetActiveClimbSpline() const { return ActiveClimbSpline.Get(); }
 
 	FVector GetUnrotatedClimbVelocity() const;
 
@@ -39,6 +91,87 @@ public:
 	FOnExitClimbState OnExitClimbStateDelegate;
 	
 	FORCEINLINE FVector GetClimbableSurfaceNormal() const { return CurrentClimbableSurfaceNormal; }
+	FORCEINLINE FVector GetClimbableSurfaceLocation() const { return CurrentClimbableSurfaceLocation; }
+	FORCEINLINE float GetMaxClimbSpeed() const { return MaxClimbSpeed; }
+
+	UAnimMontage* GetClimbActionMontage(EClimbAction Action) const;
+	float GetClimbActionDuration(EClimbAction Action) const;
+
+	/** 등반 동작을 즉시 시도. 동작 몽타주가 재생되기 시작하면 true */
+	bool TryClimbAction(EClimbAction Action);
+
+	bool IsClimbActionPlaying() const;
+
+	/** 가장 최근 프로브 결과를 그대로 반환 (트레이스 / 갱신 요청 없음) */
+	const FClimbProbeSnapshot& GetClimbProbeSnapshot() const { return ClimbProbeSnapshot; }
+
+	/**
+	 * 프로브 결과를 읽고 다음 틱 갱신을 요청
+	 * 지난 프레임보다 오래된 스냅샷 (처음 읽거나 한동안 아무도 읽지 않은 경우) 은 그 자리에서 갱신해 반환하므로,
+	 * 매 틱 읽는 쪽도 최대 한 프레임 늦은 값만 보게 된다.
+	 */
+	const FClimbProbeSnapshot& RequestClimbProbeSnapshot();
+
+	/** 등반 판정 규칙에 쓰이는 튜닝 값 (오너가 없는 CDO 에서는 눈높이가 기본값) */
+	FClimbRuleSettings GetClimbRuleSettings() const;
+
+#pragma region Climb Route
+
+	/** AI 용: 등반 경로 플래너가 만든 경로를 따라 이동 (입력 / 등반 동작을 직접 구동) */
+	void FollowClimbRoute(const TArray<FClimbRouteWaypoint>& InRoute, FOnClimbRouteFinished InOnFinished = FOnClimbRouteFinished());
+	void AbortClimbRoute();
+
+	FORCEINLINE bool IsFollowingClimbRoute() const { return ActiveClimbRoute.IsValidIndex(ActiveClimbRouteIndex); }
+
+#pragma endregion
+
+#pragma region Climb Profile
+
+	/** 프로필 / 몽타주 변형을 교체하고 수치를 적용한 뒤 몽타주를 다시 비동기 로드 */
+	void SetClimbProfile(UClimbProfileDataAsset* InClimbProfile, FName InVariant = NAME_None);
+
+	FORCEINLINE UClimbProfileDataAsset* GetClimbProfile() const { return ClimbProfile; }
+	FORCEINLINE bool AreClimbMontagesLoaded() const { return bClimbMontagesLoaded; }
+
+#pragma endregion
+
+#pragma region Tick Policy
+
+	/** 정지 상태로 낮춘 틱을 즉시 복구 (점프처럼 이동 컴포넌트를 거치지 않는 요청용) */
+	void WakeClimbTick();
+
+	FORCEINLINE bool IsClimbTickSleeping() const { return ClimbTickState == EClimbTickState::Sleeping; }
+
+	/** 등반 품질 설정이 바뀌면 이전 품질로 만든 프로브 캐시를 버리고 틱 간격을 다시 적용 */
+	void OnClimbQualityChanged();
+
+	const FClimbQualitySettings& GetClimbProbeQuality() const;
+
+	virtual void AddInputVector(FVector WorldVector, bool bForce = false) override;
+	virtual void AddImpulse(FVector Impulse, bool bVelocityChange = false) override;
+	virtual void AddForce(FVector Force) override;
+	virtual void Launch(FVector const& LaunchVel) override;
+	virtual void RequestDirectMove(const FVector& MoveVelocity, bool bForceMaxSpeed) override;
+	virtual void RequestPathMove(const FVector& MoveInput) override;
+	virtual void SmoothCorrection(const FVector& OldLocation, const FQuat& OldRotation, const FVector& NewLocation, const FQuat& NewRotation) override;
+
+#pragma endregion
+
+#pragma region Diagnostics
+
+	/** 마지막 TickComponent 한 번에 걸린 시간 (초) */
+	FORCEINLINE double GetLastClimbTickSeconds() const { return LastClimbTickSeconds; }
+	FORCEINLINE bool IsInCornerTransition() const { return bCornerTransitionActive; }
+
+#if !UE_BUILD_SHIPPING
+	/**
+	 * 등반 상태 머신의 불변식 검사 (소크 하네스용, 쉬핑 빌드에서는 제외)
+	 * 캡슐 반높이 / 회전 / 이동 모드와 상태 플래그가 서로 맞지 않으면 false 와 실패 사유를 반환
+	 */
+	bool ValidateClimbState(FString& OutFailure) const;
+#endif
+
+#pragma endregion
 
 protected:
 
@@ -57,8 +190,46 @@ protected:
 private:
 #pragma region ClimbTraces
 
-	TArray<FHitResult> DoCapsuleTraceMultiByObject(const FVector& Start, const FVector& End, bool bInShowDebugShape, bool bInDrawPersistantShapes);
-	FHitResult DoLineTraceSingleByObject(const FVector& Start, const FVector& End, bool bInShowDebugShape, bool bInDrawPersistantShapes);
+	TArray<FHitResult> DoCapsuleTraceMultiByChannel(const FVector& Start, const FVector& End, bool bInShowDebugShape, bool bInDrawPersistantShapes, bool bIgnoreNonClimbableSurfaces = true, float ShapeScale = 1.f);
+	/** 캡슐 스윕 대신 캡슐 높이 세 곳에서 라인 트레이스 (저품질 벽면 프로브) */
+	TArray<FHitResult> DoLineProbeTraceMultiByChannel(const FVector& Start, const FVector& End, bool bInShowDebugShape, bool bInDrawPersistantShapes);
+	FHitResult DoLineTraceSingleByChannel(const FVector& Start, const FVector& End, bool bInShowDebugShape, bool bInDrawPersistantShapes);
+
+	/** 현재 캡슐 위치 / 방향 기준의 판정 자세 */
+	FClimbProbePose GetClimbProbePose() const;
+
+	void AddClimbQueryIgnoredOwner(FCollisionQueryParams& QueryParams) const;
+
+	friend class FClimbMovementRuleTracer;
+
+#pragma endregion
+
+#pragma region Climb Profile Internal
+
+	void ApplyClimbProfileTuning();
+	FClimbMontageSet GetComponentClimbMontages() const;
+	void RequestClimbMontages();
+	void OnClimbMontagesLoaded();
+
+	/** 로드 중 / 로드된 몽타주를 붙잡아 두는 핸들 */
+	TSharedPtr<FStreamableHandle> ClimbMontagesHandle;
+	FClimbMontageSet ActiveClimbMontages;
+
+	/** EClimbAction 순서로 로드된 몽타주 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAnimMontage>> LoadedClimbMontages;
+
+	bool bClimbMontagesRequested = false;
+	bool bClimbMontagesLoaded = false;
+
+#pragma endregion
+
+#pragma region Landscape
+
+	ALandscapeProxy* GetTrackedLandscape() const;
+	bool TraceLandscapeClimbableSurfaces(const ALandscapeProxy* Landscape);
+	bool CheckHasReachedLandscapeFloor(const ALandscapeProxy* Landscape) const;
+	bool CanTopOutOnLandscape(const ALandscapeProxy* Landscape) const;
 
 #pragma endregion
 
@@ -69,21 +240,24 @@ private:
 	bool CheckShouldStopClimbing();
 	bool CheckHasReachedFloor();
 	bool CheckHasReachedLedge();
+	bool CanTopOut();
 	bool CanClimbDownLedge();
 	bool CanStartVaulting(FVector& OutVaultStartPosition, FVector& OutVaultLandPosition);
-	bool CheckCanHopUp(FVector& OutHopUpTargetPosition);
-	bool CheckCanHopDown(FVector& OutHopDownTargetPosition);
 
 	void TryStartVaulting();
 	void StartClimbing();
 	void StopClimbing();
 	void PhysClimb(float deltaTime, int32 Iterations);
 	void ProcessClimbableSurfaceInfo();
+	void UpdateClimbSurfaceBase();
+	bool CanReuseClimbSurfaceCache() const;
+	void RestoreClimbSurfaceFromBase();
+	bool SampleClimbSurfaceFromDistanceField();
 	void SnapMovementToClimbableSurfaces(float DeltaTime);
 	void PlayClimbMontage(TObjectPtr<UAnimMontage> MontageToPlay);
 	void SetMotionWarpTarget(const FName& InWarpTargetName, const FVector& InTargetPosition);
-	void HandleHopUp();
-	void HandleHopDown();
+
+	void RefreshClimbProbeSnapshot();
 
 	FHitResult TraceFromEyeHeight(float TraceDistance, float TraceStartOffset = 0.f, bool bInShowDebugShape = false, bool bInDrawPersistantShapes = false);
 	FQuat GetClimbRotation(float DeltaTime);
@@ -91,6 +265,356 @@ private:
 	UFUNCTION()
 	void OnClimbMontageEnded(UAnimMontage* Montage, bool bInterrupted);
 
+	/** PlayClimbMontage 로 재생 중인 동작 몽타주와 그 동작 (종료 처리는 현재 프로필이 아니라 이 기록과 비교) */
+	UPROPERTY()
+	TObjectPtr<UAnimMontage> PlayingClimbActionMontage;
+	EClimbAction PlayingClimbAction = EClimbAction::EnterClimb;
+
+#pragma endregion
+
+#pragma region Hop
+
+	bool HandleHop(EClimbHopDirection Direction);
+	void StartHop(EClimbHopDirection Direction, const FVector& TargetPosition);
+	bool FindHopTarget(const FVector2D& InputDirection, EClimbHopDirection& OutDirection, FVector& OutTargetPosition);
+	bool TraceHopCandidate(EClimbHopDirection Direction, FVector& OutTargetPosition);
+	void GetHopTrace(EClimbHopDirection Direction, bool bSafetyTrace, FVector& OutStart, FVector& OutEnd) const;
+
+	bool IsHopCandidateCacheValid() const;
+	bool GetCachedHopCandidate(EClimbHopDirection Direction, FVector& OutTargetPosition) const;
+	bool HasHopMontage(EClimbHopDirection Direction) const;
+	void UpdateHopCandidates();
+	void RequestHopCandidateTraces();
+	void OnHopCandidateTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void InvalidateHopCandidates();
+
+	struct FClimbHopCandidate
+	{
+		FVector TargetPosition = FVector::ZeroVector;
+		bool bHopHit = false;
+		/** 위로 향하는 홉만 필요: 도착 지점 위에도 잡을 벽이 있는지 */
+		bool bSafetyHit = false;
+		bool bReachable = false;
+	};
+
+	static constexpr int32 NumHopDirections = 8;
+
+	/**
+	 * 8방향 후보를 한 번의 비동기 트레이스 묶음으로 평가한 결과
+	 * 등반자가 HopCacheInvalidateDistance 이상 움직이기 전까지 재사용한다.
+	 */
+	FClimbHopCandidate HopCandidates[NumHopDirections];
+	FClimbHopCandidate PendingHopCandidates[NumHopDirections];
+	FVector HopCandidatesProbeLocation = FVector::ZeroVector;
+	FQuat HopCandidatesProbeRotation = FQuat::Identity;
+	FVector PendingHopProbeLocation = FVector::ZeroVector;
+	FQuat PendingHopProbeRotation = FQuat::Identity;
+
+	FTraceDelegate HopTraceDelegate;
+	uint32 HopTraceBatch = 0;
+	int32 PendingHopTraceCount = 0;
+	bool bHasHopCandidates = false;
+	bool bHopCandidatesRequested = false;
+
+#pragma endregion
+
+#pragma region Spline Climb
+
+	/** 앞에 사다리 / 파이프가 있으면 그 스플라인에 붙어 MOVE_SplineClimb 시작 */
+	bool TryStartSplineClimb();
+	void StartSplineClimb(AClimbSplineActor* ClimbSpline);
+	void PhysSplineClimb(float deltaTime, int32 Iterations);
+	void ExitSplineClimbAtTop(const AClimbSplineActor* ClimbSpline);
+
+	TWeakObjectPtr<AClimbSplineActor> ActiveClimbSpline;
+	float SplineClimbDistance = 0.f;
+	float SplineClimbAngle = 0.f;
+
+#pragma endregion
+
+#pragma region Ledge Shimmy
+
+	/** 등반 중 렛지에 도달했을 때: 매달릴 렛지가 있으면 MOVE_Shimmy, 없으면 TopOut */
+	void HandleReachedLedge();
+	bool TryStartShimmy();
+	void UpdateShimmyInput(float DeltaTime);
+	bool TryDropFromShimmy();
+	void PhysShimmy(float deltaTime, int32 Iterations);
+
+	/** 활성 렛지의 거리 위치를 월드로 평가 (렛지 컴포넌트 기준이므로 움직이는 베이스도 따라감) */
+	bool EvaluateShimmyLedge(float Distance, FVector& OutLipLocation, FVector& OutNormal, FVector& OutTangent) const;
+	FVector GetShimmyHangLocation(const FVector& LipLocation, const FVector& LedgeNormal) const;
+
+	TWeakObjectPtr<UPrimitiveComponent> ShimmyLedgeComponent;
+	FClimbLedgePolyline ActiveShimmyLedge;
+	float ShimmyDistance = 0.f;
+
+	/** 가장자리 진행 방향 부호 있는 속력 (꼭짓점에서 진행 방향이 꺾여도 유지) */
+	float ShimmySpeed = 0.f;
+	float ShimmyTopOutHeldTime = 0.f;
+
+#pragma endregion
+
+#pragma region Ledge Catch
+
+	void UpdateLedgeCatch();
+	void RequestLedgeCatchProbes();
+	void OnLedgeCatchTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void InvalidateLedgeCatchProbes();
+
+	/** 예측 궤적에서 찾은 렛지가 지금 손 닿는 범위에 들어왔으면 벽을 확인하고 잡기 시작 */
+	bool TryLedgeCatch();
+
+	/** 등반을 놓은 직후 LedgeCatchRegrabCooldown 동안은 같은 벽을 다시 잡지 않음 */
+	bool IsLedgeCatchOnCooldown() const;
+
+	static constexpr int32 MaxLedgeCatchSamples = 8;
+
+	struct FLedgeCatchSample
+	{
+		FVector LedgeTop = FVector::ZeroVector;
+		bool bHit = false;
+	};
+
+	/**
+	 * 공중에서 앞으로의 포물선 위 몇 지점 앞을 내려다본 비동기 트레이스 결과
+	 * 묶음이 모두 도착하면 가장 이른 시점의 렛지를 후보로 삼는다.
+	 */
+	FLedgeCatchSample PendingLedgeCatchSamples[MaxLedgeCatchSamples];
+	FVector LedgeCatchLedgeTop = FVector::ZeroVector;
+	FVector LedgeCatchDirection = FVector::ZeroVector;
+	FVector PendingLedgeCatchDirection = FVector::ZeroVector;
+
+	FTraceDelegate LedgeCatchTraceDelegate;
+	uint32 LedgeCatchTraceBatch = 0;
+	int32 PendingLedgeCatchTraceCount = 0;
+	int32 PendingLedgeCatchSampleCount = 0;
+	bool bHasLedgeCatchCandidate = false;
+
+	/** 자동 캐치가 꺼져 있을 때 이번 낙하에서 TryClimbAction(LedgeCatch) 가 들어왔는지 (이때만 프로브) */
+	bool bLedgeCatchRequested = false;
+
+	/** 마지막으로 등반 모드를 벗어난 월드 시간 */
+	double LastClimbReleaseTime = -UE_BIG_NUMBER;
+
+#pragma endregion
+
+#pragma region Climb Prediction
+
+	friend struct FClimbActionPredictionScope;
+
+	/** 원격 클라이언트의 자기 캐릭터만 등반 동작을 예측 */
+	bool ShouldPredictClimbActions() const;
+	void SendClimbActionPrediction(const FVector& StartLocation, const FQuat& StartRotation, EMovementMode PreviousMovementMode, uint8 PreviousCustomMode);
+	bool FindClimbActionForMontage(const UAnimMontage* Montage, EClimbAction& OutAction) const;
+	void ValidateClimbActionPrediction(const FClimbActionPrediction& Prediction);
+	void UpdateQueuedClimbAction(float DeltaTime);
+	void TickClimbCorrectionBlend(float DeltaTime);
+
+	UFUNCTION(Server, Reliable)
+	void ServerRequestClimbAction(const FClimbActionPrediction& Prediction);
+
+	UFUNCTION(Server, Reliable)
+	void ServerStartSplineClimb(AClimbSplineActor* ClimbSpline);
+
+	UFUNCTION(Server, Reliable)
+	void ServerStopClimbing();
+
+	UFUNCTION(Server, Reliable)
+	void ServerDropFromShimmy();
+
+	UFUNCTION(Server, Reliable)
+	void ServerLedgeCatch(FVector_NetQuantize10 LedgeTop, FVector_NetQuantizeNormal Direction);
+
+	/** @param ServerWarpTargets 비어 있지 않으면 서버 타겟이 허용 오차를 벗어난 것 (재생 중인 워핑을 서버 타겟으로 보정) */
+	UFUNCTION(Client, Reliable)
+	void ClientConfirmClimbAction(uint8 PredictionId, const TArray<FClimbPredictedWarpTarget>& ServerWarpTargets);
+
+	UFUNCTION(Client, Reliable)
+	void ClientRejectClimbAction(uint8 PredictionId);
+
+	/** 이번 동작 시도에서 지정한 워프 타겟 (예측 요청 / 서버 검증에 사용) */
+	TArray<FClimbPredictedWarpTarget> RecentWarpTargets;
+
+	/** 마지막 홉 방향 (대각선 홉도 위 / 아래 몽타주를 쓰므로 따로 기록) */
+	EClimbHopDirection LastHopDirection = EClimbHopDirection::Up;
+
+	/** 서버 응답을 기다리는 예측 (거절되면 이 상태로 되돌림) */
+	struct FPendingClimbPrediction
+	{
+		TWeakObjectPtr<UAnimMontage> Montage;
+		FVector StartLocation = FVector::ZeroVector;
+		FQuat StartRotation = FQuat::Identity;
+		TEnumAsByte<EMovementMode> PreviousMovementMode = MOVE_None;
+		uint8 PreviousCustomMode = 0;
+		uint8 PredictionId = 0;
+		bool bActive = false;
+	};
+
+	FPendingClimbPrediction PendingClimbPrediction;
+
+	/** 서버: 이전 동작이 끝나길 기다리는 요청 (하나만 보류, 새 요청이 오면 이전 것은 거절) */
+	struct FQueuedClimbAction
+	{
+		FClimbActionPrediction Prediction;
+		float TimeRemaining = 0.f;
+		bool bActive = false;
+	};
+
+	FQueuedClimbAction QueuedClimbAction;
+	uint8 NextClimbPredictionId = 0;
+	bool bInClimbActionPredictionScope = false;
+
+	/** 거절되어 멈춘 몽타주 (블렌드 아웃 / 종료 이벤트가 상태를 바꾸지 않도록) */
+	UPROPERTY()
+	TObjectPtr<UAnimMontage> RolledBackClimbMontage;
+
+	/** 되돌린 뒤 메시에 남겨 두고 줄여 가는 월드 오프셋 */
+	FVector ClimbCorrectionOffset = FVector::ZeroVector;
+	float ClimbCorrectionBlendRemaining = 0.f;
+
+#pragma endregion
+
+#pragma region Baked Transition
+
+	bool UsesBakedClimbTransitions() const;
+	bool StartBakedClimbTransition(UAnimMontage* Montage, const TOptional<FVector>& EndLocation = TOptional<FVector>());
+	void UpdateBakedClimbTransition();
+	void FinishBakedClimbTransition(bool bInterrupted);
+	void UpdateServerPoseTicking();
+
+	/** 재생 중인 구운 전환 (몽타주 대신 루트 모션 소스로 재생) */
+	UPROPERTY()
+	TObjectPtr<UAnimMontage> ActiveClimbTransitionMontage;
+	uint16 ActiveClimbTransitionSourceId = 0;
+
+	/** 포즈 틱 설정을 마지막으로 맞춘 컨트롤러 (빙의가 바뀌면 다시 판단) */
+	TWeakObjectPtr<AController> PoseTickController;
+	EVisibilityBasedAnimTickOption DefaultMeshAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+
+#pragma endregion
+
+#pragma region Corner
+
+	void UpdateCornerPrefetch();
+	bool IsCornerPrefetchValid(float LateralSign) const;
+	float GetClimbLateralInputSign() const;
+	void RequestCornerPrefetch(float LateralSign);
+	void OnCornerTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void ResolveCornerPrefetch();
+	void InvalidateCornerPrefetch();
+
+	bool TryStartCornerTransition();
+	void StartCornerTransitionLeg();
+	void TickCornerTransition(float DeltaTime);
+	void StopCornerTransition();
+
+	/** 진행 방향으로 미리 트레이스해 둔 모서리 정보 */
+	struct FClimbCornerPrefetch
+	{
+		EClimbCornerType Type = EClimbCornerType::None;
+		/** 새 면 위의 한 점 (진입 거리 계산용) */
+		FVector FacePoint = FVector::ZeroVector;
+		FVector FaceNormal = FVector::ZeroVector;
+		FVector TargetLocation = FVector::ZeroVector;
+		FVector ProbeLocation = FVector::ZeroVector;
+		FQuat ProbeRotation = FQuat::Identity;
+		FVector LateralDirection = FVector::ZeroVector;
+		float WallDistance = 0.f;
+		float LateralSign = 0.f;
+		bool bValid = false;
+	};
+
+	static constexpr int32 NumCornerTraces = 3;
+
+	FClimbCornerPrefetch CornerPrefetch;
+	FClimbCornerPrefetch PendingCornerPrefetch;
+	FHitResult PendingCornerHits[NumCornerTraces];
+	FVector PendingCornerSurfaceNormal = FVector::ZeroVector;
+	FTraceDelegate CornerTraceDelegate;
+	uint32 CornerTraceBatch = 0;
+	int32 PendingCornerTraceCount = 0;
+
+	/** 진행 중인 모서리 전환 (루트 모션 소스 구간들) */
+	TArray<FVector, TInlineAllocator<2>> CornerTransitionWaypoints;
+	TArray<float, TInlineAllocator<2>> CornerTransitionLegEndTimes;
+	int32 CornerTransitionLeg = INDEX_NONE;
+	float CornerTransitionElapsed = 0.f;
+	float CornerTransitionDurationTotal = 0.f;
+	FQuat CornerTransitionStartRotation = FQuat::Identity;
+	FQuat CornerTransitionTargetRotation = FQuat::Identity;
+	FVector CornerTransitionTargetNormal = FVector::ZeroVector;
+	uint16 CornerRootMotionSourceId = 0;
+	bool bCornerTransitionActive = false;
+
+#pragma endregion
+
+#pragma region Async Physics
+
+	/** 이번 틱 등반 이동을 물리 스레드 콜백에 맡길 수 있는지 (루트 모션 / 모서리 전환 / 움직이는 표면 / 조종 중인 플레이어는 게임 스레드) */
+	bool ShouldUseAsyncClimbPhysics() const;
+	void PhysClimbAsync(float deltaTime, int32 Iterations);
+
+	/** 재프로브가 필요할 때만 표면을 트레이스하고 바닥 / 렛지 높이를 미리 구해 표면 모델을 갱신 */
+	void RefreshAsyncClimbSurfaceModel();
+	void PrefetchAsyncClimbFloorAndLedge();
+	void ApplyAsyncClimbTransition(EClimbAsyncTransition Transition);
+	void ReleaseAsyncClimber();
+
+	/** 등반 표면이 움직이는 베이스인지 (물리 스레드 상태는 월드 공간이라 베이스 이동을 따라가지 못함) */
+	bool IsClimbingOnDynamicBase() const;
+
+	UPROPERTY()
+	TObjectPtr<UClimbAsyncPhysicsSubsystem> ClimbAsyncPhysicsSubsystem;
+
+	/** 물리 스레드로 보내는 입력 (표면 모델은 재프로브 사이에 유지) */
+	FClimbAsyncClimberInput AsyncClimbInput;
+	uint32 AsyncClimberId = 0;
+	bool bAsyncClimbNeedsReset = true;
+
+#pragma endregion
+
+#pragma region Tick Policy Internal
+
+	void UpdateClimbTickPolicy(float DeltaTime);
+	void SetClimbTickState(EClimbTickState NewState);
+	bool CanClimbTickSleep() const;
+	bool IsStationary() const;
+	void OnSleepingTransformUpdated(USceneComponent* InUpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+	void OnSleepingBaseCollisionChanged(UPrimitiveComponent* ChangedComponent);
+
+	UFUNCTION()
+	void OnSleepingBasePhysicsStateChanged(UPrimitiveComponent* ChangedComponent, EComponentPhysicsStateChange StateChange);
+
+	void UnbindSleepingMovementBase();
+
+	EClimbTickState ClimbTickState = EClimbTickState::Active;
+	float ClimbStationaryTime = 0.f;
+	bool bClampNextTickDeltaTime = false;
+	double LastClimbTickSeconds = 0.0;
+	float AwakeMeshTickInterval = 0.f;
+
+	FDelegateHandle SleepingTransformUpdatedHandle;
+	FDelegateHandle SleepingBaseTransformUpdatedHandle;
+	FDelegateHandle SleepingBaseCollisionChangedHandle;
+	TWeakObjectPtr<UPrimitiveComponent> SleepingMovementBase;
+
+#pragma endregion
+
+#pragma region Climb Route Internal
+
+	void TickClimbRoute(float DeltaTime);
+	void TickClimbRouteAction(const FClimbRouteWaypoint& Waypoint, const FVector& ToWaypoint);
+	void AdvanceClimbRoute();
+	void FinishClimbRoute(bool bSuccess);
+
+	TArray<FClimbRouteWaypoint> ActiveClimbRoute;
+	int32 ActiveClimbRouteIndex = INDEX_NONE;
+	float ClimbRouteClosestDistance = TNumericLimits<float>::Max();
+	float ClimbRouteStuckTime = 0.f;
+	bool bClimbRouteActionIssued = false;
+	FOnClimbRouteFinished OnClimbRouteFinished;
+
 #pragma endregion
 
 #pragma region Climb Core Variable
@@ -98,10 +622,44 @@ private:
 	TArray<FHitResult> ClimbableSurfacesTracedResults;
 	FVector CurrentClimbableSurfaceLocation;
 	FVector CurrentClimbableSurfaceNormal;
+	FClimbSurfaceProperties CurrentClimbSurfaceProperties;
+
+	/**
+	 * 마지막 프로브 결과를 표면 프리미티브의 로컬 공간에 저장한 캐시
+	 * 캐릭터가 베이스 기준으로 움직이지 않았다면 다시 트레이스하지 않고 베이스 트랜스폼으로 복원한다.
+	 */
+	TWeakObjectPtr<UPrimitiveComponent> ClimbSurfaceBase;
+	FVector LocalClimbableSurfaceLocation = FVector::ZeroVector;
+	FVector LocalClimbableSurfaceNormal = FVector::ZeroVector;
+	FVector LocalClimbProbeLocation = FVector::ZeroVector;
+	FQuat LocalClimbProbeRotation = FQuat::Identity;
+	bool bHasClimbSurfaceCache = false;
+
+	FClimbProbeSnapshot ClimbProbeSnapshot;
+	bool bClimbProbeSnapshotRequested = false;
+
+	/** 스냅샷의 트레이스 판정을 마지막으로 새로 한 자세 */
+	FVector SnapshotProbeLocation = FVector::ZeroVector;
+	FQuat SnapshotProbeRotation = FQuat::Identity;
+	double SnapshotProbeTime = 0.0;
+	TEnumAsByte<EMovementMode> SnapshotMovementMode = MOVE_None;
+	uint8 SnapshotCustomMovementMode = 0;
 
 	UPROPERTY()
 	TObjectPtr<UAnimInstance> OwningPlayerAnimInstance;
 
+	UPROPERTY()
+	TObjectPtr<UClimbSurfaceSubsystem> ClimbSurfaceSubsystem;
+
+	UPROPERTY()
+	TObjectPtr<UClimbQueryCacheSubsystem> ClimbQueryCacheSubsystem;
+
+	UPROPERTY()
+	TObjectPtr<UClimbLedgeSubsystem> ClimbLedgeSubsystem;
+
+	UPROPERTY()
+	TObjectPtr<UClimbDistanceFieldSubsystem> ClimbDistanceFieldSubsystem;
+
 	UPROPERTY()
 	TObjectPtr<AClimbingSystemCharacter> OwningPlayerCharacter;
 
@@ -109,8 +667,9 @@ private:
 
 #pragma region Climb BP Variables
 
+	/** 등반 프로브 전용 채널. 단순화된 등반 프록시(UClimbProxyBoxComponent 등)만 응답하도록 설정할 수 있다. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
-	TArray<TEnumAsByte<EObjectTypeQuery>> ClimbableSurfaceTraceTypes;
+	TEnumAsByte<ECollisionChannel> ClimbTraceChannel = ECC_Climb;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
 	float ClimbCapsuleTraceRadius = 50.f;
@@ -136,23 +695,98 @@ private:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
 	float MaxClimbableSurfaceAngle = 60.f;
 
+	/** 좌우로 등반할 때 모서리를 미리 찾는 거리 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<UAnimMontage> IdleToClimbMontage;
+	float CornerProbeDistance = 80.f;
 
+	/** 현재 면과 이 각도(도) 이상 차이 나는 면만 모서리로 판단 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<UAnimMontage> ClimbToTopMontage;
+	float CornerMinAngle = 30.f;
 
+	/** 모서리까지 남은 거리가 이 값 이하가 되면 전환 시작 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<UAnimMontage> ClimbDownLedgeMontage;
+	float CornerTriggerDistance = 20.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
+	float CornerTransitionDuration = 0.3f;
+
+	/** 베이스 기준으로 이 거리 이상 움직였을 때만 표면을 다시 트레이스 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
+	float ClimbReprobeDistance = 2.f;
+
+	/** 베이스 기준으로 이 각도(도) 이상 회전했을 때만 표면을 다시 트레이스 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
+	float ClimbReprobeAngle = 2.f;
+
+	/**
+	 * 정적 등반 표면에서는 재프로브 시 스윕 대신 거리장에서 표면 위치 / 법선을 읽음.
+	 * 마지막 스윕 위치에서 ClimbDistanceFieldResweepDistance 이상 멀어졌거나 법선이 크게 달라지면 다시 스윕한다.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
+	bool bUseClimbDistanceField = true;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true", EditCondition = "bUseClimbDistanceField"))
+	float ClimbDistanceFieldResweepDistance = 50.f;
+
+	/** 거리장 법선이 마지막 스윕 법선과 이 각도(도) 이상 다르면 (모서리 / 다른 표면) 다시 스윕 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true", EditCondition = "bUseClimbDistanceField"))
+	float ClimbDistanceFieldMaxNormalDeviation = 20.f;
+
+	/** 지정하면 아래 수치 / 몽타주 대신 프로필 값을 사용 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UClimbProfileDataAsset> ClimbProfile;
+
+	/** ClimbProfile 의 MontageVariants 에서 사용할 몽타주 세트 이름 (None 이면 기본 세트) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
+	FName ClimbProfileVariant;
+
+	/** false 이면 처음 등반 / 볼팅을 시도할 때 몽타주를 로드 (거의 등반하지 않는 캐릭터용) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
+	bool bPreloadClimbMontages = true;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> IdleToClimbMontage;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> ClimbToTopMontage;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> ClimbDownLedgeMontage;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> VaultMontage;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> HopUpMontage;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> HopDownMontage;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> HopLeftMontage;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<UAnimMontage> VaultMontage;
+	TSoftObjectPtr<UAnimMontage> HopRightMontage;
 
+	/** 대각선 홉 (비어 있으면 HopUp / HopDown 몽타주를 옆으로 워핑) */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<UAnimMontage> HopUpMontage;
+	TSoftObjectPtr<UAnimMontage> HopUpLeftMontage;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<UAnimMontage> HopDownMontage;
+	TSoftObjectPtr<UAnimMontage> HopUpRightMontage;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> HopDownLeftMontage;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> HopDownRightMontage;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Catch", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> LedgeCatchMontage;
+
+	/** 매달린 렛지에서 아래 벽면 등반으로 내려갈 때 (비어 있으면 몽타주 없이 바로 등반) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Shimmy", meta = (AllowPrivateAccess = "true"))
+	TSoftObjectPtr<UAnimMontage> ShimmyDropMontage;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
 	int32 VaultTraceSteps = 5;
@@ -172,5 +806,132 @@ private:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
 	FName HopDownTargetPointName = FName("HopDownTargetPoint");
 
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
+	FName HopLateralTargetPointName = FName("HopLateralTargetPoint");
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Catch", meta = (AllowPrivateAccess = "true"))
+	FName LedgeCatchPointName = FName("LedgeCatchPoint");
+
+	/** 스플라인의 등반 위치가 캡슐 중심에서 이 거리 안이면 사다리 / 파이프를 잡음 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Spline Climb", meta = (AllowPrivateAccess = "true"))
+	float SplineGrabDistance = 80.f;
+
+	/** 등반 중 렛지에 도달하면 바로 올라서는 대신 매달려 가장자리를 따라 옆으로 이동 (위 입력을 유지하면 TopOut) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Shimmy", meta = (AllowPrivateAccess = "true"))
+	bool bEnableLedgeShimmy = true;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Shimmy", meta = (AllowPrivateAccess = "true"))
+	float MaxShimmySpeed = 80.f;
+
+	/** 매달린 캡슐 중심의 가장자리 기준 위치 (벽에서 바깥으로, 가장자리 아래로) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Shimmy", meta = (AllowPrivateAccess = "true"))
+	FVector2D ShimmyHangOffset = FVector2D(50.f, 80.f);
+
+	/** 꼭짓점 앞뒤 이 거리에서 방향을 섞어 바깥 / 안쪽 모서리를 부드럽게 돎 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Shimmy", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float ShimmyCornerBlendDistance = 20.f;
+
+	/** 눈높이에서 이 거리 안의 렛지만 잡음 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Shimmy", meta = (AllowPrivateAccess = "true"))
+	float ShimmyGrabDistance = 100.f;
+
+	/** 매달린 상태에서 위 입력을 이 시간 동안 유지하면 TopOut */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Shimmy", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float ShimmyTopOutHoldTime = 0.2f;
+
+	/** 점프 / 낙하 중 손 닿는 범위에 렛지가 들어오면 자동으로 잡음 (false 면 TryClimbAction(LedgeCatch) 로만) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Catch", meta = (AllowPrivateAccess = "true"))
+	bool bAutoLedgeCatch = false;
+
+	/** 등반을 놓거나 벽에서 뛰어내린 뒤 렛지를 다시 잡지 않는 시간 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Catch", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float LedgeCatchRegrabCooldown = 0.5f;
+
+	/** 포물선을 앞으로 예측하는 시간과 그 사이 프로브 지점 수 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Catch", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float LedgeCatchPredictionTime = 0.3f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Catch", meta = (AllowPrivateAccess = "true", ClampMin = "1", ClampMax = "8"))
+	int32 LedgeCatchNumSamples = 3;
+
+	/** 캡슐 앞 이 거리 안의 렛지만 잡음 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Catch", meta = (AllowPrivateAccess = "true"))
+	float LedgeCatchReach = 60.f;
+
+	/** 렛지 윗면이 눈높이 기준 이 범위 (아래, 위) 안에 있을 때 잡음 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Ledge Catch", meta = (AllowPrivateAccess = "true"))
+	FVector2D LedgeCatchEyeWindow = FVector2D(-30.f, 40.f);
+
+	/** 좌우 / 대각선 홉의 옆 이동 거리 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
+	float HopLateralDistance = 150.f;
+
+	/** 홉 후보 캐시를 만든 위치에서 이 거리 이상 움직이면 다시 평가 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Vaulting", meta = (AllowPrivateAccess = "true"))
+	float HopCacheInvalidateDistance = 20.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing AI", meta = (AllowPrivateAccess = "true"))
+	float ClimbRouteAcceptanceRadius = 40.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing AI", meta = (AllowPrivateAccess = "true"))
+	float ClimbRouteStuckTimeout = 3.f;
+
+	/** 프로브 스냅샷의 트레이스 판정 (등반 시작 / 볼팅 / 탑아웃 등) 을 자세가 그대로여도 다시 하는 간격 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing AI", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float ClimbProbeSnapshotInterval = 0.25f;
+
+	/** 이 거리 / 각도 이상 움직이면 간격과 상관없이 스냅샷 판정을 다시 함 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing AI", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float ClimbProbeSnapshotReprobeDistance = 20.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Climbing AI", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float ClimbProbeSnapshotReprobeAngle = 10.f;
+
+	/**
+	 * 등반 중 표면 추종 / 바닥 · 렛지 판정 / 상태 전환을 Chaos 물리 스레드 콜백에서 고정 간격으로 시뮬레이션한다.
+	 * 게임 스레드는 재프로브 때만 씬 쿼리를 하고 결과 보간 / 몽타주만 담당한다. 독립 실행 또는 서버의 AI 캐릭터에만 적용된다.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Async Physics", meta = (AllowPrivateAccess = "true"))
+	bool bUseAsyncClimbPhysics = false;
+
+	/** 충돌로 물리 스레드 결과와 실제 위치가 이 거리 이상 벌어지면 물리 스레드 상태를 재설정 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Async Physics", meta = (AllowPrivateAccess = "true"))
+	float AsyncClimbResyncDistance = 10.f;
+
+	/** 정지한 캐릭터의 이동 / 애니메이션 틱을 재우거나 낮춤 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Tick Policy", meta = (AllowPrivateAccess = "true"))
+	bool bEnableClimbTickPolicy = true;
+
+	/** 이 시간 동안 계속 정지해 있어야 틱을 낮춤 (입력 사이 짧은 정지에서 깨어났다 잠들기를 반복하지 않도록) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Tick Policy", meta = (AllowPrivateAccess = "true"))
+	float StationaryTimeBeforeSleep = 0.5f;
+
+	/** 등반 중 매달려 정지해 있을 때의 틱 간격 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Tick Policy", meta = (AllowPrivateAccess = "true"))
+	float ClimbIdleTickInterval = 0.1f;
+
+	/** 잠든 동안 메시의 틱 간격 (0 이면 매 프레임). 데디케이티드 서버에서는 메시 틱을 끈다. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Tick Policy", meta = (AllowPrivateAccess = "true"))
+	float SleepingMeshTickInterval = 0.f;
+
+	/**
+	 * 데디케이티드 서버에서 서버가 직접 조종하는 캐릭터 (AI) 는 몽타주 대신 구운 루트 모션 소스로 등반 동작을 재생하고
+	 * 포즈 틱을 끈다. 상태 전환은 몽타주 이벤트 대신 루트 모션 소스 완료 시점에 일어난다.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Tick Policy", meta = (AllowPrivateAccess = "true"))
+	bool bUseBakedClimbTransitionsOnServer = true;
+
+	/** 클라이언트가 예측한 워프 타겟이 서버 타겟과 이 거리 안이면 클라이언트 타겟을 그대로 씀 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Networking", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float PredictedWarpTargetTolerance = 30.f;
+
+	/** 서버가 예측한 동작을 거절했을 때 메시를 되돌린 위치로 블렌드하는 시간 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Networking", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float ClimbCorrectionBlendTime = 0.15f;
+
+	/** 서버가 이전 동작이 끝나길 기다리며 연속 동작 요청을 보류하는 최대 시간 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Character Movement | Networking", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float ClimbActionQueueTimeout = 0.5f;
+
 #pragma endregion
 };
\ No newline at end of file
@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BasicReplicationGraph.h"
+#include "ClimbReplicationGraph.generated.h"
+
+class ACharacter;
+class UCustomMovementComponent;
+
+/**
+ * 등반 캐릭터의 커넥션별 리플리케이션 주기를 정하는 노드
+ *
+ * 캐릭터는 그리드 노드가 공간 분할로 모으고, 이 노드는 그리드 다음에 수집되어 이미 모인 목록 중 등반 캐릭터의
+ * 주기(프레임)만 뷰어와의 거리 / 등반 속도로 바꾼다 (스스로 목록을 추가하지 않음).
+ * 멀리서 멈춰 있거나 천천히 오르는 캐릭터는 드물게 보내고, 등반 동작(홉 / 볼팅 / 탑아웃) 중이거나
+ * 자기 자신을 보는 커넥션에는 매 프레임 보낸다. 등반 중이 아니면 클래스 기본 주기를 쓴다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UReplicationGraphNode_ClimbingCharacters : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+
+private:
+	struct FClimbingCharacter
+	{
+		ACharacter* Character = nullptr;
+		const UCustomMovementComponent* MovementComponent = nullptr;
+	};
+
+	/** @return 이 커넥션에서 캐릭터를 몇 프레임마다 보낼지 */
+	uint32 GetReplicationPeriodFrame(const FClimbingCharacter& Entry, const FConnectionGatherActorListParameters& Params, uint32 DefaultPeriodFrame) const;
+
+	/** UCustomMovementComponent 를 쓰는 캐릭터 (수집된 액터를 찾아보는 용도) */
+	TMap<const AActor*, FClimbingCharacter> ClimbingCharacters;
+};
+
+/**
+ * 기본 리플리케이션 그래프(그리드 / 항상 관련) 에 등반 캐릭터 주기 노드를 더한 그래프
+ * 모든 액터는 기본 라우팅을 따르고, UCustomMovementComponent 를 쓰는 캐릭터는 등반 노드에도 등록된다.
+ */
+UCLASS(Transient, Config = Engine)
+class CLIMBINGSYSTEM_API UClimbReplicationGraph : public UBasicReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	virtual void InitGlobalGraphNodes() override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+private:
+	static bool IsClimbingCharacter(const AActor* Actor);
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ClimbingCharacters> ClimbingCharacterNode;
+};
@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Climbing/ClimbAsyncPhysics.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ClimbAsyncPhysicsSubsystem.generated.h"
+
+/**
+ * 물리 스레드 등반 시뮬레이션 콜백의 소유자
+ *
+ * 월드 시작 시 물리 솔버에 FClimbAsyncSimCallback 을 등록하고, 게임 스레드의 등반자 입력을 모아 전달한다.
+ * 물리 스레드 결과는 프레임당 한 번 꺼내 두고, 물리 결과 시간에 맞춰 직전 두 결과 사이를 보간해 돌려준다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbAsyncPhysicsSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	FORCEINLINE bool IsAvailable() const { return SimCallback != nullptr; }
+
+	uint32 RegisterClimber();
+	void UnregisterClimber(uint32 ClimberId);
+
+	/** 이번 프레임 물리 스레드로 보낼 입력에 추가 */
+	void PushClimberInput(const FClimbAsyncClimberInput& ClimberInput);
+
+	/**
+	 * @brief 해당 리셋 세대의 보간된 최신 결과
+	 * @return 아직 그 세대의 결과가 없으면 false (물리 스레드가 입력을 받기 전)
+	 */
+	bool GetClimberOutput(uint32 ClimberId, uint32 ResetSerial, FClimbAsyncClimberOutput& OutOutput);
+
+private:
+	struct FClimberResults
+	{
+		FClimbAsyncClimberOutput Previous;
+		FClimbAsyncClimberOutput Latest;
+		double PreviousTime = 0.0;
+		double LatestTime = 0.0;
+		bool bHasPrevious = false;
+		bool bHasLatest = false;
+	};
+
+	/** 새 프레임의 첫 조회에서 쌓인 물리 스레드 결과를 모두 꺼냄 */
+	void ConsumeOutputs();
+
+	FClimbAsyncSimCallback* SimCallback = nullptr;
+
+	TMap<uint32, FClimberResults> Results;
+	uint32 NextClimberId = 1;
+	uint64 LastConsumedFrame = 0;
+};
@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Climbing/ClimbDistanceField.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "ClimbDistanceFieldSubsystem.generated.h"
+
+class UBodySetup;
+class UClimbSurfaceSubsystem;
+
+/**
+ * 레벨별 등반 표면 거리장
+ *
+ * 레벨이 월드에 들어올 때 (월드 시작 / 레벨 스트리밍) 그 레벨의 정적 등반 표면 중 단순 콜리전 (박스 / 구 / 캡슐) 으로만
+ * 이루어진 프리미티브로 부호 있는 희소 브릭 거리장을 백그라운드에서 한 번 빌드해 게시하고, 레벨이 빠지면 버린다.
+ * 컨벡스 / 복합 콜리전이나 랜드스케이프는 로그를 남기고 제외하므로 사용하는 쪽은 필드 결과를 스윕의 보조로만 쓴다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbDistanceFieldSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/**
+	 * @brief 가장 가까운 등반 표면까지의 부호 있는 거리 (콜리전 안쪽은 음수) 와 표면 밖을 향하는 법선
+	 * @return 필드가 비활성이거나 위치를 덮는 브릭이 없으면 false
+	 */
+	bool SampleDistance(const FVector& WorldLocation, float& OutDistance, FVector& OutNormal) const;
+
+	void BuildLevel(ULevel* Level);
+
+private:
+	void PublishLevelField(TObjectKey<ULevel> LevelKey, uint32 BuildId, FClimbDistanceField&& Field);
+
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
+	/** 필드에 넣을 등반 표면인지 (정적, Climb 채널 차단, 등반 가능) */
+	bool IsDistanceFieldCandidate(const UPrimitiveComponent* Component) const;
+
+	/** 부호 있는 거리를 구할 수 있는 콜리전인지 (박스 / 구 / 캡슐만, 랜드스케이프 제외) */
+	static bool HasSupportedDistanceGeometry(const UPrimitiveComponent* Component);
+
+	UPROPERTY()
+	TObjectPtr<UClimbSurfaceSubsystem> ClimbSurfaceSubsystem;
+
+	TMap<TObjectKey<ULevel>, FClimbDistanceField> LevelFields;
+
+	/** 레벨별 진행 중인 빌드 (게시 시점에 다르면 낡은 결과) */
+	TMap<TObjectKey<ULevel>, uint32> PendingBuildIds;
+	uint32 NextBuildId = 0;
+
+	TArray<UE::Tasks::FTask> InFlightBuilds;
+	int32 NumInFlightBuilds = 0;
+
+	/** 진행 중인 빌드가 읽는 바디 셋업 (모든 빌드가 끝날 때까지 유지) */
+	UPROPERTY()
+	TArray<TObjectPtr<UBodySetup>> InFlightBodySetups;
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+};
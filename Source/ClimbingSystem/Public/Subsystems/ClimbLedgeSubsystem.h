@@ -0,0 +1,104 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Climbing/ClimbLedgeTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "ClimbLedgeSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * 프리미티브별 렛지 폴리라인 캐시
+ *
+ * 처음 요청될 때 콜리전 박스(없으면 로컬 바운드) 윗면 가장자리를 한 번 추출하고, 가장자리를 따라 샘플링해
+ * 위가 막혀 있거나 윗면이 없는 구간을 틈으로 잘라 낸다. 결과는 프리미티브 로컬 공간(스케일 제외)에 저장되므로
+ * 움직이는 프리미티브에서도 다시 추출하지 않는다.
+ *
+ * 추출은 모두 RequestLedges 로 큐에 넣어 한 번에 한 프리미티브씩, 프레임당 상한만큼 비동기 트레이스로 한다.
+ * 게임플레이 (쉬미) 는 등반 중인 표면을 큐 앞쪽에 미리 요청해 두므로 렛지에 도달했을 때 보통 이미 캐시에 있다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbLedgeSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief 추출된 렛지가 있으면 반환, 없으면 비동기 추출을 큐에 넣고 nullptr (추출이 끝난 뒤의 호출에서 반환됨)
+	 * @param bUrgent 게임플레이가 곧 쓸 프리미티브면 큐 맨 앞에 넣음
+	 */
+	const FClimbLedgeSet* RequestLedges(const UPrimitiveComponent* Component, bool bUrgent = false);
+
+	/** 이미 추출된 렛지만 조회 (추출 트레이스를 하지 않음) */
+	const FClimbLedgeSet* FindCachedLedges(const UPrimitiveComponent* Component) const;
+
+	/**
+	 * @brief 월드 위치에서 MaxDistance 안에 있는 컴포넌트의 가장 가까운 렛지
+	 *
+	 * 아직 추출되지 않았으면 급한 추출을 요청하고 false 를 반환한다 (그 자리에서 트레이스하지 않음).
+	 * @param OutDistance 가장 가까운 점의 폴리라인 거리
+	 */
+	bool FindClosestLedge(const UPrimitiveComponent* Component, const FVector& WorldLocation, float MaxDistance, FClimbLedgePolyline& OutLedge, float& OutDistance);
+
+private:
+	/** 윗면 테두리 샘플 하나와 그 위를 확인하는 트레이스 */
+	struct FLedgeSample
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector Normal = FVector::ZeroVector;
+		FVector UpDirection = FVector::UpVector;
+		FVector TraceStart = FVector::ZeroVector;
+		FVector TraceEnd = FVector::ZeroVector;
+		bool bCorner = false;
+		bool bClear = false;
+	};
+
+	/** 한 프리미티브의 추출 작업. 박스별 샘플이 Samples 에 이어져 있고 BoxSampleEnds 가 각 박스의 끝 인덱스 */
+	struct FLedgeBuild
+	{
+		TWeakObjectPtr<const UPrimitiveComponent> Component;
+		FTransform ComponentTransform;
+		TArray<FLedgeSample> Samples;
+		TArray<int32> BoxSampleEnds;
+		int32 NumDispatched = 0;
+		int32 NumCompleted = 0;
+	};
+
+	/** 콜리전 박스(없으면 로컬 바운드) 마다 윗면 테두리 샘플을 만듦 (트레이스 전) */
+	void GatherLedgeSamples(const UPrimitiveComponent* Component, FLedgeBuild& OutBuild) const;
+
+	/** 박스(컴포넌트 로컬) 의 가장 위를 향한 면 테두리 샘플을 추가 */
+	static void AddBoxSamples(const FTransform& BoxToComponent, const FVector& BoxExtent, FLedgeBuild& OutBuild);
+
+	/** 트레이스가 끝난 샘플로 박스별 렛지 폴리라인을 만듦 */
+	static FClimbLedgeSet AssembleLedges(const FLedgeBuild& Build);
+	static void AddBoxLedges(TConstArrayView<FLedgeSample> Samples, const FTransform& ComponentTransform, FClimbLedgeSet& OutLedgeSet);
+
+	/** 샘플 트레이스 히트(거리순) 로 가장자리 안쪽 점이 이 컴포넌트의 윗면 위에 있고, 그 위가 다른 정적 물체에 막혀 있지 않은지 */
+	static bool IsLedgeSampleClear(const UPrimitiveComponent* Component, TConstArrayView<FHitResult> Hits, const FVector& UpDirection);
+
+	void StartNextQueuedBuild();
+	void DispatchActiveBuildTraces();
+	void OnSampleTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	void OnActorDestroyed(AActor* DestroyedActor);
+
+	TMap<TObjectKey<UPrimitiveComponent>, FClimbLedgeSet> CachedLedges;
+	FDelegateHandle ActorDestroyedHandle;
+
+	/** 비동기 추출 대기 중인 프리미티브 (진행 중인 것 제외) */
+	TArray<TWeakObjectPtr<const UPrimitiveComponent>> BuildQueue;
+	TSet<TObjectKey<UPrimitiveComponent>> QueuedComponents;
+
+	/** 진행 중인 비동기 추출. 한 번에 하나뿐이므로 트레이스 UserData 는 샘플 인덱스 */
+	TOptional<FLedgeBuild> ActiveBuild;
+	FTraceDelegate SampleTraceDelegate;
+};
@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ClimbQueryCacheSubsystem.generated.h"
+
+/**
+ * 캐릭터 간 공유되는 등반 씬 쿼리 캐시
+ *
+ * 쿼리 원점 / 끝점 / 형태를 양자화한 키로 같은 프레임의 동일(또는 거의 동일한) 쿼리를 한 번만 실행하고
+ * 결과를 모든 호출자에게 돌려준다. 모든 히트가 Static 모빌리티인 결과는 짧은 수명 동안 다음 프레임에서도 재사용하되,
+ * 그 사이 끼어든 움직이는 물체를 놓치지 않도록 움직이는 물체만 대상으로 한 쿼리를 다시 실행해 합친다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbQueryCacheSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	bool LineTraceSingle(FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel TraceChannel, const FCollisionQueryParams& QueryParams);
+
+	bool SweepMulti(TArray<FHitResult>& OutHits, const FVector& Start, const FVector& End, const FQuat& Rotation, ECollisionChannel TraceChannel,
+		const FCollisionShape& CollisionShape, const FCollisionQueryParams& QueryParams, const FCollisionResponseParams& ResponseParams);
+
+	/** 캐시 전체 무효화 (지오메트리가 크게 바뀐 경우) */
+	void FlushCache();
+
+private:
+	enum class EClimbQueryKind : uint8
+	{
+		LineSingle,
+		SweepMulti
+	};
+
+	struct FClimbQueryKey
+	{
+		FIntVector Start = FIntVector::ZeroValue;
+		FIntVector End = FIntVector::ZeroValue;
+		FIntVector ShapeExtent = FIntVector::ZeroValue;
+		uint32 RotationHash = 0;
+		uint32 ParamsHash = 0;
+		EClimbQueryKind Kind = EClimbQueryKind::LineSingle;
+		uint8 TraceChannel = 0;
+
+		bool operator==(const FClimbQueryKey& Other) const
+		{
+			return Start == Other.Start && End == Other.End && ShapeExtent == Other.ShapeExtent && RotationHash == Other.RotationHash
+				&& ParamsHash == Other.ParamsHash && Kind == Other.Kind && TraceChannel == Other.TraceChannel;
+		}
+
+		friend uint32 GetTypeHash(const FClimbQueryKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.Start), GetTypeHash(Key.End));
+			Hash = HashCombine(Hash, GetTypeHash(Key.ShapeExtent));
+			Hash = HashCombine(Hash, Key.RotationHash);
+			Hash = HashCombine(Hash, Key.ParamsHash);
+			return HashCombine(Hash, (static_cast<uint32>(Key.Kind) << 8) | Key.TraceChannel);
+		}
+	};
+
+	struct FClimbQueryEntry
+	{
+		TArray<FHitResult> Hits;
+		uint64 FrameNumber = 0;
+		double Time = 0.0;
+
+		/** 모든 히트가 Static 모빌리티 → 프레임을 넘어 재사용 가능 */
+		bool bStaticGeometry = false;
+	};
+
+	FClimbQueryKey MakeKey(EClimbQueryKind Kind, const FVector& Start, const FVector& End, const FQuat& Rotation, ECollisionChannel TraceChannel,
+		const FCollisionShape& CollisionShape, const FCollisionQueryParams& QueryParams, const FCollisionResponseParams* ResponseParams) const;
+
+	/** @param bOutNeedsDynamicQuery 이전 프레임의 Static 결과라서 움직이는 물체만 다시 쿼리해야 함 */
+	const FClimbQueryEntry* FindReusableEntry(const FClimbQueryKey& Key, bool& bOutNeedsDynamicQuery) const;
+	void StoreEntry(const FClimbQueryKey& Key, const TArray<FHitResult>& Hits);
+
+	/** 새 프레임의 첫 쿼리에서 만료된 엔트리 정리 */
+	void PurgeStaleEntries();
+
+	static void MergeDynamicHits(TArray<FHitResult>& InOutHits, const TArray<FHitResult>& DynamicHits);
+	static void RetargetHits(TArray<FHitResult>& InOutHits, const FVector& Start, const FVector& End);
+
+	TMap<FClimbQueryKey, FClimbQueryEntry> Entries;
+	uint64 LastPurgeFrame = 0;
+};
@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Climbing/ClimbSurfaceTypes.h"
+#include "ClimbSurfaceSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * 월드의 프리미티브 컴포넌트별 등반 속성 캐시
+ * 액터가 스폰(등록)될 때 한 번 해석해 두고, 트레이스 히트 이후에는 O(1) 로 조회한다.
+ * 등반 불가 컴포넌트는 등록 시 Climb 채널을 무시하도록 바꿔 등반 쿼리에 처음부터 걸리지 않게 한다.
+ */
+UCLASS()
+class CLIMBINGSYSTEM_API UClimbSurfaceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	void RegisterActor(AActor* Actor);
+	void UnregisterActor(AActor* Actor);
+
+	const FClimbSurfaceProperties& GetSurfaceProperties(const FHitResult& Hit);
+	const FClimbSurfaceProperties& GetComponentProperties(const UPrimitiveComponent* Component);
+
+	/** 등록된 모든 컴포넌트를 순회 (등반 경로 그래프 빌드 등 오프라인 처리용) */
+	void ForEachRegisteredComponent(TFunctionRef<void(const UPrimitiveComponent*, const FClimbSurfaceProperties&)> Func) const;
+
+	/**
+	 * @brief bClimbable == false 인 히트를 제거
+	 * 등반 불가 컴포넌트는 이미 Climb 채널을 무시하므로, 여기서는 피지컬 머티리얼로 등반 불가가 된 히트와
+	 * 아직 등록되지 않은 컴포넌트의 히트만 걸러진다.
+	 */
+	void FilterClimbableHits(TArray<FHitResult>& InOutHits);
+
+private:
+	const FClimbSurfaceProperties& RegisterComponent(const UPrimitiveComponent* Component);
+	static FClimbSurfaceProperties ResolveComponentProperties(const UPrimitiveComponent* Component);
+
+	void OnActorSpawned(AActor* SpawnedActor);
+	void OnActorDestroyed(AActor* DestroyedActor);
+	void OnComponentDestroyPhysics(UActorComponent* Component);
+
+	TMap<TObjectKey<UPrimitiveComponent>, FClimbSurfaceProperties> CachedComponentProperties;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+	FDelegateHandle ComponentDestroyPhysicsHandle;
+
+	static const FClimbSurfaceProperties DefaultSurfaceProperties;
+};